@@ -0,0 +1,227 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4FieldBatchTrackingManager
+//
+// Class description:
+//
+// Tracking manager advancing charged particles together, in batches,
+// through the volumes of selected regions where the propagation in the
+// magnetic field dominates and the material is thin enough for physics
+// processes to be neglected, e.g. the vacuum of a beam line or of the
+// gaps of a spectrometer. Elsewhere, tracks are processed step by step
+// as by G4TrackingManager.
+//
+// A track is batched when it is in a volume of one of the regions added
+// with AddRegion(), whose material has a density below the maximum, which
+// has no sensitive detector nor user limits, and with a field manager,
+// if any, holding a magnetic field; its distance to the volume boundaries,
+// of the mass geometry and of the parallel worlds, must also exceed the
+// minimum safety. Batched tracks are queued until the batch is full, or
+// until the end of the event, and then integrated together with a
+// G4MagFieldBatchStepper, using the accuracy parameters of their field
+// manager, as long as they remain further than the minimum safety from
+// the boundaries. They are then handed back to the standard stepping,
+// which in turn returns them to the queue when they meet again the
+// conditions for batching. Each batched segment is counted as one step
+// of the track.
+//
+// The user tracking action is invoked, and the trajectory created, once
+// per track, when the track is first handed over, and the tracking is
+// ended when it dies or is suspended. In batched segments no physics
+// process, nor user stepping action, is invoked and no trajectory point
+// is stored. Particles with an active decay process are therefore never
+// batched, since their decay does not depend on the material.
+//
+// Usage, for the particles chosen, in the ConstructProcess() method of
+// the physics list:
+//
+//   auto manager = new G4FieldBatchTrackingManager;
+//   manager->AddRegion("BeamLine");
+//   G4Electron::Definition()->SetTrackingManager(manager);
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4FieldBatchTrackingManager_hh
+#define G4FieldBatchTrackingManager_hh 1
+
+#include "G4VTrackingManager.hh"
+#include "G4MagFieldBatchStepper.hh"
+#include "G4String.hh"
+#include "G4Types.hh"
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+class G4Navigator;
+class G4LogicalVolume;
+class G4Region;
+class G4FieldManager;
+class G4MagneticField;
+class G4VTrajectory;
+
+class G4FieldBatchTrackingManager : public G4VTrackingManager
+{
+  public:
+
+    explicit G4FieldBatchTrackingManager(G4int batchSize = 256);
+    ~G4FieldBatchTrackingManager() override;
+
+    void BuildPhysicsTable(const G4ParticleDefinition& part) override;
+    void PreparePhysicsTable(const G4ParticleDefinition& part) override;
+      // Build or prepare the tables of the processes of the particle,
+      // used by the standard stepping.
+
+    void HandOverOneTrack(G4Track* track) override;
+    void FlushEvent() override;
+
+    void AddRegion(const G4String& name);
+      // Adds a region in whose volumes tracks may be batched. The name
+      // is resolved when the physics tables are prepared.
+
+    inline void SetBatchSize(G4int value);
+    inline G4int GetBatchSize() const;
+      // Number of queued tracks triggering the integration of a batch.
+
+    inline void SetMaximumDensity(G4double value);
+    inline G4double GetMaximumDensity() const;
+      // Density above which the material of a volume is not neglected.
+
+    inline void SetMinimumSafety(G4double value);
+    inline G4double GetMinimumSafety() const;
+      // Distance to the volume boundaries below which a track leaves
+      // the batch.
+
+    inline void SetMaximumBatchSteps(G4int value);
+    inline G4int GetMaximumBatchSteps() const;
+      // Number of integration steps after which a batched track is
+      // tracked to its end by the standard stepping, protecting from
+      // tracks looping indefinitely in a volume.
+
+  private:
+
+    struct Entry
+    {
+      G4Track* track = nullptr;
+      G4FieldManager* fieldManager = nullptr;
+      const G4MagneticField* field = nullptr;
+      G4double safety = 0.0;
+    };
+
+    G4bool IsBatchable(G4Track* track, Entry& entry);
+      // Checks the conditions for batching at the position of the track
+      // and fills the entry for it.
+
+    G4bool HasActiveDecay(const G4ParticleDefinition* particle) const;
+      // Whether a decay process is active for the particle.
+
+    G4double ComputeSafety(G4Track* track);
+      // Distance of the track to the boundaries of the mass geometry and
+      // of the parallel worlds; not computed further once it is found
+      // below the minimum safety.
+
+    void StartTrack(G4Track* track);
+    void ResumeTrack(G4Track* track, G4bool allowBatching);
+    void EndTrack(G4Track* track);
+      // Begin the tracking of a track handed over, resume it after a
+      // batched segment, and end it when it dies or is suspended.
+
+    void TrackStandard(G4Track* track, G4bool allowBatching);
+      // Tracks step by step until the track ends or, if allowed, meets
+      // the conditions for batching; it is then queued.
+
+    void AdvanceBatch();
+      // Integrates the queued tracks until they leave the batch, and
+      // hands them back to the standard stepping.
+
+    void UpdateTrack(G4Track* track, std::size_t index, G4double length);
+
+  private:
+
+    G4int fBatchSize;
+    G4double fMaxDensity;
+    G4double fMinSafety;
+    G4int fMaxBatchSteps = 10000;
+
+    std::vector<G4String> fRegionNames;
+    std::set<const G4Region*> fRegions;
+
+    G4Navigator* fNavigator = nullptr;
+    std::vector<G4Navigator*> fParallelNavigators;
+    std::vector<Entry> fQueue;
+
+    std::unordered_map<G4Track*, G4VTrajectory*> fStartedTracks;
+      // Tracks begun and not yet ended, with their trajectory, if any
+    G4Track* fLastStepped = nullptr;
+      // Track for which the processes were last started
+    G4MagFieldBatchStepper fStepper;
+};
+
+// --------------------------------------------------------------------
+// Inline methods
+// --------------------------------------------------------------------
+
+inline void G4FieldBatchTrackingManager::SetBatchSize(G4int value)
+{
+  fBatchSize = value;
+}
+
+inline G4int G4FieldBatchTrackingManager::GetBatchSize() const
+{
+  return fBatchSize;
+}
+
+inline void G4FieldBatchTrackingManager::SetMaximumDensity(G4double value)
+{
+  fMaxDensity = value;
+}
+
+inline G4double G4FieldBatchTrackingManager::GetMaximumDensity() const
+{
+  return fMaxDensity;
+}
+
+inline void G4FieldBatchTrackingManager::SetMinimumSafety(G4double value)
+{
+  fMinSafety = value;
+}
+
+inline G4double G4FieldBatchTrackingManager::GetMinimumSafety() const
+{
+  return fMinSafety;
+}
+
+inline void G4FieldBatchTrackingManager::SetMaximumBatchSteps(G4int value)
+{
+  fMaxBatchSteps = value;
+}
+
+inline G4int G4FieldBatchTrackingManager::GetMaximumBatchSteps() const
+{
+  return fMaxBatchSteps;
+}
+
+#endif
@@ -10,6 +10,7 @@ geant4_add_module(G4event
     G4EvManMessenger.hh
     G4Event.hh
     G4EventManager.hh
+    G4FieldBatchTrackingManager.hh
     G4GeneralParticleSource.hh
     G4GeneralParticleSourceData.hh
     G4GeneralParticleSourceMessenger.hh
@@ -44,6 +45,7 @@ geant4_add_module(G4event
     G4EvManMessenger.cc
     G4Event.cc
     G4EventManager.cc
+    G4FieldBatchTrackingManager.cc
     G4GeneralParticleSource.cc
     G4GeneralParticleSourceData.cc
     G4GeneralParticleSourceMessenger.cc
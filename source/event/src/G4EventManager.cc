@@ -227,6 +227,11 @@ void G4EventManager::DoProcessing(G4Event* anEvent)
         }
         if((aTrajectory != nullptr)&&(istop!=fStopButAlive)&&(istop!=fSuspend))
         {
+          if(trajectoryContainer == nullptr)
+          {
+            // It may have been created by a custom tracking manager
+            trajectoryContainer = currentEvent->GetTrajectoryContainer();
+          }
           if(trajectoryContainer == nullptr)
           {
             trajectoryContainer = new G4TrajectoryContainer;
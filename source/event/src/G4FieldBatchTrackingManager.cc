@@ -0,0 +1,655 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4FieldBatchTrackingManager implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include "G4FieldBatchTrackingManager.hh"
+
+#include "G4EventManager.hh"
+#include "G4Event.hh"
+#include "G4StackManager.hh"
+#include "G4TrackingManager.hh"
+#include "G4SteppingManager.hh"
+#include "G4UserTrackingAction.hh"
+#include "G4TrajectoryContainer.hh"
+#include "G4Trajectory.hh"
+#include "G4SmoothTrajectory.hh"
+#include "G4RichTrajectory.hh"
+#include "G4Track.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4VProcess.hh"
+#include "G4Navigator.hh"
+#include "G4TransportationManager.hh"
+#include "G4TouchableHistory.hh"
+#include "G4FieldManager.hh"
+#include "G4MagneticField.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4Material.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4PhysicalConstants.hh"
+
+#include <algorithm>
+
+// --------------------------------------------------------------------
+G4FieldBatchTrackingManager::G4FieldBatchTrackingManager(G4int batchSize)
+  : fBatchSize(batchSize),
+    fMaxDensity(1.0e-5 * g/cm3),
+    fMinSafety(1.0 * cm)
+{
+  fNavigator = new G4Navigator();
+}
+
+// --------------------------------------------------------------------
+G4FieldBatchTrackingManager::~G4FieldBatchTrackingManager()
+{
+  delete fNavigator;
+  for (auto navigator : fParallelNavigators)
+  {
+    delete navigator;
+  }
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::AddRegion(const G4String& name)
+{
+  fRegionNames.push_back(name);
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::
+BuildPhysicsTable(const G4ParticleDefinition& part)
+{
+  G4ProcessManager* pManager = part.GetProcessManager();
+  G4ProcessManager* pManagerShadow = part.GetMasterProcessManager();
+  if (pManager == nullptr || part.IsShortLived()) { return; }
+
+  G4ProcessVector* pVector = pManager->GetProcessList();
+  for (G4int j = 0; j < (G4int)pVector->size(); ++j)
+  {
+    // The master thread is the one in which the process manager and
+    // the shadow process manager are the same
+    //
+    if (pManagerShadow == pManager)
+    {
+      (*pVector)[j]->BuildPhysicsTable(part);
+    }
+    else
+    {
+      (*pVector)[j]->BuildWorkerPhysicsTable(part);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::
+PreparePhysicsTable(const G4ParticleDefinition& part)
+{
+  fRegions.clear();
+  for (const auto& name : fRegionNames)
+  {
+    G4Region* region = G4RegionStore::GetInstance()->GetRegion(name, false);
+    if (region == nullptr)
+    {
+      G4ExceptionDescription ed;
+      ed << "Region " << name << " not found. It is ignored.";
+      G4Exception("G4FieldBatchTrackingManager::PreparePhysicsTable()",
+                  "Event0401", JustWarning, ed);
+      continue;
+    }
+    fRegions.insert(region);
+  }
+
+  G4ProcessManager* pManager = part.GetProcessManager();
+  G4ProcessManager* pManagerShadow = part.GetMasterProcessManager();
+  if (pManager == nullptr || part.IsShortLived()) { return; }
+
+  G4ProcessVector* pVector = pManager->GetProcessList();
+  for (G4int j = 0; j < (G4int)pVector->size(); ++j)
+  {
+    if (pManagerShadow == pManager)
+    {
+      (*pVector)[j]->PreparePhysicsTable(part);
+    }
+    else
+    {
+      (*pVector)[j]->PrepareWorkerPhysicsTable(part);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::HandOverOneTrack(G4Track* track)
+{
+  // Other tracks may have been processed since the last call
+  //
+  fLastStepped = nullptr;
+
+  StartTrack(track);
+
+  Entry entry;
+  if (track->GetTrackStatus() != fAlive || !IsBatchable(track, entry))
+  {
+    TrackStandard(track, true);
+    return;
+  }
+  fQueue.push_back(entry);
+  if ((G4int)fQueue.size() >= fBatchSize)
+  {
+    AdvanceBatch();
+  }
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::FlushEvent()
+{
+  fLastStepped = nullptr;
+  while (!fQueue.empty())
+  {
+    AdvanceBatch();
+  }
+  fStartedTracks.clear();
+}
+
+// --------------------------------------------------------------------
+G4bool G4FieldBatchTrackingManager::
+HasActiveDecay(const G4ParticleDefinition* particle) const
+{
+  G4ProcessManager* processManager = particle->GetProcessManager();
+  if (processManager == nullptr) { return false; }
+
+  G4ProcessVector* processes = processManager->GetProcessList();
+  for (std::size_t i = 0; i < processes->size(); ++i)
+  {
+    G4VProcess* process = (*processes)[i];
+    if (process->GetProcessType() == fDecay
+     && processManager->GetProcessActivation(process))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// --------------------------------------------------------------------
+G4bool G4FieldBatchTrackingManager::IsBatchable(G4Track* track, Entry& entry)
+{
+  if (fRegions.empty() || track->GetKineticEnergy() <= 0.0
+   || HasActiveDecay(track->GetDefinition()))
+  {
+    return false;
+  }
+
+  // Cheap conditions first, on the volume of the track
+  //
+  G4VPhysicalVolume* pVolume = track->GetVolume();
+  if (pVolume == nullptr) { return false; }
+
+  G4LogicalVolume* lVolume = pVolume->GetLogicalVolume();
+  G4Region* region = lVolume->GetRegion();
+  if (fRegions.find(region) == fRegions.cend()
+   || lVolume->GetMaterial()->GetDensity() > fMaxDensity
+   || lVolume->GetSensitiveDetector() != nullptr
+   || lVolume->GetUserLimits() != nullptr)
+  {
+    return false;
+  }
+
+  // Field manager of the volume, chosen as by G4PropagatorInField
+  //
+  G4TransportationManager* transportationManager
+    = G4TransportationManager::GetTransportationManager();
+  G4FieldManager* fieldManager = transportationManager->GetFieldManager();
+  if (region->GetFieldManager() != nullptr)
+  {
+    fieldManager = region->GetFieldManager();
+  }
+  if (lVolume->GetFieldManager() != nullptr)
+  {
+    fieldManager = lVolume->GetFieldManager();
+  }
+  const G4MagneticField* field = nullptr;
+  if (fieldManager != nullptr && fieldManager->GetDetectorField() != nullptr)
+  {
+    field = dynamic_cast<const G4MagneticField*>
+              (fieldManager->GetDetectorField());
+    if (field == nullptr || fieldManager->DoesFieldChangeEnergy())
+    {
+      return false;
+    }
+  }
+
+  // Navigators for the mass geometry and for the parallel worlds, if
+  // any, following the worlds registered for transportation
+  //
+  std::size_t nWorlds = transportationManager->GetNoWorlds();
+  auto worlds = transportationManager->GetWorldsIterator();
+  G4VPhysicalVolume* world = transportationManager
+                           ->GetNavigatorForTracking()->GetWorldVolume();
+  if (fNavigator->GetWorldVolume() != world)
+  {
+    fNavigator->SetWorldVolume(world);
+  }
+  std::size_t nParallel = 0;
+  for (std::size_t i = 0; i < nWorlds; ++i, ++worlds)
+  {
+    if (*worlds == world) { continue; }
+    if (nParallel == fParallelNavigators.size())
+    {
+      fParallelNavigators.push_back(new G4Navigator());
+    }
+    G4Navigator* navigator = fParallelNavigators[nParallel++];
+    if (navigator->GetWorldVolume() != *worlds)
+    {
+      navigator->SetWorldVolume(*worlds);
+    }
+  }
+  while (fParallelNavigators.size() > nParallel)
+  {
+    delete fParallelNavigators.back();
+    fParallelNavigators.pop_back();
+  }
+
+  G4double safety = ComputeSafety(track);
+  if (safety < fMinSafety) { return false; }
+
+  entry.track = track;
+  entry.fieldManager = fieldManager;
+  entry.field = field;
+  entry.safety = safety;
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4double G4FieldBatchTrackingManager::ComputeSafety(G4Track* track)
+{
+  const G4ThreeVector& position = track->GetPosition();
+
+  // The touchable of the track avoids a search from the world volume
+  //
+  const auto* history
+    = dynamic_cast<const G4TouchableHistory*>(track->GetTouchable());
+  if (history != nullptr)
+  {
+    fNavigator->ResetHierarchyAndLocate(position,
+                                        track->GetMomentumDirection(),
+                                        *history);
+  }
+  else
+  {
+    fNavigator->LocateGlobalPointAndSetup(position, nullptr, false, true);
+  }
+  G4double safety = fNavigator->ComputeSafety(position);
+
+  for (auto navigator : fParallelNavigators)
+  {
+    if (safety < fMinSafety) { break; }
+    navigator->LocateGlobalPointAndSetup(position, nullptr, false, true);
+    safety = std::min(safety, navigator->ComputeSafety(position));
+  }
+  return safety;
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::StartTrack(G4Track* track)
+{
+  G4TrackingManager* trackingManager
+    = G4EventManager::GetEventManager()->GetTrackingManager();
+  G4SteppingManager* steppingManager = trackingManager->GetSteppingManager();
+  G4UserTrackingAction* userTrackingAction
+    = trackingManager->GetUserTrackingAction();
+
+  steppingManager->SetInitialStep(track);
+
+  G4VTrajectory* trajectory = nullptr;
+#ifdef G4_STORE_TRAJECTORY
+  trackingManager->SetTrajectory(nullptr);
+#endif
+  if (userTrackingAction != nullptr)
+  {
+    userTrackingAction->PreUserTrackingAction(track);
+  }
+#ifdef G4_STORE_TRAJECTORY
+  // Construct a trajectory if it is requested, as by G4TrackingManager
+  //
+  trajectory = trackingManager->GimmeTrajectory();
+  G4int storeTrajectory = trackingManager->GetStoreTrajectory();
+  if (storeTrajectory != 0 && trajectory == nullptr)
+  {
+    switch (storeTrajectory)
+    {
+      default:
+      case 1:
+        trajectory = new G4Trajectory(track);
+        break;
+      case 2:
+        trajectory = new G4SmoothTrajectory(track);
+        break;
+      case 3:
+      case 4:
+        trajectory = new G4RichTrajectory(track);
+        break;
+    }
+    trackingManager->SetTrajectory(trajectory);
+  }
+#endif
+  fStartedTracks[track] = trajectory;
+
+  steppingManager->GetProcessNumber();
+  track->SetStep(steppingManager->GetStep());
+  track->GetDefinition()->GetProcessManager()->StartTracking(track);
+  fLastStepped = track;
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::ResumeTrack(G4Track* track,
+                                              G4bool allowBatching)
+{
+  G4TrackingManager* trackingManager
+    = G4EventManager::GetEventManager()->GetTrackingManager();
+  G4SteppingManager* steppingManager = trackingManager->GetSteppingManager();
+
+  steppingManager->SetInitialStep(track);
+  steppingManager->GetProcessNumber();
+  track->SetStep(steppingManager->GetStep());
+#ifdef G4_STORE_TRAJECTORY
+  trackingManager->SetTrajectory(fStartedTracks[track]);
+#endif
+
+  // The processes keep the state of the track they last stepped: they
+  // are restarted only if they were used for another track meanwhile
+  //
+  if (fLastStepped != track)
+  {
+    track->GetDefinition()->GetProcessManager()->StartTracking(track);
+    fLastStepped = track;
+  }
+
+  TrackStandard(track, allowBatching);
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::EndTrack(G4Track* track)
+{
+  G4EventManager* eventManager = G4EventManager::GetEventManager();
+  G4TrackingManager* trackingManager = eventManager->GetTrackingManager();
+  G4UserTrackingAction* userTrackingAction
+    = trackingManager->GetUserTrackingAction();
+
+  track->GetDefinition()->GetProcessManager()->EndTracking();
+  fLastStepped = nullptr;
+
+  if (userTrackingAction != nullptr)
+  {
+    userTrackingAction->PostUserTrackingAction(track);
+  }
+
+  auto started = fStartedTracks.find(track);
+  G4VTrajectory* trajectory = nullptr;
+  if (started != fStartedTracks.end())
+  {
+    trajectory = started->second;
+    fStartedTracks.erase(started);
+  }
+#ifdef G4_STORE_TRAJECTORY
+  // The trajectory may have been replaced by the user tracking action
+  //
+  if (trackingManager->GimmeTrajectory() != nullptr)
+  {
+    trajectory = trackingManager->GimmeTrajectory();
+  }
+  trackingManager->SetTrajectory(nullptr);
+  if (trajectory != nullptr)
+  {
+    if (trackingManager->GetStoreTrajectory() == 0)
+    {
+      delete trajectory;
+    }
+    else
+    {
+      G4Event* event = eventManager->GetNonconstCurrentEvent();
+      G4TrajectoryContainer* container = event->GetTrajectoryContainer();
+      if (container == nullptr)
+      {
+        container = new G4TrajectoryContainer;
+        event->SetTrajectoryContainer(container);
+      }
+      container->insert(trajectory);
+    }
+  }
+#endif
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::TrackStandard(G4Track* track,
+                                                G4bool allowBatching)
+{
+  G4EventManager* eventManager = G4EventManager::GetEventManager();
+  G4TrackingManager* trackingManager = eventManager->GetTrackingManager();
+  G4SteppingManager* steppingManager = trackingManager->GetSteppingManager();
+
+  // Clear secondary particle vector
+  //
+  G4TrackVector* secondaries = trackingManager->GimmeSecondaries();
+  for (auto& secondary : *secondaries)
+  {
+    delete secondary;
+  }
+  secondaries->clear();
+
+  G4VTrajectory* trajectory = fStartedTracks[track];
+  Entry entry;
+  G4bool batched = false;
+  while (track->GetTrackStatus() == fAlive
+      || track->GetTrackStatus() == fStopButAlive)
+  {
+    track->IncrementCurrentStepNumber();
+    steppingManager->Stepping();
+    if (trajectory != nullptr && trackingManager->GetStoreTrajectory() != 0)
+    {
+      trajectory->AppendStep(steppingManager->GetStep());
+    }
+    if (eventManager->GetConstCurrentEvent()->IsAborted())
+    {
+      track->SetTrackStatus(fKillTrackAndSecondaries);
+    }
+    else if (allowBatching && track->GetTrackStatus() == fAlive
+          && IsBatchable(track, entry))
+    {
+      batched = true;
+      break;
+    }
+  }
+
+  if (batched)
+  {
+    eventManager->StackTracks(secondaries);
+    fQueue.push_back(entry);
+    return;
+  }
+
+  EndTrack(track);
+
+  switch (track->GetTrackStatus())
+  {
+    case fStopButAlive:
+    case fSuspend:
+    case fPostponeToNextEvent:
+      eventManager->GetStackManager()->PushOneTrack(track);
+      eventManager->StackTracks(secondaries);
+      break;
+
+    case fKillTrackAndSecondaries:
+      for (auto& secondary : *secondaries)
+      {
+        delete secondary;
+      }
+      secondaries->clear();
+      delete track;
+      break;
+
+    default:
+      eventManager->StackTracks(secondaries);
+      delete track;
+      break;
+  }
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::AdvanceBatch()
+{
+  std::vector<Entry> batch;
+  batch.swap(fQueue);
+
+  // Field managers in order of first appearance, so that tracks are
+  // handed back in an order not depending on memory addresses
+  //
+  std::vector<G4FieldManager*> fieldManagers;
+  for (const auto& entry : batch)
+  {
+    if (std::find(fieldManagers.cbegin(), fieldManagers.cend(),
+                  entry.fieldManager) == fieldManagers.cend())
+    {
+      fieldManagers.push_back(entry.fieldManager);
+    }
+  }
+
+  // Tracks leave the batch at a distance of at least half the minimum
+  // safety from the boundaries; a flag marks those which reached the
+  // maximum number of steps
+  //
+  const G4double margin = 0.5 * fMinSafety;
+  std::vector<std::pair<G4Track*, G4bool>> done;
+  std::vector<G4Track*> tracks;
+  std::vector<G4double> budget, length, hDone;
+  std::vector<G4int> steps;
+
+  for (auto fieldManager : fieldManagers)
+  {
+    fStepper.Clear();
+    fStepper.SetField(nullptr);
+    if (fieldManager != nullptr)
+    {
+      fStepper.SetAccuracy(fieldManager->GetDeltaOneStep(),
+                           fieldManager->GetMinimumEpsilonStep(),
+                           fieldManager->GetMaximumEpsilonStep());
+      fStepper.SetField(dynamic_cast<const G4MagneticField*>
+                          (fieldManager->GetDetectorField()));
+    }
+    tracks.clear();
+    budget.clear();
+    length.clear();
+    steps.clear();
+
+    for (const auto& entry : batch)
+    {
+      if (entry.fieldManager != fieldManager) { continue; }
+
+      G4Track* track = entry.track;
+      track->IncrementCurrentStepNumber();
+      fStepper.AddTrack(track->GetPosition(), track->GetMomentum(),
+                        track->GetDynamicParticle()->GetCharge() / eplus,
+                        track->GetGlobalTime());
+      tracks.push_back(track);
+      budget.push_back(entry.safety - margin);
+      length.push_back(0.0);
+      steps.push_back(0);
+    }
+
+    while (fStepper.GetNumberOfTracks() > 0)
+    {
+      std::size_t n = fStepper.GetNumberOfTracks();
+      hDone.resize(n);
+      fStepper.Step(budget.data(), hDone.data());
+
+      for (std::size_t i = n; i-- > 0;)
+      {
+        budget[i] -= hDone[i];
+        length[i] += hDone[i];
+        ++steps[i];
+        if (budget[i] >= margin && steps[i] < fMaxBatchSteps) { continue; }
+
+        UpdateTrack(tracks[i], i, length[i]);
+        length[i] = 0.0;
+        G4bool capped = (steps[i] >= fMaxBatchSteps);
+        if (!capped)
+        {
+          G4double safety = ComputeSafety(tracks[i]);
+          if (safety >= fMinSafety)
+          {
+            budget[i] = safety - margin;
+            continue;
+          }
+        }
+
+        // The track leaves the batch; the last one takes its place
+        //
+        done.emplace_back(tracks[i], capped);
+        fStepper.RemoveTrack(i);
+        std::size_t last = tracks.size() - 1;
+        tracks[i] = tracks[last];
+        budget[i] = budget[last];
+        length[i] = length[last];
+        steps[i] = steps[last];
+        tracks.pop_back();
+        budget.pop_back();
+        length.pop_back();
+        steps.pop_back();
+      }
+    }
+  }
+  fStepper.Clear();
+
+  for (const auto& item : done)
+  {
+    ResumeTrack(item.first, !item.second);
+  }
+}
+
+// --------------------------------------------------------------------
+void G4FieldBatchTrackingManager::UpdateTrack(G4Track* track,
+                                              std::size_t index,
+                                              G4double length)
+{
+  if (length <= 0.0) { return; }
+
+  G4double deltaTime = length / track->CalculateVelocity();
+  G4double properTimeRatio = track->GetDynamicParticle()->GetMass()
+                           / track->GetTotalEnergy();
+
+  track->SetPosition(fStepper.GetPosition(index));
+  track->SetMomentumDirection(fStepper.GetMomentum(index).unit());
+  track->SetGlobalTime(track->GetGlobalTime() + deltaTime);
+  track->SetLocalTime(track->GetLocalTime() + deltaTime);
+  track->SetProperTime(track->GetProperTime() + deltaTime * properTimeRatio);
+  track->AddTrackLength(length);
+}
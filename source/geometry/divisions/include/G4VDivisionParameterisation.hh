@@ -66,6 +66,7 @@ class G4VDivisionParameterisation : public G4VPVParameterisation
     inline G4int GetNoDiv() const;
     inline G4double GetWidth() const;
     inline G4double GetOffset() const;
+    inline DivisionType GetDivisionType() const;
     inline G4VSolid* GetMotherSolid() const;
     inline void SetType(const G4String& type);
     inline G4int VolumeFirstCopyNo() const;
@@ -38,6 +38,8 @@
 
 #include "G4FieldTrack.hh"
 
+class G4TrialsCounter;
+
 class G4DriverReporter 
 {
   public:
@@ -60,6 +62,11 @@ class G4DriverReporter
                               G4int subStepNo,
                               G4double subStepSize,
                               G4double dotVelocities);
+
+    static void PrintCounts(const G4TrialsCounter& counter,
+                            G4bool withMaximum, G4int width = 12);
+      // Prints, without end of line, the total number of trials of
+      // 'counter' and, if requested, the maximum number in one call.
   
   private: 
     // G4int          fVerboseLevel;      // Verbose output for debugging
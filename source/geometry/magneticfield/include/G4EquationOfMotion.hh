@@ -39,6 +39,7 @@
 #include "G4Field.hh"   // required in inline method implementations
 
 #include "G4ChargeState.hh"
+#include "G4FieldStatistics.hh"
 
 class G4EquationOfMotion 
 {
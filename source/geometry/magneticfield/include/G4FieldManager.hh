@@ -127,6 +127,16 @@ class G4FieldManager
       // Set, get and check the field object
 
     void CreateChordFinder(G4MagneticField* detectorMagField);
+    void CreateChordFinder(G4MagneticField* detectorMagField,
+                           G4int stepperDriverId);
+      // Creates a chord finder with the default type of stepper and driver,
+      // or with that identified by 'stepperDriverId' (see G4ChordFinder).
+    void SetOwnedChordFinder(G4ChordFinder* aChordFinder,
+                             G4ChordFinder* (*creator)(G4Field*, G4double),
+                             G4double stepMinimum);
+      // Sets a chord finder which is deleted by this manager; 'creator'
+      // builds an equivalent one for the cloned field in Clone(). Used by
+      // G4TMagFieldChordFinder::CreateFor().
     inline void SetChordFinder(G4ChordFinder* aChordFinder);
     inline G4ChordFinder* GetChordFinder();
     inline const G4ChordFinder* GetChordFinder() const;
@@ -208,6 +218,11 @@ class G4FieldManager
 
     G4bool fAllocatedChordFinder = false; // Did we used "new" to
                                           // create fChordFinder ?
+    G4ChordFinder* (*fChordFinderCreator)(G4Field*, G4double) = nullptr;
+    G4double fChordFinderStepMinimum = 0.0;
+    G4int fChordFinderDriverId = 0;
+      // Creator of the templated chord finder, if any, or type of the
+      // chord finder created, and its parameter, used for clones
     // INVARIANTS of tracking  ---------------------------------------
     // 
     //  1. 'CONSTANTS' - default values for accuracy parameters
@@ -0,0 +1,143 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4FieldStatistics
+//
+// Class description:
+//
+// Instrumentation of the propagation in field, accumulating per logical
+// volume and particle type the number of integration steps, of field
+// evaluations, of iterations for finding chords and for locating
+// intersections, and of looping tracks killed. When activated, the
+// counts are collected by G4PropagatorInField, the equations of motion,
+// the integration drivers, G4ChordFinderDelegate, G4MultiLevelLocator and
+// the transportation processes, which set the current volume and particle.
+//
+// Each counter is a G4TrialsCounter, so that for the iterations of chord
+// finding and intersection location the maximum number in one call is
+// also kept. Each thread counts in its own instance, owned by a
+// G4ThreadLocalSingleton; at the end of a run the counts are merged into
+// the totals, which are reported by the master through G4DriverReporter.
+// Totals accumulate over runs until reset. Controlled through the
+// commands in /geometry/field/.
+
+// 19.10.2026: Initial version.
+// -------------------------------------------------------------------
+#ifndef G4FIELDSTATISTICS_HH
+#define G4FIELDSTATISTICS_HH
+
+#include <map>
+#include <utility>
+
+#include "G4Types.hh"
+#include "G4String.hh"
+#include "G4TrialsCounter.hh"
+#include "G4ThreadLocalSingleton.hh"
+
+class G4FieldStatistics
+{
+  friend class G4ThreadLocalSingleton<G4FieldStatistics>;
+
+  public:
+
+    enum ECounter { kIntegrationSteps = 0, kFieldEvaluations,
+                    kChordIterations, kLocatorIterations, kLoopingKills,
+                    kNumberOfCounters };
+
+    static G4FieldStatistics* GetInstance();
+      // Returns the instance of the current thread.
+
+    static inline void SetActive(G4bool value);
+    static inline G4bool IsActive();
+      // Activate/deactivate counting; inactive by default.
+
+    static inline void Count(ECounter counter, G4long n = 1);
+      // Adds 'n' to 'counter' for the current volume and particle,
+      // if active.
+
+    void SetCurrentVolume(const G4String& name);
+    void SetCurrentParticle(const G4String& name);
+      // Set the volume and particle type counts are attributed to.
+
+    void Merge();
+      // Adds the counts of this thread to the totals and clears them.
+
+    static void PrintTotals();
+    static void ResetTotals();
+      // Print or reset the totals.
+
+  private:
+
+    struct Counters
+    {
+      G4TrialsCounter fValue[kNumberOfCounters] =
+        { { "IntegrationSteps", "integration steps" },
+          { "FieldEvaluations", "field evaluations" },
+          { "ChordIterations", "iterations to find a chord" },
+          { "LocatorIterations", "iterations to locate an intersection" },
+          { "LoopingKills", "looping tracks killed" } };
+    };
+    using Key = std::pair<G4String, G4String>;
+      // Volume and particle names
+    using Table = std::map<Key, Counters>;
+
+    G4FieldStatistics() = default;
+
+    void SelectCounters();
+    static Table& Totals();
+
+  private:
+
+    Table fCounters;
+    Counters* fCurrent = nullptr;
+    G4String fVolume = "unknown";
+    G4String fParticle = "unknown";
+
+    static G4bool fActive;
+};
+
+// Inline methods
+
+inline void G4FieldStatistics::SetActive(G4bool value)
+{
+  fActive = value;
+}
+
+inline G4bool G4FieldStatistics::IsActive()
+{
+  return fActive;
+}
+
+inline void G4FieldStatistics::Count(ECounter counter, G4long n)
+{
+  if (fActive)
+  {
+    G4FieldStatistics* self = GetInstance();
+    if (self->fCurrent == nullptr) { self->SelectCounters(); }
+    self->fCurrent->fValue[counter].AccumulateCounts((G4int)n);
+  }
+}
+
+#endif
@@ -0,0 +1,142 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4MagFieldBatchStepper
+//
+// Class description:
+//
+// Dormand-Prince 5(4) integration of the motion of several charged
+// particles in the same magnetic field, advanced together. The state of
+// the tracks is held in structure-of-arrays layout, each component of
+// position and momentum in its own array, so that the stages of the
+// Runge-Kutta step are computed by loops over the tracks which the
+// compiler vectorises; the field is evaluated at the points of all the
+// tracks with one call to G4MagneticField::GetFieldValues().
+//
+// Each call to Step() makes one trial step per track, of a length
+// limited by the value given for it, with its own error control: the
+// step is accepted or rejected, and the length of the next trial step
+// is adapted, independently for each track. The derivative at the end
+// of an accepted step is reused at the start of the next one.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4MAGFIELDBATCHSTEPPER_HH
+#define G4MAGFIELDBATCHSTEPPER_HH 1
+
+#include "G4Types.hh"
+#include "G4ThreeVector.hh"
+
+#include <vector>
+
+class G4MagneticField;
+
+class G4MagFieldBatchStepper
+{
+  public:
+
+    explicit G4MagFieldBatchStepper(const G4MagneticField* field = nullptr);
+    ~G4MagFieldBatchStepper() = default;
+
+    void SetField(const G4MagneticField* field);
+    inline const G4MagneticField* GetField() const;
+      // The field in which the tracks move; null for no field.
+
+    void SetAccuracy(G4double deltaOneStep, G4double epsMin, G4double epsMax);
+      // The relative accuracy required for a step of length 'h' is
+      // deltaOneStep/h, limited to the range [epsMin, epsMax], as done
+      // by G4PropagatorInField.
+
+    std::size_t AddTrack(const G4ThreeVector& position,
+                         const G4ThreeVector& momentum,
+                         G4double charge, G4double time = 0.0);
+      // Adds a track of given charge, in units of eplus, and returns
+      // its index.
+
+    void RemoveTrack(std::size_t index);
+      // Removes a track, replacing it by the last one: the index of
+      // the last track becomes 'index'.
+
+    void Clear();
+    inline std::size_t GetNumberOfTracks() const;
+
+    G4ThreeVector GetPosition(std::size_t index) const;
+    G4ThreeVector GetMomentum(std::size_t index) const;
+
+    void Step(const G4double hMax[], G4double hDone[]);
+      // Makes one trial step for each track, not longer than hMax[i]
+      // nor than the length proposed by the error control. hDone[i] is
+      // the length of the step accepted, zero if it was rejected.
+
+  private:
+
+    void Derivatives(const std::vector<G4double>* y, std::vector<G4double>* dydx);
+    void Resize(std::size_t n);
+
+  private:
+
+    static constexpr G4int kStages = 7;
+
+    const G4MagneticField* fField = nullptr;
+    G4double fDeltaOneStep;
+    G4double fEpsMin;
+    G4double fEpsMax;
+
+    // State of the tracks: position, momentum, charge coefficient,
+    // time, length of the next trial step, by component
+    //
+    std::vector<G4double> fY[6];
+    std::vector<G4double> fCof;
+    std::vector<G4double> fTime;
+    std::vector<G4double> fTrialStep;
+    std::size_t fNumberOfTracks = 0;
+
+    // Work space: derivatives at the stages, the first being valid at
+    // the current state when fDerivativeValid is set
+    //
+    std::vector<G4double> fK[kStages][6];
+    std::vector<G4double> fYTemp[6];
+    std::vector<G4double> fYOut[6];
+    std::vector<G4double> fStep;
+    std::vector<G4double> fPoints;
+    std::vector<G4double> fFields;
+    G4bool fDerivativeValid = false;
+};
+
+// --------------------------------------------------------------------
+// Inline methods
+// --------------------------------------------------------------------
+
+inline const G4MagneticField* G4MagFieldBatchStepper::GetField() const
+{
+  return fField;
+}
+
+inline std::size_t G4MagFieldBatchStepper::GetNumberOfTracks() const
+{
+  return fNumberOfTracks;
+}
+
+#endif
@@ -54,6 +54,14 @@ class G4MagneticField : public G4Field
 
     void GetFieldValue( const G4double Point[4],
                               G4double* Bfield ) const override = 0;
+
+    virtual void GetFieldValues( G4int nPoints,
+                                 const G4double Points[][4],
+                                       G4double Bfields[][3] ) const;
+      // Evaluates the field at 'nPoints' position-time vectors at once,
+      // for example the stage points of a stepper. The default calls
+      // GetFieldValue() for each point; fields able to share work between
+      // points (e.g. field maps) should override it.
 };
 
 #endif
@@ -0,0 +1,185 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4MagneticFieldMap
+//
+// Class description:
+//
+// Magnetic field defined by its values on the nodes of a regular grid,
+// either cartesian (x, y, z) or cylindrical (r, phi, z). For cylindrical
+// grids the field components are given in the local (Br, Bphi, Bz)
+// basis. An axis with a single node describes a field invariant along
+// it, e.g. a cylindrical grid with one node in phi an axially symmetric
+// field. The value at a point is obtained by trilinear interpolation
+// or, optionally, by tricubic (Catmull-Rom) interpolation; outside of
+// the grid the field is zero.
+//
+// Only a part of the field may be tabulated, the rest being obtained by
+// symmetry: reflection in the planes x=0, y=0 or z=0 of the map frame,
+// with a sign applied to each field component, and, for cylindrical
+// grids, periodicity in phi.
+//
+// The nodes are stored in blocks of 4x4x4, each node holding the three
+// components in single precision padded to four values, so that the
+// neighbours used for one interpolation share few cache lines and are
+// combined with vector operations. Several points, e.g. the stages of a
+// Runge-Kutta step, can be evaluated in one call with GetFieldValues().
+//
+// Maps are saved to, and loaded from, a binary file holding this layout
+// directly, which is mapped in memory where supported. The file can also
+// be created from a text table of "x y z Bx By Bz" (or "r phi z Br Bphi
+// Bz") rows with ConvertTextFile(), which accepts most common formats,
+// e.g. the tables exported by Opera: lines not starting with six numbers
+// are ignored, and the rows may come in any order. The data of a map are
+// shared, not copied, by its clones.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4MAGNETICFIELDMAP_HH
+#define G4MAGNETICFIELDMAP_HH
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <CLHEP/Units/SystemOfUnits.h>
+
+#include "G4Types.hh"
+#include "G4String.hh"
+#include "G4ThreeVector.hh"
+#include "G4MagneticField.hh"
+#include "geomdefs.hh"
+
+class G4MagneticFieldMap : public G4MagneticField
+{
+  public:
+
+    enum EGrid { kCartesian, kCylindrical };
+    enum EInterpolation { kLinear, kCubic };
+
+    G4MagneticFieldMap(EGrid grid, const G4int nodes[3],
+                       const G4double minimum[3], const G4double maximum[3],
+                       const std::vector<G4double>& values);
+      // Constructs the map from the values of the three components at
+      // each node, in internal units, the third coordinate varying the
+      // fastest. 'minimum' and 'maximum' are the coordinates of the first
+      // and last nodes along each axis.
+
+    explicit G4MagneticFieldMap(const G4String& filename);
+      // Loads the map from a binary file, written by Write() or by
+      // ConvertTextFile().
+
+    ~G4MagneticFieldMap() override;
+
+    G4MagneticFieldMap(const G4MagneticFieldMap& r);
+    G4MagneticFieldMap& operator = (const G4MagneticFieldMap&) = delete;
+      // Copies share the data of the map.
+
+    void GetFieldValue( const G4double Point[4],
+                              G4double* Bfield ) const override;
+
+    void GetFieldValues( G4int nPoints,
+                         const G4double Points[][4],
+                               G4double Bfields[][3] ) const override;
+
+    G4Field* Clone() const override;
+
+    inline void SetInterpolation(EInterpolation value);
+    inline EInterpolation GetInterpolation() const;
+
+    inline void SetOrigin(const G4ThreeVector& origin);
+    inline const G4ThreeVector& GetOrigin() const;
+      // Position of the origin of the map frame in the global frame.
+
+    inline void SetScale(G4double factor);
+    inline G4double GetScale() const;
+      // Factor applied to the tabulated values, e.g. to follow the
+      // current of the magnet.
+
+    void SetReflection(EAxis axis, G4int signX, G4int signY, G4int signZ);
+      // Declares the field as symmetric by reflection in the plane normal
+      // to 'axis' (kXAxis, kYAxis or kZAxis; kZAxis only for cylindrical
+      // grids). The map then covers only the positive side of the plane;
+      // on the negative side the components (x,y,z), or (r,phi,z), of the
+      // field at the reflected point are multiplied by the given signs.
+
+    void SetPhiPeriod(G4double period);
+      // Declares the field of a cylindrical grid as periodic in phi, the
+      // map covering one period starting from its minimum phi.
+
+    G4bool Write(const G4String& filename) const;
+      // Saves the map to a binary file. Returns false in case of failure.
+
+    static G4bool ConvertTextFile(const G4String& textFile,
+                                  const G4String& binaryFile,
+                                  EGrid grid = kCartesian,
+                                  G4double lengthUnit = CLHEP::mm,
+                                  G4double fieldUnit = CLHEP::tesla,
+                                  G4double angleUnit = CLHEP::deg);
+      // Reads a text table of field values, in the given units, and
+      // writes it as a binary map. Returns false if the rows do not form
+      // a complete regular grid or if the files cannot be accessed.
+
+    inline EGrid GetGrid() const;
+    inline G4int GetNumberOfNodes(G4int axis) const;
+    inline G4double GetMinimum(G4int axis) const;
+    inline G4double GetMaximum(G4int axis) const;
+
+  private:
+
+    struct Storage;
+
+    void Initialise();
+    std::size_t Offset(G4int axis, G4int index) const;
+    G4bool FoldPoint(const G4double point[4], G4double local[3],
+                     G4double sign[3], G4double& cosPhi,
+                     G4double& sinPhi) const;
+    void Interpolate(const G4double local[3], G4double value[3]) const;
+
+  private:
+
+    std::shared_ptr<const Storage> fStorage;
+    const G4float* fData = nullptr;
+      // Node values, in blocks, shared between copies
+
+    EGrid fGrid = kCartesian;
+    G4int fNodes[3] = { 0, 0, 0 };
+    G4double fMinimum[3] = { 0., 0., 0. };
+    G4double fMaximum[3] = { 0., 0., 0. };
+    G4double fInvSpacing[3] = { 0., 0., 0. };
+    std::size_t fBlockStride[3] = { 0, 0, 0 };
+      // Distance between consecutive blocks along each axis, in values
+
+    EInterpolation fInterpolation = kLinear;
+    G4ThreeVector fOrigin;
+    G4double fScale = 1.0;
+    G4bool fReflect[3] = { false, false, false };
+    G4double fReflectSign[3][3] = { { 1., 1., 1. }, { 1., 1., 1. },
+                                    { 1., 1., 1. } };
+    G4double fPhiPeriod = 0.0;
+};
+
+#include "G4MagneticFieldMap.icc"
+
+#endif
@@ -0,0 +1,113 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4TMagFieldChordFinder
+//
+// Class description:
+//
+// Chord finder for a magnetic field of concrete type T_Field, owning an
+// integration chain instantiated for it: the templated equation of motion
+// G4TMagFieldEquation<T_Field>, a templated stepper (by default the
+// Dormand-Prince 4/5 G4TDormandPrince45) and the templated driver
+// G4IntegrationDriver, which also finds the chords. The only virtual call
+// left is the one from the chord finder to the driver, once per chord;
+// all the stages of a Runge-Kutta step, including the field evaluations,
+// are compiled together and can be inlined and vectorised.
+//
+// The equation is bound to the field object given at construction.
+// Usually created through CreateFor(), which sets it in a field manager;
+// this header is to be included explicitly where doing so.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4TMAGFIELDCHORDFINDER_HH
+#define G4TMAGFIELDCHORDFINDER_HH
+
+#include <memory>
+#include <CLHEP/Units/SystemOfUnits.h>
+
+#include "G4ChordFinder.hh"
+#include "G4FieldManager.hh"
+#include "G4TMagFieldEquation.hh"
+#include "G4TDormandPrince45.hh"
+#include "G4IntegrationDriver.hh"
+
+template <class T_Field,
+          template <class, unsigned int> class T_Stepper = G4TDormandPrince45>
+class G4TMagFieldChordFinder : public G4ChordFinder
+{
+  public:
+
+    using Equation = G4TMagFieldEquation<T_Field>;
+    using Stepper = T_Stepper<Equation, 6>;
+    using Driver = G4IntegrationDriver<Stepper>;
+
+    G4TMagFieldChordFinder(T_Field* field,
+                           G4double stepMinimum = 1.0e-2 * CLHEP::mm)
+      : G4ChordFinder(static_cast<G4VIntegrationDriver*>(nullptr)),
+        fFieldEquation(new Equation(field)),
+        fFieldStepper(new Stepper(fFieldEquation.get()))
+    {
+      SetIntegrationDriver(new Driver(stepMinimum, fFieldStepper.get(), 6));
+    }
+
+    ~G4TMagFieldChordFinder() override = default;
+      // The driver, deleted by G4ChordFinder, does not use the stepper
+      // when destroyed
+
+    G4TMagFieldChordFinder(const G4TMagFieldChordFinder&) = delete;
+    G4TMagFieldChordFinder& operator=(const G4TMagFieldChordFinder&) = delete;
+
+    static G4ChordFinder* CreateForField(G4Field* field, G4double stepMinimum)
+    {
+      // Creates a chord finder for 'field' if it is of type T_Field,
+      // e.g. for the clone of a field manager
+      //
+      auto typedField = dynamic_cast<T_Field*>(field);
+      return (typedField != nullptr)
+           ? new G4TMagFieldChordFinder(typedField, stepMinimum) : nullptr;
+    }
+
+    static G4TMagFieldChordFinder* CreateFor(G4FieldManager* fieldManager,
+                                             T_Field* field,
+                                             G4double stepMinimum
+                                               = 1.0e-2 * CLHEP::mm)
+    {
+      // Creates a chord finder for 'field' and sets it in 'fieldManager',
+      // which deletes it and creates one for the cloned field in clones
+      //
+      auto chordFinder = new G4TMagFieldChordFinder(field, stepMinimum);
+      fieldManager->SetOwnedChordFinder(chordFinder, &CreateForField,
+                                        stepMinimum);
+      return chordFinder;
+    }
+
+  private:
+
+    std::unique_ptr<Equation> fFieldEquation;
+    std::unique_ptr<Stepper> fFieldStepper;
+};
+
+#endif
@@ -56,6 +56,7 @@ class G4TMagFieldEquation : public G4Mag_UsualEqRhs
     inline void GetFieldValue(const G4double Point[4],
                               G4double Field[]) const
     {
+      G4FieldStatistics::Count(G4FieldStatistics::kFieldEvaluations);
       itsField->T_Field::GetFieldValue(Point, Field);
     }
 
@@ -48,17 +48,20 @@ class  G4TrialsCounter
 
     inline void AccumulateCounts( G4int noTrials ); 
        //  Add this number to stats
+    void AccumulateCounts( const G4TrialsCounter& other );
+       //  Add the stats of another counter, e.g. of a worker thread
     void ClearCounts(); 
        //  Reset all counts
-    G4int ReturnTotals( G4int& calls, G4int& maxTrials, G4int& numMaxT ) ; 
+    G4long ReturnTotals( G4long& calls, G4int& maxTrials,
+                         G4int& numMaxT ) const; 
        //  Return number of count/trials, calls, max & no-max
 
     void PrintStatistics(); 
 
   private:
 
-    G4int fTotalNoTrials = 0;    //  Counts sum of trials 
-    G4int fNumberCalls = 0;      //  Total # of calls to accumulate
+    G4long fTotalNoTrials = 0;   //  Counts sum of trials 
+    G4long fNumberCalls = 0;     //  Total # of calls to accumulate
     G4int fmaxTrials = 0;        // Max value of trials
     G4int fNoTimesMaxTrials = 0; // How many times maximum is reached
 
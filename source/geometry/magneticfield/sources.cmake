@@ -45,6 +45,7 @@ geant4_add_module(G4magneticfield
     G4FieldManager.hh
     G4FieldManager.icc
     G4FieldManagerStore.hh
+    G4FieldStatistics.hh
     G4FieldTrack.hh
     G4FieldTrack.icc
     G4FieldUtils.hh
@@ -69,6 +70,7 @@ geant4_add_module(G4magneticfield
     G4LineCurrentMagField.hh
     G4LineSection.hh
     G4MagErrorStepper.hh
+    G4MagFieldBatchStepper.hh
     G4MagErrorStepper.icc
     G4MagHelicalStepper.hh
     G4MagHelicalStepper.icc
@@ -83,6 +85,8 @@ geant4_add_module(G4magneticfield
     G4ModifiedMidpoint.icc
     G4MonopoleEq.hh
     G4MagneticField.hh
+    G4MagneticFieldMap.hh
+    G4MagneticFieldMap.icc
     G4NystromRK4.hh
     G4NystromRK4.icc
     G4OldMagIntDriver.hh
@@ -104,6 +108,7 @@ geant4_add_module(G4magneticfield
     G4TCashKarpRKF45.hh
     G4TClassicalRK4.hh
     G4TDormandPrince45.hh
+    G4TMagFieldChordFinder.hh
     G4TMagFieldEquation.hh
     G4TMagErrorStepper.hh
     G4TQuadrupoleMagField.hh
@@ -158,6 +163,7 @@ geant4_add_module(G4magneticfield
     G4Field.cc
     G4FieldManager.cc
     G4FieldManagerStore.cc
+    G4FieldStatistics.cc
     G4FieldTrack.cc
     G4FieldUtils.cc
     G4FSALBogackiShampine45.cc
@@ -173,6 +179,7 @@ geant4_add_module(G4magneticfield
     G4LineCurrentMagField.cc
     G4LineSection.cc
     G4MagErrorStepper.cc
+    G4MagFieldBatchStepper.cc
     G4MagHelicalStepper.cc
     G4MagIntegratorDriver.cc
     G4MagIntegratorStepper.cc
@@ -180,6 +187,7 @@ geant4_add_module(G4magneticfield
     G4Mag_SpinEqRhs.cc
     G4Mag_UsualEqRhs.cc
     G4MagneticField.cc
+    G4MagneticFieldMap.cc
     G4ModifiedMidpoint.cc
     G4MonopoleEq.cc
     G4NystromRK4.cc
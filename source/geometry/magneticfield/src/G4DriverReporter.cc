@@ -32,6 +32,7 @@
 // -------------------------------------------------------------------
 
 #include "G4DriverReporter.hh"
+#include "G4TrialsCounter.hh"
 
 // ---------------------------------------------------------------------------
 
@@ -200,3 +201,19 @@ void G4DriverReporter::PrintStat_Aux(const G4FieldTrack& aFieldTrack,
     }
     G4cout << G4endl;
 }
+
+// ---------------------------------------------------------------------------
+
+void G4DriverReporter::PrintCounts( const G4TrialsCounter& counter,
+                                    G4bool withMaximum, G4int width )
+{
+    G4long calls = 0;
+    G4int maxTrials = 0, numMaxT = 0;
+    G4long totalTrials = counter.ReturnTotals(calls, maxTrials, numMaxT);
+
+    G4cout << " " << std::setw(width) << totalTrials;
+    if( withMaximum )
+    {
+      G4cout << " " << std::setw(width) << maxTrials;
+    }
+}
@@ -112,9 +112,18 @@ G4FieldManager* G4FieldManager::Clone() const
         // Check if originally we have the fAllocatedChordFinder variable
         // set, in case, call chord constructor
         //
-        if ( fAllocatedChordFinder )
+        if ( fChordFinderCreator != nullptr )
         {
-            aFM->CreateChordFinder( dynamic_cast<G4MagneticField*>(aField) );
+            aFM->fChordFinder = fChordFinderCreator(aField,
+                                                    fChordFinderStepMinimum);
+            aFM->fAllocatedChordFinder = (aFM->fChordFinder != nullptr);
+            aFM->fChordFinderCreator = fChordFinderCreator;
+            aFM->fChordFinderStepMinimum = fChordFinderStepMinimum;
+        }
+        else if ( fAllocatedChordFinder )
+        {
+            aFM->CreateChordFinder( dynamic_cast<G4MagneticField*>(aField),
+                                    fChordFinderDriverId );
         }
         else
         {
@@ -164,18 +173,27 @@ G4FieldManager::~G4FieldManager()
    G4FieldManagerStore::DeRegister(this);
 }
 
+void G4FieldManager::CreateChordFinder(G4MagneticField* detectorMagField)
+{
+   CreateChordFinder(detectorMagField, G4ChordFinder::kTemplatedStepperType);
+}
+
 void
-G4FieldManager::CreateChordFinder(G4MagneticField* detectorMagField)
+G4FieldManager::CreateChordFinder(G4MagneticField* detectorMagField,
+                                  G4int stepperDriverId)
 {
    if ( fAllocatedChordFinder )
    { 
       delete fChordFinder;
    }
    fAllocatedChordFinder = false;
+   fChordFinderCreator = nullptr;
+   fChordFinderDriverId = stepperDriverId;
 
    if( detectorMagField != nullptr )
    {
-      fChordFinder = new G4ChordFinder( detectorMagField );
+      fChordFinder = new G4ChordFinder( detectorMagField, 1.0e-2 * mm,
+                                        nullptr, stepperDriverId );
       fAllocatedChordFinder = true;
    }
    else
@@ -184,6 +202,22 @@ G4FieldManager::CreateChordFinder(G4MagneticField* detectorMagField)
    }
 }
 
+void
+G4FieldManager::SetOwnedChordFinder(G4ChordFinder* aChordFinder,
+                                    G4ChordFinder* (*creator)(G4Field*,
+                                                              G4double),
+                                    G4double stepMinimum)
+{
+   if ( fAllocatedChordFinder && fChordFinder != aChordFinder )
+   {
+      delete fChordFinder;
+   }
+   fChordFinder = aChordFinder;
+   fAllocatedChordFinder = (aChordFinder != nullptr);
+   fChordFinderCreator = creator;
+   fChordFinderStepMinimum = stepMinimum;
+}
+
 void G4FieldManager::InitialiseFieldChangesEnergy()
 {
    if ( fDetectorField != nullptr )
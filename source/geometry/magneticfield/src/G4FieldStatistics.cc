@@ -0,0 +1,187 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4FieldStatistics implementation
+//
+// 19.10.2026: Initial version.
+// -------------------------------------------------------------------
+
+#include "G4FieldStatistics.hh"
+#include "G4DriverReporter.hh"
+#include "G4AutoLock.hh"
+#include "G4ios.hh"
+
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+namespace
+{
+  G4Mutex totalsMutex = G4MUTEX_INITIALIZER;
+}
+
+G4bool G4FieldStatistics::fActive = false;
+
+// -------------------------------------------------------------------
+
+G4FieldStatistics* G4FieldStatistics::GetInstance()
+{
+  static G4ThreadLocalSingleton<G4FieldStatistics> instance;
+  return instance.Instance();
+}
+
+// -------------------------------------------------------------------
+
+G4FieldStatistics::Table& G4FieldStatistics::Totals()
+{
+  static Table totals;
+  return totals;
+}
+
+// -------------------------------------------------------------------
+
+void G4FieldStatistics::SetCurrentVolume(const G4String& name)
+{
+  if (name != fVolume)
+  {
+    fVolume = name;
+    fCurrent = nullptr;
+  }
+}
+
+// -------------------------------------------------------------------
+
+void G4FieldStatistics::SetCurrentParticle(const G4String& name)
+{
+  if (name != fParticle)
+  {
+    fParticle = name;
+    fCurrent = nullptr;
+  }
+}
+
+// -------------------------------------------------------------------
+
+void G4FieldStatistics::SelectCounters()
+{
+  fCurrent = &fCounters[Key(fVolume, fParticle)];
+}
+
+// -------------------------------------------------------------------
+
+void G4FieldStatistics::Merge()
+{
+  if (fCounters.empty()) { return; }
+
+  G4AutoLock lock(&totalsMutex);
+  Table& totals = Totals();
+  for (const auto& entry : fCounters)
+  {
+    Counters& total = totals[entry.first];
+    for (G4int i = 0; i < kNumberOfCounters; ++i)
+    {
+      total.fValue[i].AccumulateCounts(entry.second.fValue[i]);
+    }
+  }
+  fCounters.clear();
+  fCurrent = nullptr;
+}
+
+// -------------------------------------------------------------------
+
+void G4FieldStatistics::ResetTotals()
+{
+  G4AutoLock lock(&totalsMutex);
+  Totals().clear();
+}
+
+// -------------------------------------------------------------------
+
+void G4FieldStatistics::PrintTotals()
+{
+  G4AutoLock lock(&totalsMutex);
+  const Table& totals = Totals();
+
+  // Most expensive entries, by number of field evaluations, first
+  //
+  std::vector<Table::const_iterator> entries;
+  Counters sum;
+  for (auto it = totals.cbegin(); it != totals.cend(); ++it)
+  {
+    entries.push_back(it);
+    for (G4int i = 0; i < kNumberOfCounters; ++i)
+    {
+      sum.fValue[i].AccumulateCounts(it->second.fValue[i]);
+    }
+  }
+  auto evaluations = [](const Counters& counters)
+  {
+    G4long calls = 0;
+    G4int maxTrials = 0, numMaxT = 0;
+    return counters.fValue[kFieldEvaluations]
+                   .ReturnTotals(calls, maxTrials, numMaxT);
+  };
+  std::sort(entries.begin(), entries.end(),
+            [&evaluations](Table::const_iterator a, Table::const_iterator b)
+            {
+              return evaluations(a->second) > evaluations(b->second);
+            });
+
+  auto printLine = [](const G4String& volume, const G4String& particle,
+                      const Counters& counters)
+  {
+    G4cout << " " << std::setw(24) << std::left << volume
+           << " " << std::setw(14) << particle << std::right;
+    for (G4int i = 0; i < kNumberOfCounters; ++i)
+    {
+      // Maximum per call only meaningful for the iterations
+      //
+      G4bool withMaximum = (i == kChordIterations
+                         || i == kLocatorIterations);
+      G4DriverReporter::PrintCounts(counters.fValue[i], withMaximum);
+    }
+    G4cout << G4endl;
+  };
+
+  G4cout << G4endl
+         << " ================================================"
+         << " Field propagation statistics "
+         << "================================================" << G4endl
+         << " " << std::setw(24) << std::left << "Volume"
+         << " " << std::setw(14) << "Particle" << std::right
+         << " " << std::setw(12) << "Int. steps"
+         << " " << std::setw(12) << "Field evals"
+         << " " << std::setw(12) << "Chord iters"
+         << " " << std::setw(12) << "max"
+         << " " << std::setw(12) << "Locator its"
+         << " " << std::setw(12) << "max"
+         << " " << std::setw(12) << "Loop. kills" << G4endl;
+  for (const auto& entry : entries)
+  {
+    printLine(entry->first.first, entry->first.second, entry->second);
+  }
+  printLine("Total", "", sum);
+  G4cout << " " << G4String(130, '=') << G4endl;
+}
@@ -0,0 +1,292 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4MagFieldBatchStepper implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include "G4MagFieldBatchStepper.hh"
+#include "G4MagneticField.hh"
+#include "G4FieldStatistics.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+  // Butcher tableau of the Dormand-Prince 5(4) method; the last stage
+  // is evaluated at the fifth order solution, and the error estimate
+  // is the difference between the fifth and fourth order solutions
+  //
+  const G4double a[7][6] = {
+    { 0., 0., 0., 0., 0., 0. },
+    { 1./5., 0., 0., 0., 0., 0. },
+    { 3./40., 9./40., 0., 0., 0., 0. },
+    { 44./45., -56./15., 32./9., 0., 0., 0. },
+    { 19372./6561., -25360./2187., 64448./6561., -212./729., 0., 0. },
+    { 9017./3168., -355./33., 46732./5247., 49./176., -5103./18656., 0. },
+    { 35./384., 0., 500./1113., 125./192., -2187./6784., 11./84. } };
+
+  const G4double e[7] = { 71./57600., 0., -71./16695., 71./1920.,
+                          -17253./339200., 22./525., -1./40. };
+
+  // Step control, as in G4MagInt_Driver
+  //
+  const G4double kSafety = 0.9;
+  const G4double kMaxGrowth = 5.0;
+  const G4double kMaxShrink = 0.1;
+  const G4double kMinimumStep = 1.0e-5 * mm;
+}
+
+// --------------------------------------------------------------------
+G4MagFieldBatchStepper::G4MagFieldBatchStepper(const G4MagneticField* field)
+  : fField(field),
+    fDeltaOneStep(0.01 * mm), fEpsMin(5.0e-5), fEpsMax(1.0e-3)
+{
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::SetField(const G4MagneticField* field)
+{
+  fField = field;
+  fDerivativeValid = false;
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::SetAccuracy(G4double deltaOneStep,
+                                         G4double epsMin, G4double epsMax)
+{
+  fDeltaOneStep = deltaOneStep;
+  fEpsMin = epsMin;
+  fEpsMax = std::max(epsMin, epsMax);
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::Resize(std::size_t n)
+{
+  for(auto& v : fY) { v.resize(n); }
+  fCof.resize(n);
+  fTime.resize(n);
+  fTrialStep.resize(n);
+  for(auto& k : fK)
+  {
+    for(auto& v : k) { v.resize(n); }
+  }
+  for(auto& v : fYTemp) { v.resize(n); }
+  for(auto& v : fYOut) { v.resize(n); }
+  fStep.resize(n);
+  fPoints.resize(4*n);
+  fFields.resize(3*n);
+}
+
+// --------------------------------------------------------------------
+std::size_t G4MagFieldBatchStepper::AddTrack(const G4ThreeVector& position,
+                                             const G4ThreeVector& momentum,
+                                             G4double charge, G4double time)
+{
+  std::size_t i = fNumberOfTracks++;
+  if(fY[0].size() < fNumberOfTracks)
+  {
+    Resize(std::max<std::size_t>(2*i, 16));
+  }
+  for(G4int j = 0; j < 3; ++j)
+  {
+    fY[j][i] = position[j];
+    fY[j+3][i] = momentum[j];
+  }
+  fCof[i] = charge * eplus * c_light;
+  fTime[i] = time;
+  fTrialStep[i] = DBL_MAX;
+  fDerivativeValid = false;
+  return i;
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::RemoveTrack(std::size_t index)
+{
+  std::size_t last = --fNumberOfTracks;
+  if(index == last) { return; }
+  for(G4int j = 0; j < 6; ++j)
+  {
+    fY[j][index] = fY[j][last];
+    fK[0][j][index] = fK[0][j][last];
+  }
+  fCof[index] = fCof[last];
+  fTime[index] = fTime[last];
+  fTrialStep[index] = fTrialStep[last];
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::Clear()
+{
+  fNumberOfTracks = 0;
+  fDerivativeValid = false;
+}
+
+// --------------------------------------------------------------------
+G4ThreeVector G4MagFieldBatchStepper::GetPosition(std::size_t index) const
+{
+  return { fY[0][index], fY[1][index], fY[2][index] };
+}
+
+// --------------------------------------------------------------------
+G4ThreeVector G4MagFieldBatchStepper::GetMomentum(std::size_t index) const
+{
+  return { fY[3][index], fY[4][index], fY[5][index] };
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::Derivatives(const std::vector<G4double>* y,
+                                         std::vector<G4double>* dydx)
+{
+  const std::size_t n = fNumberOfTracks;
+  G4double* B = fFields.data();
+  if(fField != nullptr)
+  {
+    G4double* points = fPoints.data();
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      points[4*i]   = y[0][i];
+      points[4*i+1] = y[1][i];
+      points[4*i+2] = y[2][i];
+      points[4*i+3] = fTime[i];
+    }
+    fField->GetFieldValues((G4int)n,
+                           reinterpret_cast<const G4double(*)[4]>(points),
+                           reinterpret_cast<G4double(*)[3]>(B));
+    G4FieldStatistics::Count(G4FieldStatistics::kFieldEvaluations, (G4long)n);
+  }
+  else
+  {
+    std::fill(fFields.begin(), fFields.begin() + 3*n, 0.0);
+  }
+
+  const G4double* px = y[3].data();
+  const G4double* py = y[4].data();
+  const G4double* pz = y[5].data();
+  const G4double* cof = fCof.data();
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    G4double invP = 1.0 / std::sqrt(px[i]*px[i] + py[i]*py[i] + pz[i]*pz[i]);
+    G4double c = cof[i] * invP;
+    dydx[0][i] = px[i] * invP;
+    dydx[1][i] = py[i] * invP;
+    dydx[2][i] = pz[i] * invP;
+    dydx[3][i] = c * (py[i]*B[3*i+2] - pz[i]*B[3*i+1]);
+    dydx[4][i] = c * (pz[i]*B[3*i]   - px[i]*B[3*i+2]);
+    dydx[5][i] = c * (px[i]*B[3*i+1] - py[i]*B[3*i]);
+  }
+}
+
+// --------------------------------------------------------------------
+void G4MagFieldBatchStepper::Step(const G4double hMax[], G4double hDone[])
+{
+  const std::size_t n = fNumberOfTracks;
+  if(n == 0) { return; }
+
+  if(!fDerivativeValid)
+  {
+    Derivatives(fY, fK[0]);
+    fDerivativeValid = true;
+  }
+
+  G4double* h = fStep.data();
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    h[i] = std::min(fTrialStep[i], hMax[i]);
+  }
+
+  // Stages 2 to 7; the last one is the derivative at the new state
+  //
+  for(G4int stage = 1; stage < kStages; ++stage)
+  {
+    std::vector<G4double>* yStage = (stage < kStages-1) ? fYTemp : fYOut;
+    for(G4int j = 0; j < 6; ++j)
+    {
+      const G4double* y = fY[j].data();
+      G4double* out = yStage[j].data();
+      for(std::size_t i = 0; i < n; ++i)
+      {
+        G4double sum = 0.0;
+        for(G4int r = 0; r < stage; ++r)
+        {
+          sum += a[stage][r] * fK[r][j][i];
+        }
+        out[i] = y[i] + h[i] * sum;
+      }
+    }
+    Derivatives(yStage, fK[stage]);
+  }
+  G4FieldStatistics::Count(G4FieldStatistics::kIntegrationSteps, (G4long)n);
+
+  // Error control, on position relative to the step length and on
+  // momentum relative to its magnitude
+  //
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    G4double err[6];
+    for(G4int j = 0; j < 6; ++j)
+    {
+      G4double sum = 0.0;
+      for(G4int stage = 0; stage < kStages; ++stage)
+      {
+        sum += e[stage] * fK[stage][j][i];
+      }
+      err[j] = h[i] * sum;
+    }
+    G4double eps = std::min(std::max(fDeltaOneStep / hMax[i], fEpsMin),
+                            fEpsMax);
+    G4double p2 = fY[3][i]*fY[3][i] + fY[4][i]*fY[4][i] + fY[5][i]*fY[5][i];
+    G4double errPos2 = (err[0]*err[0] + err[1]*err[1] + err[2]*err[2])
+                     / (eps*eps * h[i]*h[i]);
+    G4double errMom2 = (err[3]*err[3] + err[4]*err[4] + err[5]*err[5])
+                     / (eps*eps * p2);
+    G4double errMax2 = std::max(errPos2, errMom2);
+
+    if(errMax2 <= 1.0 || h[i] <= kMinimumStep)
+    {
+      hDone[i] = h[i];
+      for(G4int j = 0; j < 6; ++j)
+      {
+        fY[j][i] = fYOut[j][i];
+        fK[0][j][i] = fK[kStages-1][j][i];
+      }
+      G4double growth = (errMax2 > 0.0)
+                      ? kSafety * std::pow(errMax2, -0.1) : kMaxGrowth;
+      fTrialStep[i] = h[i] * std::min(growth, kMaxGrowth);
+    }
+    else
+    {
+      hDone[i] = 0.0;
+      G4double shrink = kSafety * std::pow(errMax2, -0.125);
+      fTrialStep[i] = std::max(h[i] * std::max(shrink, kMaxShrink),
+                               kMinimumStep);
+    }
+  }
+}
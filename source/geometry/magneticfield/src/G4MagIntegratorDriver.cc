@@ -40,6 +40,7 @@
 
 #ifdef   G4DEBUG_FIELD
 #include "G4DriverReporter.hh"
+#include "G4FieldStatistics.hh"
 #endif
 
 // ---------------------------------------------------------
@@ -509,6 +510,7 @@ G4MagInt_Driver::OneGoodStep(      G4double y[],        // InOut
 
   for (G4int iter=0; iter<max_trials; ++iter)
   {
+    G4FieldStatistics::Count(G4FieldStatistics::kIntegrationSteps);
     pIntStepper-> Stepper(y,dydx,h,ytemp,yerr); 
     //            *******
     G4double eps_pos = eps_rel_max * std::max(h, fMinimumStep); 
@@ -626,6 +628,7 @@ G4bool G4MagInt_Driver::QuickAdvance(G4FieldTrack& y_posvel,    // INOUT
   s_start = y_posvel.GetCurveLength();
 
   // Do an Integration Step
+  G4FieldStatistics::Count(G4FieldStatistics::kIntegrationSteps);
   pIntStepper-> Stepper(yarrin, dydx, hstep, yarrout, yerr_vec) ; 
 
   // Estimate curve-chord distance
@@ -48,3 +48,17 @@ G4MagneticField& G4MagneticField::operator = (const G4MagneticField& p)
   G4Field::operator=(p); 
   return *this;
 }
+
+void G4MagneticField::GetFieldValues( G4int nPoints,
+                                      const G4double Points[][4],
+                                            G4double Bfields[][3] ) const
+{
+  G4double value[G4Field::MAX_NUMBER_OF_COMPONENTS];
+  for (G4int i = 0; i < nPoints; ++i)
+  {
+    GetFieldValue(Points[i], value);
+    Bfields[i][0] = value[0];
+    Bfields[i][1] = value[1];
+    Bfields[i][2] = value[2];
+  }
+}
@@ -0,0 +1,719 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4MagneticFieldMap implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include "G4MagneticFieldMap.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifndef WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+  // Layout of the binary file: magic word, format version, byte order
+  // mark, grid type, number of nodes, minimum and maximum along each axis
+  // (internal units), then, from offset kDataOffset, the node values
+  // (internal units) in the layout used in memory
+  //
+  const char kMagic[8] = { 'G', '4', 'F', 'L', 'D', 'M', 'A', 'P' };
+  const std::uint32_t kVersion = 1;
+  const std::uint32_t kByteOrder = 0x01020304;
+  const std::size_t kDataOffset = 128;
+
+  struct Header
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t grid;
+    std::int32_t nodes[3];
+    G4double minimum[3];
+    G4double maximum[3];
+  };
+
+  // Nodes are grouped in blocks of 4x4x4, of 4 values each
+  //
+  const G4int kBlock = 4;
+  const std::size_t kNodeSize = 4;
+  const std::size_t kLocalStride[3] = { 16 * kNodeSize, 4 * kNodeSize,
+                                        kNodeSize };
+
+  std::size_t NumberOfValues(const G4int nodes[3])
+  {
+    std::size_t nblocks = 1;
+    for (G4int a = 0; a < 3; ++a)
+    {
+      nblocks *= (std::size_t)(nodes[a] + kBlock - 1) / kBlock;
+    }
+    return nblocks * kBlock * kBlock * kBlock * kNodeSize;
+  }
+
+  // Weights of the interpolation along one axis, for the fraction 'f' of
+  // the cell; the cubic (Catmull-Rom) weights apply to nodes i-1 to i+2
+  //
+  inline void LinearWeights(G4double f, G4float w[4])
+  {
+    w[0] = G4float(1. - f);
+    w[1] = G4float(f);
+  }
+
+  inline void CubicWeights(G4double f, G4float w[4])
+  {
+    w[0] = G4float(0.5 * ((-f + 2.) * f - 1.) * f);
+    w[1] = G4float(0.5 * ((3. * f - 5.) * f * f + 2.));
+    w[2] = G4float(0.5 * ((-3. * f + 4.) * f + 1.) * f);
+    w[3] = G4float(0.5 * (f - 1.) * f * f);
+  }
+
+  // Weighted sum of KxKxK nodes; the inner loop over the four values of
+  // a node is vectorised
+  //
+  template <G4int K>
+  inline void Accumulate(const G4float* data, const std::size_t off[3][4],
+                         const G4float w[3][4], G4float sum[4])
+  {
+    for (G4int i = 0; i < K; ++i)
+    {
+      for (G4int j = 0; j < K; ++j)
+      {
+        const G4float wij = w[0][i] * w[1][j];
+        const G4float* row = data + off[0][i] + off[1][j];
+        for (G4int k = 0; k < K; ++k)
+        {
+          const G4float wijk = wij * w[2][k];
+          const G4float* node = row + off[2][k];
+          for (std::size_t c = 0; c < kNodeSize; ++c)
+          {
+            sum[c] += wijk * node[c];
+          }
+        }
+      }
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+// Node values, owned or mapped from a file
+// --------------------------------------------------------------------
+struct G4MagneticFieldMap::Storage
+{
+  ~Storage()
+  {
+#ifndef WIN32
+    if (fMapping != nullptr) { munmap(fMapping, fMappingSize); }
+#endif
+  }
+
+  std::vector<G4float> fValues;
+  void* fMapping = nullptr;
+  std::size_t fMappingSize = 0;
+};
+
+// --------------------------------------------------------------------
+
+G4MagneticFieldMap::G4MagneticFieldMap(EGrid grid, const G4int nodes[3],
+                                       const G4double minimum[3],
+                                       const G4double maximum[3],
+                                       const std::vector<G4double>& values)
+  : fGrid(grid)
+{
+  for (G4int a = 0; a < 3; ++a)
+  {
+    fNodes[a] = nodes[a];
+    fMinimum[a] = minimum[a];
+    fMaximum[a] = maximum[a];
+  }
+  Initialise();
+
+  const std::size_t nvalues = 3 * (std::size_t)nodes[0] * nodes[1] * nodes[2];
+  if (values.size() != nvalues)
+  {
+    G4ExceptionDescription msg;
+    msg << "Got " << values.size() << " field values for "
+        << nodes[0] << "x" << nodes[1] << "x" << nodes[2]
+        << " nodes; expected " << nvalues << ".";
+    G4Exception("G4MagneticFieldMap::G4MagneticFieldMap()",
+                "GeomField0001", FatalErrorInArgument, msg);
+    return;
+  }
+
+  auto storage = std::make_shared<Storage>();
+  storage->fValues.assign(NumberOfValues(fNodes), 0.0f);
+  std::size_t n = 0;
+  for (G4int i = 0; i < fNodes[0]; ++i)
+  {
+    for (G4int j = 0; j < fNodes[1]; ++j)
+    {
+      for (G4int k = 0; k < fNodes[2]; ++k)
+      {
+        G4float* node = storage->fValues.data() + Offset(0, i)
+                      + Offset(1, j) + Offset(2, k);
+        node[0] = G4float(values[n++]);
+        node[1] = G4float(values[n++]);
+        node[2] = G4float(values[n++]);
+      }
+    }
+  }
+  fData = storage->fValues.data();
+  fStorage = std::move(storage);
+}
+
+// --------------------------------------------------------------------
+
+G4MagneticFieldMap::G4MagneticFieldMap(const G4String& filename)
+{
+  G4ExceptionDescription msg;
+  Header header;
+  std::ifstream file(filename, std::ios::binary);
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header)))
+  {
+    msg << "Cannot read field map file: " << filename;
+  }
+  else if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+        || header.version != kVersion || header.byteOrder != kByteOrder
+        || header.grid > kCylindrical)
+  {
+    msg << "Not a field map file, or written with a different format\n"
+        << "version or byte order: " << filename;
+  }
+  if (!msg.str().empty())
+  {
+    G4Exception("G4MagneticFieldMap::G4MagneticFieldMap()",
+                "GeomField0001", FatalException, msg);
+    return;
+  }
+
+  fGrid = EGrid(header.grid);
+  for (G4int a = 0; a < 3; ++a)
+  {
+    fNodes[a] = header.nodes[a];
+    fMinimum[a] = header.minimum[a];
+    fMaximum[a] = header.maximum[a];
+  }
+  Initialise();
+
+  const std::size_t nvalues = NumberOfValues(fNodes);
+  const std::size_t size = kDataOffset + nvalues * sizeof(G4float);
+  file.seekg(0, std::ios::end);
+  if ((std::size_t)file.tellg() != size)
+  {
+    msg << "Field map file has a wrong size: " << filename;
+    G4Exception("G4MagneticFieldMap::G4MagneticFieldMap()",
+                "GeomField0001", FatalException, msg);
+    return;
+  }
+
+  auto storage = std::make_shared<Storage>();
+#ifndef WIN32
+  file.close();
+  G4int fd = open(filename.c_str(), O_RDONLY);
+  if (fd >= 0)
+  {
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping != MAP_FAILED)
+    {
+      storage->fMapping = mapping;
+      storage->fMappingSize = size;
+      fData = reinterpret_cast<const G4float*>(
+                static_cast<const char*>(mapping) + kDataOffset);
+    }
+  }
+  if (fData == nullptr)
+  {
+    file.open(filename, std::ios::binary);
+  }
+#endif
+  if (fData == nullptr)
+  {
+    storage->fValues.resize(nvalues);
+    file.seekg(kDataOffset);
+    if (!file.read(reinterpret_cast<char*>(storage->fValues.data()),
+                   std::streamsize(nvalues * sizeof(G4float))))
+    {
+      msg << "Cannot read field map file: " << filename;
+      G4Exception("G4MagneticFieldMap::G4MagneticFieldMap()",
+                  "GeomField0001", FatalException, msg);
+      return;
+    }
+    fData = storage->fValues.data();
+  }
+  fStorage = std::move(storage);
+}
+
+// --------------------------------------------------------------------
+
+G4MagneticFieldMap::~G4MagneticFieldMap() = default;
+
+// --------------------------------------------------------------------
+
+G4MagneticFieldMap::G4MagneticFieldMap(const G4MagneticFieldMap& r)
+  : G4MagneticField(r), fStorage(r.fStorage), fData(r.fData),
+    fGrid(r.fGrid), fInterpolation(r.fInterpolation), fOrigin(r.fOrigin),
+    fScale(r.fScale), fPhiPeriod(r.fPhiPeriod)
+{
+  for (G4int a = 0; a < 3; ++a)
+  {
+    fNodes[a] = r.fNodes[a];
+    fMinimum[a] = r.fMinimum[a];
+    fMaximum[a] = r.fMaximum[a];
+    fInvSpacing[a] = r.fInvSpacing[a];
+    fBlockStride[a] = r.fBlockStride[a];
+    fReflect[a] = r.fReflect[a];
+    for (G4int c = 0; c < 3; ++c)
+    {
+      fReflectSign[a][c] = r.fReflectSign[a][c];
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+
+G4Field* G4MagneticFieldMap::Clone() const
+{
+  return new G4MagneticFieldMap(*this);
+}
+
+// --------------------------------------------------------------------
+
+void G4MagneticFieldMap::Initialise()
+{
+  G4bool valid = true;
+  for (G4int a = 0; a < 3; ++a)
+  {
+    valid = valid && fNodes[a] > 0 && fMaximum[a] >= fMinimum[a]
+                  && (fNodes[a] == 1 || fMaximum[a] > fMinimum[a]);
+  }
+  if (fGrid == kCylindrical)
+  {
+    valid = valid && fMinimum[0] >= 0.
+                  && fMaximum[1] - fMinimum[1] <= CLHEP::twopi + 1.e-9;
+  }
+  if (!valid)
+  {
+    G4ExceptionDescription msg;
+    msg << "Invalid grid for field map: " << fNodes[0] << "x" << fNodes[1]
+        << "x" << fNodes[2] << " nodes, from (" << fMinimum[0] << ","
+        << fMinimum[1] << "," << fMinimum[2] << ") to (" << fMaximum[0]
+        << "," << fMaximum[1] << "," << fMaximum[2] << ").";
+    G4Exception("G4MagneticFieldMap::Initialise()",
+                "GeomField0001", FatalErrorInArgument, msg);
+  }
+
+  std::size_t stride = kBlock * kBlock * kBlock * kNodeSize;
+  for (G4int a = 2; a >= 0; --a)
+  {
+    fInvSpacing[a] = (fNodes[a] > 1)
+                   ? (fNodes[a] - 1) / (fMaximum[a] - fMinimum[a]) : 0.;
+    fBlockStride[a] = stride;
+    stride *= (std::size_t)(fNodes[a] + kBlock - 1) / kBlock;
+  }
+}
+
+// --------------------------------------------------------------------
+
+inline std::size_t G4MagneticFieldMap::Offset(G4int axis, G4int index) const
+{
+  return (std::size_t)(index / kBlock) * fBlockStride[axis]
+       + (std::size_t)(index % kBlock) * kLocalStride[axis];
+}
+
+// --------------------------------------------------------------------
+
+void G4MagneticFieldMap::SetReflection(EAxis axis,
+                                       G4int signX, G4int signY, G4int signZ)
+{
+  const G4int signs[3] = { signX, signY, signZ };
+  G4bool valid = (axis == kXAxis || axis == kYAxis || axis == kZAxis)
+              && (fGrid == kCartesian || axis == kZAxis);
+  for (auto sign : signs)
+  {
+    valid = valid && (sign == 1 || sign == -1);
+  }
+  if (!valid)
+  {
+    G4ExceptionDescription msg;
+    msg << "Invalid reflection for field map: axis " << axis
+        << ", signs " << signX << "," << signY << "," << signZ << ".\n"
+        << "Only planes x=0, y=0 or z=0 (z=0 for cylindrical grids)\n"
+        << "are supported, with signs of +1 or -1.";
+    G4Exception("G4MagneticFieldMap::SetReflection()",
+                "GeomField0001", FatalErrorInArgument, msg);
+    return;
+  }
+  const G4int a = (axis == kXAxis) ? 0 : (axis == kYAxis) ? 1 : 2;
+  fReflect[a] = true;
+  for (G4int c = 0; c < 3; ++c)
+  {
+    fReflectSign[a][c] = signs[c];
+  }
+}
+
+// --------------------------------------------------------------------
+
+void G4MagneticFieldMap::SetPhiPeriod(G4double period)
+{
+  if (fGrid != kCylindrical || period <= 0.
+   || period > CLHEP::twopi + 1.e-9)
+  {
+    G4ExceptionDescription msg;
+    msg << "Invalid phi period for field map: " << period / CLHEP::deg
+        << " deg.\nOnly cylindrical grids can be periodic in phi.";
+    G4Exception("G4MagneticFieldMap::SetPhiPeriod()",
+                "GeomField0001", FatalErrorInArgument, msg);
+    return;
+  }
+  fPhiPeriod = period;
+}
+
+// --------------------------------------------------------------------
+
+G4bool G4MagneticFieldMap::FoldPoint(const G4double point[4],
+                                     G4double local[3], G4double sign[3],
+                                     G4double& cosPhi, G4double& sinPhi) const
+{
+  const G4double x = point[0] - fOrigin.x();
+  const G4double y = point[1] - fOrigin.y();
+  const G4double z = point[2] - fOrigin.z();
+  sign[0] = sign[1] = sign[2] = fScale;
+
+  if (fGrid == kCartesian)
+  {
+    local[0] = x;
+    local[1] = y;
+    local[2] = z;
+  }
+  else
+  {
+    const G4double r = std::sqrt(x * x + y * y);
+    local[0] = r;
+    local[2] = z;
+    cosPhi = (r > 0.) ? x / r : 1.;
+    sinPhi = (r > 0.) ? y / r : 0.;
+    if (fNodes[1] > 1)
+    {
+      G4double phi = std::atan2(y, x);
+      if (fPhiPeriod > 0.)
+      {
+        phi = std::fmod(phi - fMinimum[1], fPhiPeriod);
+        if (phi < 0.) { phi += fPhiPeriod; }
+        phi += fMinimum[1];
+      }
+      else if (phi < fMinimum[1])
+      {
+        phi += CLHEP::twopi;
+      }
+      local[1] = phi;
+    }
+  }
+
+  for (G4int a = 0; a < 3; ++a)
+  {
+    if (fReflect[a] && local[a] < 0.)
+    {
+      local[a] = -local[a];
+      sign[0] *= fReflectSign[a][0];
+      sign[1] *= fReflectSign[a][1];
+      sign[2] *= fReflectSign[a][2];
+    }
+  }
+  for (G4int a = 0; a < 3; ++a)
+  {
+    if (fNodes[a] > 1 && (local[a] < fMinimum[a] || local[a] > fMaximum[a]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+
+void G4MagneticFieldMap::Interpolate(const G4double local[3],
+                                     G4double value[3]) const
+{
+  const G4int K = (fInterpolation == kCubic) ? 4 : 2;
+  std::size_t off[3][4];
+  G4float w[3][4];
+
+  for (G4int a = 0; a < 3; ++a)
+  {
+    const G4int n = fNodes[a];
+    G4int i = 0;
+    G4double f = 0.;
+    if (n > 1)
+    {
+      const G4double t = (local[a] - fMinimum[a]) * fInvSpacing[a];
+      i = std::min(G4int(t), n - 2);
+      f = t - i;
+    }
+    if (K == 2)
+    {
+      LinearWeights(f, w[a]);
+      off[a][0] = Offset(a, i);
+      off[a][1] = Offset(a, std::min(i + 1, n - 1));
+    }
+    else
+    {
+      CubicWeights(f, w[a]);
+      if (n > 1 && i == 0)
+      {
+        // Node before the first one extrapolated linearly
+        w[a][1] += 2.f * w[a][0];
+        w[a][2] -= w[a][0];
+        w[a][0] = 0.f;
+      }
+      if (n > 1 && i == n - 2)
+      {
+        // Node after the last one extrapolated linearly
+        w[a][2] += 2.f * w[a][3];
+        w[a][1] -= w[a][3];
+        w[a][3] = 0.f;
+      }
+      for (G4int j = 0; j < 4; ++j)
+      {
+        off[a][j] = Offset(a, std::max(0, std::min(i + j - 1, n - 1)));
+      }
+    }
+  }
+
+  G4float sum[4] = { 0.f, 0.f, 0.f, 0.f };
+  if (K == 2)
+  {
+    Accumulate<2>(fData, off, w, sum);
+  }
+  else
+  {
+    Accumulate<4>(fData, off, w, sum);
+  }
+  value[0] = sum[0];
+  value[1] = sum[1];
+  value[2] = sum[2];
+}
+
+// --------------------------------------------------------------------
+
+void G4MagneticFieldMap::GetFieldValue(const G4double Point[4],
+                                             G4double* Bfield) const
+{
+  G4double local[3], sign[3], value[3];
+  G4double cosPhi = 1., sinPhi = 0.;
+  if (!FoldPoint(Point, local, sign, cosPhi, sinPhi))
+  {
+    Bfield[0] = Bfield[1] = Bfield[2] = 0.;
+    return;
+  }
+  Interpolate(local, value);
+  value[0] *= sign[0];
+  value[1] *= sign[1];
+  value[2] *= sign[2];
+  if (fGrid == kCartesian)
+  {
+    Bfield[0] = value[0];
+    Bfield[1] = value[1];
+  }
+  else
+  {
+    Bfield[0] = value[0] * cosPhi - value[1] * sinPhi;
+    Bfield[1] = value[0] * sinPhi + value[1] * cosPhi;
+  }
+  Bfield[2] = value[2];
+}
+
+// --------------------------------------------------------------------
+
+void G4MagneticFieldMap::GetFieldValues(G4int nPoints,
+                                        const G4double Points[][4],
+                                              G4double Bfields[][3]) const
+{
+  for (G4int i = 0; i < nPoints; ++i)
+  {
+    G4MagneticFieldMap::GetFieldValue(Points[i], Bfields[i]);
+  }
+}
+
+// --------------------------------------------------------------------
+
+G4bool G4MagneticFieldMap::Write(const G4String& filename) const
+{
+  Header header;
+  std::memset(&header, 0, sizeof(Header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.byteOrder = kByteOrder;
+  header.grid = fGrid;
+  for (G4int a = 0; a < 3; ++a)
+  {
+    header.nodes[a] = fNodes[a];
+    header.minimum[a] = fMinimum[a];
+    header.maximum[a] = fMaximum[a];
+  }
+  const char padding[kDataOffset] = {};
+
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  file.write(padding, std::streamsize(kDataOffset - sizeof(Header)));
+  file.write(reinterpret_cast<const char*>(fData),
+             std::streamsize(NumberOfValues(fNodes) * sizeof(G4float)));
+  file.close();
+  if (!file)
+  {
+    G4ExceptionDescription msg;
+    msg << "Cannot write field map file: " << filename;
+    G4Exception("G4MagneticFieldMap::Write()",
+                "GeomField0003", JustWarning, msg);
+    return false;
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+
+G4bool G4MagneticFieldMap::ConvertTextFile(const G4String& textFile,
+                                           const G4String& binaryFile,
+                                           EGrid grid, G4double lengthUnit,
+                                           G4double fieldUnit,
+                                           G4double angleUnit)
+{
+  G4ExceptionDescription msg;
+  std::ifstream file(textFile);
+  if (!file)
+  {
+    msg << "Cannot read field map text file: " << textFile;
+    G4Exception("G4MagneticFieldMap::ConvertTextFile()",
+                "GeomField0003", JustWarning, msg);
+    return false;
+  }
+
+  // Rows starting with six numbers: three coordinates and three
+  // components of the field
+  //
+  std::vector<G4double> rows;
+  std::string line;
+  while (std::getline(file, line))
+  {
+    std::istringstream is(line);
+    G4double row[6];
+    G4int n = 0;
+    while (n < 6 && (is >> row[n])) { ++n; }
+    if (n == 6) { rows.insert(rows.end(), row, row + 6); }
+  }
+  const std::size_t nrows = rows.size() / 6;
+
+  // Grid spanned by the distinct coordinates along each axis, which
+  // must be evenly spaced
+  //
+  G4int nodes[3];
+  G4double minimum[3], maximum[3], step[3];
+  for (G4int a = 0; a < 3 && msg.str().empty(); ++a)
+  {
+    std::vector<G4double> coords;
+    coords.reserve(nrows);
+    for (std::size_t r = 0; r < nrows; ++r) { coords.push_back(rows[6*r+a]); }
+    std::sort(coords.begin(), coords.end());
+    coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+    if (coords.empty())
+    {
+      msg << "No field values found in " << textFile;
+      break;
+    }
+    nodes[a] = (G4int)coords.size();
+    minimum[a] = coords.front();
+    maximum[a] = coords.back();
+    step[a] = (nodes[a] > 1) ? (maximum[a] - minimum[a]) / (nodes[a] - 1)
+                             : 1.;
+    for (G4int i = 0; i < nodes[a]; ++i)
+    {
+      if (std::fabs(coords[i] - minimum[a] - i * step[a]) > 1.e-6 * step[a])
+      {
+        msg << "Coordinates along axis " << a << " are not evenly spaced"
+            << " in " << textFile;
+        break;
+      }
+    }
+  }
+
+  std::vector<G4double> values;
+  if (msg.str().empty())
+  {
+    const std::size_t nnodes = (std::size_t)nodes[0] * nodes[1] * nodes[2];
+    std::vector<G4bool> filled(nnodes, false);
+    values.assign(3 * nnodes, 0.);
+    for (std::size_t r = 0; r < nrows; ++r)
+    {
+      std::size_t index = 0;
+      for (G4int a = 0; a < 3; ++a)
+      {
+        index = index * nodes[a]
+              + (std::size_t)std::lround((rows[6*r+a] - minimum[a]) / step[a]);
+      }
+      if (filled[index]) { break; }
+      filled[index] = true;
+      for (G4int c = 0; c < 3; ++c)
+      {
+        values[3*index+c] = rows[6*r+3+c] * fieldUnit;
+      }
+    }
+    if (nrows != nnodes
+     || std::find(filled.cbegin(), filled.cend(), false) != filled.cend())
+    {
+      msg << "Field values in " << textFile << " do not form a complete\n"
+          << "regular grid: " << nrows << " rows for " << nodes[0] << "x"
+          << nodes[1] << "x" << nodes[2] << " nodes.";
+    }
+  }
+  if (!msg.str().empty())
+  {
+    G4Exception("G4MagneticFieldMap::ConvertTextFile()",
+                "GeomField0003", JustWarning, msg);
+    return false;
+  }
+
+  for (G4int a = 0; a < 3; ++a)
+  {
+    const G4double unit = (grid == kCylindrical && a == 1) ? angleUnit
+                                                           : lengthUnit;
+    minimum[a] *= unit;
+    maximum[a] *= unit;
+  }
+  G4MagneticFieldMap fieldMap(grid, nodes, minimum, maximum, values);
+  return fieldMap.Write(binaryFile);
+}
@@ -39,6 +39,7 @@
 
 #ifdef   G4DEBUG_FIELD
 #include "G4DriverReporter.hh"
+#include "G4FieldStatistics.hh"
 #endif
 
 // ---------------------------------------------------------
@@ -520,6 +521,7 @@ G4OldMagIntDriver::OneGoodStep(      G4double y[],        // InOut
 
   for (G4int iter=0; iter<max_trials; ++iter)
   {
+    G4FieldStatistics::Count(G4FieldStatistics::kIntegrationSteps);
     pIntStepper-> Stepper(y,dydx,h,ytemp,yerr); 
     //            *******
     G4double eps_pos = eps_rel_max * std::max(h, fMinimumStep); 
@@ -641,6 +643,7 @@ G4bool G4OldMagIntDriver::QuickAdvance(G4FieldTrack& y_posvel,    // INOUT
   s_start = y_posvel.GetCurveLength();
 
   // Do an Integration Step
+  G4FieldStatistics::Count(G4FieldStatistics::kIntegrationSteps);
   pIntStepper-> Stepper(yarrin, dydx, hstep, yarrout, yerr_vec) ; 
 
   // Estimate curve-chord distance
@@ -68,8 +68,26 @@ void G4TrialsCounter::ClearCounts()
   fNoTimesMaxTrials = 0; 
 }
 
-G4int
-G4TrialsCounter::ReturnTotals( G4int& calls, G4int& maxTrials, G4int& numMaxT ) 
+void G4TrialsCounter::AccumulateCounts( const G4TrialsCounter& other )
+{
+  fTotalNoTrials += other.fTotalNoTrials;
+  fNumberCalls   += other.fNumberCalls;
+
+  if( other.fmaxTrials > fmaxTrials )
+  {
+    fmaxTrials = other.fmaxTrials;
+    fNoTimesMaxTrials = other.fNoTimesMaxTrials;
+  }
+  else if( other.fmaxTrials == fmaxTrials )
+  {
+    fNoTimesMaxTrials += other.fNoTimesMaxTrials;
+  }
+  fPrinted = false;  // New statistics
+}
+
+G4long
+G4TrialsCounter::ReturnTotals( G4long& calls, G4int& maxTrials,
+                               G4int& numMaxT ) const
 {
   calls     = fNumberCalls; 
   maxTrials = fmaxTrials;
@@ -31,6 +31,9 @@
 // high level objects in the geometry subdomain.
 // The class is a `singleton', with access via the static method
 // G4GeometryManager::GetInstance().
+// Modifications of individual logical volumes while the geometry is
+// closed can be recorded, for the optimisation to be rebuilt only for
+// the volumes affected, without reopening the whole geometry.
 //
 // Member data:
 //
@@ -48,6 +51,8 @@
 #include "G4SmartVoxelStat.hh"
 
 class G4VPhysicalVolume;
+class G4LogicalVolume;
+class G4SmartVoxelHeader;
 
 class G4GeometryManager
 {
@@ -67,6 +72,25 @@ class G4GeometryManager
     static G4bool IsGeometryClosed();
       // Return true/false according to state of optimised geoemtry.
 
+    void VolumeHasBeenModified(G4LogicalVolume* pVolume);
+      // Record that the logical volume has been modified (daughters added,
+      // removed or moved, solid or material changed) in the closed
+      // geometry, so that the optimisation is rebuilt for it by the next
+      // call to CloseModifiedVolumes().
+
+    G4bool HasModifiedVolumes() const;
+    const std::vector<G4LogicalVolume*>& GetModifiedVolumes() const;
+      // Return whether logical volumes have been recorded as modified,
+      // and the list of them.
+
+    void CloseModifiedVolumes(G4bool pOptimise = true, G4bool verbose = false);
+      // Rebuild the optimisation of the logical volumes recorded as
+      // modified and of the logical volumes placing them, the voxels of
+      // a mother volume depending only on the extent of its daughters.
+      // The rest of the geometry is left closed and untouched. If the
+      // geometry is open, it is closed entirely. The list of modified
+      // volumes is cleared.
+
     void SetWorldMaximumExtent(G4double worldExtent);
       // Set the maximum extent of the world volume. The operation is
       // allowed only if NO solids have been created already.
@@ -91,13 +115,19 @@ class G4GeometryManager
   private:
 
     void BuildOptimisations(G4bool allOpt, G4bool verbose = false);
+    static G4SmartVoxelHeader* BuildVoxels(G4LogicalVolume* volume,
+                                           G4bool allOpt);
     void BuildOptimisations(G4bool allOpt, G4VPhysicalVolume* vol);
     void DeleteOptimisations();
     void DeleteOptimisations(G4VPhysicalVolume* vol);
+    static void BuildSafetyGrid(G4LogicalVolume* volume);
+    static void DeleteSafetyGrid(G4LogicalVolume* volume);
     static void ReportVoxelStats( std::vector<G4SmartVoxelStat>& stats,
                                   G4double totalCpuTime );
     static G4ThreadLocal G4GeometryManager* fgInstance;
     static G4ThreadLocal G4bool fIsClosed;
+
+    std::vector<G4LogicalVolume*> fModifiedVolumes;
 };
 
 #endif
@@ -69,6 +69,11 @@
 //    - Pointer (possibly 0) to user Step limit object for this node.
 //    G4SmartVoxelHeader* fVoxel
 //    - Pointer (possibly 0) to optimisation info objects.
+//    G4SafetyGrid* fSafetyGrid
+//    - Pointer (possibly 0) to the grid of safety bounds.
+//    G4int fSafetyGridSize
+//    - Number of cells requested for the grid of safety bounds along
+//      the largest dimension of the volume (0 if no grid requested).
 //    G4bool fOptimise
 //    - Flag to identify if optimisation should be applied or not.
 //    G4bool fRootRegion
@@ -121,6 +126,7 @@ class G4VSensitiveDetector;
 class G4VSolid;
 class G4UserLimits;
 class G4SmartVoxelHeader;
+class G4SafetyGrid;
 class G4FastSimulationManager;
 class G4MaterialCutsCouple;
 class G4VisAttributes;
@@ -295,6 +301,18 @@ class G4LogicalVolume
     inline void SetSmartless(G4double s);
       // Gets and sets user defined optimisation quality.
 
+    inline G4SafetyGrid* GetSafetyGrid() const;
+    inline void SetSafetyGrid(G4SafetyGrid* pGrid);
+      // Gets and sets current grid of safety bounds.
+
+    inline G4int GetSafetyGridSize() const;
+    inline void SetSafetyGridSize(G4int nCells);
+      // Gets and sets the number of cells, along the largest dimension of
+      // the volume, of the grid of safety bounds to be built when closing
+      // the geometry. The grid provides, at the cost of memory, a fast
+      // lower bound of the isotropic safety in volumes with many complex
+      // daughters placed in it. Default is 0, i.e. no grid is built.
+
     inline G4bool IsToOptimise() const;
       // Replies if geometry optimisation (voxelisation) is to be
       // applied for this volume hierarchy.
@@ -406,6 +424,10 @@ class G4LogicalVolume
     G4double fSmartless = 2.0;
       // Quality for optimisation, average number of voxels to be spent
       // per content.
+    G4SafetyGrid* fSafetyGrid = nullptr;
+      // Pointer (possibly nullptr) to the grid of safety bounds.
+    G4int fSafetyGridSize = 0;
+      // Number of cells requested for the grid of safety bounds.
     G4Region* fRegion = nullptr;
       // Pointer to the cuts region (if any).
     G4double fBiasWeight = 1.0;
@@ -0,0 +1,112 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SafetyGrid
+//
+// Class description:
+//
+// Regular grid of conservative isotropic safety values, covering the
+// bounding box of a logical volume, in the reference frame of the volume.
+// The value stored for each cell is a lower bound of the distance, from
+// any point of the cell lying in the volume, to the boundary of the volume
+// and to its daughters. It is computed at the cell centre as the minimum
+// of the safeties of the volume and of its daughters, reduced by the half
+// diagonal of the cell; values are stored in single precision, rounded
+// down. The grid is built when closing the geometry for logical volumes
+// requesting it (see G4LogicalVolume::SetSafetyGridSize()), and allows
+// the navigator to return the isotropic safety with a single lookup.
+// Since the bound is by construction smaller than the exact safety, by up
+// to about the size of a cell, it is only used when large enough to be
+// useful; the exact computation is performed otherwise.
+// Only volumes whose daughters are all placements are supported.
+// The total number of cells is limited by a memory budget, common to all
+// grids (see SetMaxMemory()); the cells are enlarged to fit in it.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4SAFETYGRID_HH
+#define G4SAFETYGRID_HH 1
+
+#include <vector>
+
+#include "G4Types.hh"
+#include "G4ThreeVector.hh"
+
+class G4LogicalVolume;
+
+class G4SafetyGrid
+{
+  public:
+
+    G4SafetyGrid(const G4LogicalVolume* pVolume, G4int nMaxCells);
+      // Build the grid for the volume, with nMaxCells cells along the
+      // largest dimension of its bounding box, or less if the grid would
+      // exceed the memory budget.
+
+    ~G4SafetyGrid() = default;
+
+    G4SafetyGrid(const G4SafetyGrid&) = delete;
+    G4SafetyGrid& operator=(const G4SafetyGrid&) = delete;
+
+    inline G4double GetSafety(const G4ThreeVector& localPoint) const;
+      // Return the lower bound of the safety for a point, in the reference
+      // frame of the volume, located inside the volume and outside of its
+      // daughters. Zero is returned for points outside of the grid.
+
+    inline G4bool IsUseful(G4double safety, G4double pMaxLength) const;
+      // Return true if the bound returned by GetSafety() can be used in
+      // place of the exact safety, i.e. if it is not smaller than the
+      // maximum length of interest or than the minimum useful safety.
+
+    inline G4double GetMinimumUsefulSafety() const;
+    inline void SetMinimumUsefulSafety(G4double val);
+      // Get/set the minimum value of the bound to be used in place of the
+      // exact safety. Default: the diagonal of a cell.
+
+    inline const G4ThreeVector& GetCellSize() const;
+    inline G4int GetNumberOfCells() const;
+    G4long GetMemoryUse() const;
+      // Information on the grid.
+
+    static inline G4long GetMaxMemory();
+    static inline void SetMaxMemory(G4long bytes);
+      // Get/set the maximum memory, in bytes, taken by the values of a
+      // grid. Default: 128 MB.
+
+  private:
+
+    G4ThreeVector fMin;          // Lower corner of the grid
+    G4ThreeVector fInvCell;      // Inverse of the cell sizes
+    G4ThreeVector fCell;         // Cell sizes
+    G4int fNx = 0, fNy = 0, fNz = 0;
+    G4double fMinUseful = 0.;
+    std::vector<G4float> fValues;  // Bounds, x index running fastest
+
+    static G4long fMaxMemory;
+};
+
+#include "G4SafetyGrid.icc"
+
+#endif
@@ -0,0 +1,143 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SolidPropertiesCache
+//
+// Class description:
+//
+// Thread-safe cache of the Monte Carlo estimates of the cubic volume
+// and surface area of solids for which no analytical expression is
+// available (Boolean solids, multi-unions, generic user solids ...).
+// Estimates are keyed by solid and shared by all threads; since the
+// estimators are deterministic, a value computed concurrently by
+// different threads is identical and only stored once.
+// The class also holds the settings for the estimation: the relative
+// statistical precision at which sampling can be stopped before the
+// requested statistics is reached, and whether the sampling can be
+// distributed on the tasking thread pool (see G4TaskDispatcher).
+// The content of the cache can be saved to and restored from a stream,
+// so that the estimates can be persisted together with the geometry
+// (see G4GDMLBinaryCache) or in a file, through the commands in the
+// /geometry/solids/ directory; restored values are matched to solids
+// by name, type and extent.
+// The class is a 'singleton', with access via the static method
+// G4SolidPropertiesCache::GetInstance().
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4SOLIDPROPERTIESCACHE_HH
+#define G4SOLIDPROPERTIESCACHE_HH 1
+
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <unordered_map>
+
+#include "G4Types.hh"
+#include "G4String.hh"
+#include "G4ThreeVector.hh"
+
+class G4VSolid;
+
+class G4SolidPropertiesCache
+{
+  public:
+
+    static G4SolidPropertiesCache* GetInstance();
+      // Get a ptr to the unique instance, creating it if necessary.
+
+    G4double GetCubicVolume(const G4VSolid* pSolid,
+                            G4int nStat, G4double epsilon);
+    G4double GetSurfaceArea(const G4VSolid* pSolid,
+                            G4int nStat, G4double ell);
+      // Return the cached estimate for the solid, computing it with
+      // the given statistics and accuracy if not yet available.
+
+    void Invalidate(const G4VSolid* pSolid);
+      // Remove the estimates for the given solid, e.g. when its
+      // parameters are modified.
+    static void DeRegister(const G4VSolid* pSolid);
+      // Same as above, but without instantiating the cache if not
+      // already existing. Used at deletion of solids.
+    void Clear();
+      // Remove all cached and restored estimates.
+
+    inline void SetPrecision(G4double val) { fPrecision = val; }
+    inline G4double GetPrecision() const { return fPrecision; }
+      // Relative statistical precision at which sampling can be stopped.
+      // A value <= 0 (default) implies that the full statistics is used.
+    inline void SetParallel(G4bool val) { fParallel = val; }
+    inline G4bool IsParallel() const { return fParallel; }
+      // Enable/disable the distribution of the sampling on the thread pool.
+
+    static void ForEachBatch(G4int nbatch,
+                             const std::function<void(G4int)>& func);
+      // Execute func(i) for i in [0,nbatch), distributing the calls on the
+      // thread pool when parallel estimation is enabled.
+
+    void Store(std::ostream& os) const;
+      // Write all cached estimates, one solid per line.
+    G4int Retrieve(std::istream& is);
+      // Read estimates previously written with Store(); they are assigned
+      // to solids at first request, if name, type and extent match.
+      // Returns the number of entries read.
+
+    G4SolidPropertiesCache(const G4SolidPropertiesCache&) = delete;
+    G4SolidPropertiesCache& operator=(const G4SolidPropertiesCache&) = delete;
+
+  private:
+
+    struct Entry
+    {
+      G4double volume = -1.;
+      G4double area = -1.;
+    };
+
+    struct Persisted
+    {
+      G4String type;
+      G4ThreeVector bmin, bmax;
+      Entry values;
+    };
+
+    G4SolidPropertiesCache() = default;
+   ~G4SolidPropertiesCache();
+
+    Entry* Restore(const G4VSolid* pSolid);
+      // Look up restored estimates for the solid and move them into
+      // the cache. Must be called with the cache locked.
+
+  private:
+
+    static G4SolidPropertiesCache* fInstance;
+
+    std::unordered_map<const G4VSolid*, Entry> fCache;
+    std::multimap<G4String, Persisted> fRestored;
+
+    G4double fPrecision = 0.;
+    G4bool fParallel = true;
+};
+
+#endif
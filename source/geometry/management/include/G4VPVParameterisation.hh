@@ -40,6 +40,7 @@
 #define G4VPVPARAMETERISATION_HH 1
 
 #include "G4Types.hh"
+#include "G4ThreeVector.hh"
 #include "G4VVolumeMaterialScanner.hh"
 
 class G4VPhysicalVolume;
@@ -86,6 +87,15 @@ class G4VPVParameterisation
     virtual G4VVolumeMaterialScanner* GetMaterialScanner(); 
        //   These enable material scan for nested parameterisations
 
+    virtual G4bool ComputeExtent(const G4int copyNo,
+                                 const G4VPhysicalVolume* pPhysicalVol,
+                                 G4ThreeVector& pMin,
+                                 G4ThreeVector& pMax) const;
+       //   Optionally provides the axis-aligned bounding box of copy
+       //   'copyNo' in the reference frame of the mother volume, without
+       //   altering the state of the physical volume. Used as fast path
+       //   for voxelisation; the default returns false (not available).
+
     virtual void ComputeDimensions(G4Box &,
                                    const G4int,
                                    const G4VPhysicalVolume *) const {}
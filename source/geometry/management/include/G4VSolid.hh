@@ -231,15 +231,21 @@ class G4VSolid
     G4VSolid& operator=(const G4VSolid& rhs);
       // Copy constructor and assignment operator.
 
-    G4double EstimateCubicVolume(G4int nStat, G4double epsilon) const;
+    G4double EstimateCubicVolume(G4int nStat, G4double epsilon,
+                                 G4double precision = 0.) const;
       // Calculate cubic volume based on Inside() method.
       // Accuracy is limited by the second argument or the statistics
-      // expressed by the first argument.
+      // expressed by the first argument. If the third argument is positive,
+      // sampling stops once that relative statistical error is reached.
+      // The result is reproducible and independent of the number of threads
+      // on which sampling is distributed (see G4SolidPropertiesCache).
 
-    G4double EstimateSurfaceArea(G4int nStat, G4double ell) const;
+    G4double EstimateSurfaceArea(G4int nStat, G4double ell,
+                                 G4double precision = 0.) const;
       // Calculate surface area only based on Inside() method.
       // Accuracy is limited by the second argument or the statistics
-      // expressed by the first argument.
+      // expressed by the first argument. If the third argument is positive,
+      // sampling stops once that relative statistical error is reached.
 
   protected:  // with description
 
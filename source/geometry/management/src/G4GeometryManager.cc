@@ -29,6 +29,8 @@
 // --------------------------------------------------------------------
 
 #include <iomanip>
+#include <algorithm>
+#include <set>
 
 #include "G4Timer.hh"
 #include "G4GeometryManager.hh"
@@ -42,8 +44,10 @@
 // Needed for building optimisations
 //
 #include "G4LogicalVolumeStore.hh"
+#include "G4PhysicalVolumeStore.hh"
 #include "G4VPhysicalVolume.hh"
 #include "G4SmartVoxelHeader.hh"
+#include "G4SafetyGrid.hh"
 #include "voxeldefs.hh"
 
 // Needed for setting the extent for tolerance value
@@ -88,6 +92,7 @@ G4bool G4GeometryManager::CloseGeometry(G4bool pOptimise, G4bool verbose,
     else
     {
       BuildOptimisations(pOptimise, verbose);
+      fModifiedVolumes.clear();
     }
     fIsClosed = true;
   }
@@ -125,6 +130,98 @@ G4bool G4GeometryManager::IsGeometryClosed()
   return fIsClosed;
 }
 
+// ***************************************************************************
+// Records a logical volume as modified in the closed geometry.
+// ***************************************************************************
+//
+void G4GeometryManager::VolumeHasBeenModified(G4LogicalVolume* pVolume)
+{
+  if (pVolume == nullptr) { return; }
+  if (std::find(fModifiedVolumes.cbegin(), fModifiedVolumes.cend(), pVolume)
+      == fModifiedVolumes.cend())
+  {
+    fModifiedVolumes.push_back(pVolume);
+  }
+}
+
+// ***************************************************************************
+// Returns whether logical volumes have been recorded as modified.
+// ***************************************************************************
+//
+G4bool G4GeometryManager::HasModifiedVolumes() const
+{
+  return !fModifiedVolumes.empty();
+}
+
+// ***************************************************************************
+// Returns the list of logical volumes recorded as modified.
+// ***************************************************************************
+//
+const std::vector<G4LogicalVolume*>&
+G4GeometryManager::GetModifiedVolumes() const
+{
+  return fModifiedVolumes;
+}
+
+// ***************************************************************************
+// Rebuilds the optimisation of the logical volumes recorded as modified and
+// of their mother volumes, keeping the rest of the geometry closed.
+// The mothers are the logical volumes in which any of the modified volumes
+// is placed; volumes further up are not affected, their voxels depending
+// only on the extent of their own daughters.
+// ***************************************************************************
+//
+void G4GeometryManager::CloseModifiedVolumes(G4bool pOptimise, G4bool verbose)
+{
+  if (!G4Threading::IsMasterThread()) { return; }
+  if (!fIsClosed)
+  {
+    CloseGeometry(pOptimise, verbose);
+    return;
+  }
+
+  std::set<G4LogicalVolume*> modified(fModifiedVolumes.cbegin(),
+                                      fModifiedVolumes.cend());
+  std::vector<G4LogicalVolume*> volumes(fModifiedVolumes);
+  for (auto pv : *G4PhysicalVolumeStore::GetInstance())
+  {
+    G4LogicalVolume* mother = pv->GetMotherLogical();
+    if (mother != nullptr && modified.count(pv->GetLogicalVolume()) != 0
+     && std::find(volumes.cbegin(), volumes.cend(), mother) == volumes.cend())
+    {
+      volumes.push_back(mother);
+    }
+  }
+
+  G4Timer timer;
+  G4Timer allTimer;
+  std::vector<G4SmartVoxelStat> stats;
+  if (verbose)  { allTimer.Start(); }
+  for (auto volume : volumes)
+  {
+    if (verbose)  { timer.Start(); }
+    G4SmartVoxelHeader* head = BuildVoxels(volume, pOptimise);
+    if (verbose && head != nullptr)
+    {
+      timer.Stop();
+      stats.emplace_back( volume, head, timer.GetSystemElapsed(),
+                                        timer.GetUserElapsed() );
+    }
+    BuildSafetyGrid(volume);
+  }
+  if (verbose)
+  {
+    allTimer.Stop();
+    G4cout << "G4GeometryManager::CloseModifiedVolumes -- "
+           << volumes.size() << " of "
+           << G4LogicalVolumeStore::GetInstance()->size()
+           << " logical volumes re-optimised" << G4endl;
+    ReportVoxelStats( stats, allTimer.GetSystemElapsed()
+                           + allTimer.GetUserElapsed() );
+  }
+  fModifiedVolumes.clear();
+}
+
 // ***************************************************************************
 // Returns the instance of the singleton.
 // Creates it in case it's called for the first time.
@@ -168,54 +265,15 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts, G4bool verbose)
    {
      if (verbose) timer.Start();
      volume=n;
-     // For safety, check if there are any existing voxels and
-     // delete before replacement
-     //
-     head = volume->GetVoxelHeader();
-     delete head;
-     volume->SetVoxelHeader(nullptr);
-     if (    ( (volume->IsToOptimise())
-            && (volume->GetNoDaughters()>=kMinVoxelVolumesLevel1&&allOpts) )
-          || ( (volume->GetNoDaughters()==1)
-            && (volume->GetDaughter(0)->IsReplicated())
-            && (volume->GetDaughter(0)->GetRegularStructureId()!=1) ) ) 
+     head = BuildVoxels(volume, allOpts);
+     if (verbose && head != nullptr)
      {
-#ifdef G4GEOMETRY_VOXELDEBUG
-       G4cout << "**** G4GeometryManager::BuildOptimisations" << G4endl
-              << "     Examining logical volume name = "
-              << volume->GetName() << G4endl;
-#endif
-       head = new G4SmartVoxelHeader(volume);
-       if (head != nullptr)
-       {
-         volume->SetVoxelHeader(head);
-       }
-       else
-       {
-         std::ostringstream message;
-         message << "VoxelHeader allocation error." << G4endl
-                 << "Allocation of new VoxelHeader" << G4endl
-                 << "        for volume " << volume->GetName() << " failed.";
-         G4Exception("G4GeometryManager::BuildOptimisations()", "GeomMgt0003",
-                     FatalException, message);
-       }
-       if (verbose)
-       {
-         timer.Stop();
-         stats.emplace_back( volume, head,
-                                            timer.GetSystemElapsed(),
-                                            timer.GetUserElapsed() );
-       }
-     }
-     else
-     {
-       // Don't create voxels for this node
-#ifdef G4GEOMETRY_VOXELDEBUG
-       G4cout << "**** G4GeometryManager::BuildOptimisations" << G4endl
-              << "     Skipping logical volume name = " << volume->GetName()
-              << G4endl;
-#endif
+       timer.Stop();
+       stats.emplace_back( volume, head,
+                                          timer.GetSystemElapsed(),
+                                          timer.GetUserElapsed() );
      }
+     BuildSafetyGrid(volume);
   }
   if (verbose)
   {
@@ -225,6 +283,59 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts, G4bool verbose)
   }
 }
 
+// ***************************************************************************
+// Creates the voxels of a logical volume, replacing any existing ones,
+// if the volume is to be optimised. Returns the new voxels header or null.
+// ***************************************************************************
+//
+G4SmartVoxelHeader* G4GeometryManager::BuildVoxels(G4LogicalVolume* volume,
+                                                   G4bool allOpts)
+{
+  // For safety, check if there are any existing voxels and
+  // delete before replacement
+  //
+  G4SmartVoxelHeader* head = volume->GetVoxelHeader();
+  delete head;
+  head = nullptr;
+  volume->SetVoxelHeader(nullptr);
+  if (    ( (volume->IsToOptimise())
+         && (volume->GetNoDaughters()>=kMinVoxelVolumesLevel1&&allOpts) )
+       || ( (volume->GetNoDaughters()==1)
+         && (volume->GetDaughter(0)->IsReplicated())
+         && (volume->GetDaughter(0)->GetRegularStructureId()!=1) ) ) 
+  {
+#ifdef G4GEOMETRY_VOXELDEBUG
+    G4cout << "**** G4GeometryManager::BuildOptimisations" << G4endl
+           << "     Examining logical volume name = "
+           << volume->GetName() << G4endl;
+#endif
+    head = new G4SmartVoxelHeader(volume);
+    if (head != nullptr)
+    {
+      volume->SetVoxelHeader(head);
+    }
+    else
+    {
+      std::ostringstream message;
+      message << "VoxelHeader allocation error." << G4endl
+              << "Allocation of new VoxelHeader" << G4endl
+              << "        for volume " << volume->GetName() << " failed.";
+      G4Exception("G4GeometryManager::BuildOptimisations()", "GeomMgt0003",
+                  FatalException, message);
+    }
+  }
+  else
+  {
+    // Don't create voxels for this node
+#ifdef G4GEOMETRY_VOXELDEBUG
+    G4cout << "**** G4GeometryManager::BuildOptimisations" << G4endl
+           << "     Skipping logical volume name = " << volume->GetName()
+           << G4endl;
+#endif
+  }
+  return head;
+}
+
 // ***************************************************************************
 // Creates optimisation info for the specified volumes subtree.
 // ***************************************************************************
@@ -272,6 +383,7 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts,
             << G4endl;
 #endif
    }
+   BuildSafetyGrid(tVolume);
 
    // Scan recursively the associated logical volume tree
    //
@@ -296,6 +408,7 @@ void G4GeometryManager::DeleteOptimisations()
     tVolume=n;
     delete tVolume->GetVoxelHeader();
     tVolume->SetVoxelHeader(nullptr);
+    DeleteSafetyGrid(tVolume);
   }
 }
 
@@ -315,6 +428,7 @@ void G4GeometryManager::DeleteOptimisations(G4VPhysicalVolume* pVolume)
   if (tVolume == nullptr) { return DeleteOptimisations(); }
   delete tVolume->GetVoxelHeader();
   tVolume->SetVoxelHeader(nullptr);
+  DeleteSafetyGrid(tVolume);
 
   // Scan recursively the associated logical volume tree
   //
@@ -325,6 +439,38 @@ void G4GeometryManager::DeleteOptimisations(G4VPhysicalVolume* pVolume)
   }
 }
 
+// ***************************************************************************
+// Creates the grid of safety bounds for a logical volume, if requested.
+// Applicable only to volumes whose daughters are all placements.
+// ***************************************************************************
+//
+void G4GeometryManager::BuildSafetyGrid(G4LogicalVolume* volume)
+{
+  DeleteSafetyGrid(volume);
+  if (volume->GetSafetyGridSize() <= 0) { return; }
+  if (volume->CharacteriseDaughters() != kNormal)
+  {
+    std::ostringstream message;
+    message << "Grid of safety bounds not applicable for volume "
+            << volume->GetName() << G4endl
+            << "Daughters are not placements; request ignored.";
+    G4Exception("G4GeometryManager::BuildSafetyGrid()", "GeomMgt1002",
+                JustWarning, message);
+    return;
+  }
+  volume->SetSafetyGrid(new G4SafetyGrid(volume, volume->GetSafetyGridSize()));
+}
+
+// ***************************************************************************
+// Removes the grid of safety bounds for a logical volume, if present.
+// ***************************************************************************
+//
+void G4GeometryManager::DeleteSafetyGrid(G4LogicalVolume* volume)
+{
+  delete volume->GetSafetyGrid();
+  volume->SetSafetyGrid(nullptr);
+}
+
 // ***************************************************************************
 // Sets the maximum extent of the world volume. The operation is allowed only
 // if NO solids have been created already.
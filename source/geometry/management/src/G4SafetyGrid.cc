@@ -0,0 +1,189 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SafetyGrid implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "G4SafetyGrid.hh"
+#include "G4AffineTransform.hh"
+#include "G4TaskDispatcher.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+
+namespace
+{
+  // Daughter volume, with its extent in the frame of the mother
+  //
+  struct G4SafetyGridDaughter
+  {
+    const G4VSolid* solid;
+    G4AffineTransform transform;  // From mother to daughter frame
+    G4ThreeVector pmin, pmax;
+  };
+
+  // Distance from a point to an axis-aligned box, zero if inside
+  //
+  inline G4double DistanceToBox(const G4ThreeVector& p,
+                                const G4ThreeVector& pmin,
+                                const G4ThreeVector& pmax)
+  {
+    G4double dx = std::max(std::max(pmin.x() - p.x(), p.x() - pmax.x()), 0.);
+    G4double dy = std::max(std::max(pmin.y() - p.y(), p.y() - pmax.y()), 0.);
+    G4double dz = std::max(std::max(pmin.z() - p.z(), p.z() - pmax.z()), 0.);
+    return std::sqrt(dx*dx + dy*dy + dz*dz);
+  }
+}
+
+G4long G4SafetyGrid::fMaxMemory = 128*1024*1024;
+
+////////////////////////////////////////////////////////////////////////
+//
+// Constructor - build the grid
+
+G4SafetyGrid::G4SafetyGrid(const G4LogicalVolume* pVolume, G4int nMaxCells)
+{
+  const G4VSolid* solid = pVolume->GetSolid();
+  G4ThreeVector pmax;
+  solid->BoundingLimits(fMin, pmax);
+
+  // Set cells, of similar size along the three axes
+  //
+  G4ThreeVector extent = pmax - fMin;
+  G4double maxExtent = std::max(std::max(extent.x(), extent.y()), extent.z());
+  G4double size = maxExtent/std::max(nMaxCells, 1);
+
+  // Enlarge the cells, if needed, to stay within the memory budget
+  //
+  G4double maxCells = std::max((G4double)fMaxMemory/sizeof(G4float), 1.);
+  for (;;)
+  {
+    fNx = std::max((G4int)std::ceil(extent.x()/size - 1.e-6), 1);
+    fNy = std::max((G4int)std::ceil(extent.y()/size - 1.e-6), 1);
+    fNz = std::max((G4int)std::ceil(extent.z()/size - 1.e-6), 1);
+    G4double ncells = (G4double)fNx*fNy*fNz;
+    if (ncells <= maxCells) { break; }
+    size *= std::max(std::cbrt(ncells/maxCells), 1.01);
+  }
+  if (size > 1.001*maxExtent/std::max(nMaxCells, 1))
+  {
+    std::ostringstream message;
+    message << "Grid of safety bounds for volume " << pVolume->GetName()
+            << " reduced to " << std::max(std::max(fNx, fNy), fNz)
+            << " cells along the largest dimension, instead of "
+            << nMaxCells << "," << G4endl
+            << "to fit in the memory budget of " << fMaxMemory
+            << " bytes (see G4SafetyGrid::SetMaxMemory()).";
+    G4Exception("G4SafetyGrid::G4SafetyGrid()", "GeomMgt1001",
+                JustWarning, message);
+  }
+  fCell.set(extent.x()/fNx, extent.y()/fNy, extent.z()/fNz);
+  fInvCell.set(1./fCell.x(), 1./fCell.y(), 1./fCell.z());
+  G4double halfDiagonal = 0.5*fCell.mag();
+  fMinUseful = 2.*halfDiagonal;
+
+  // Collect daughters, with their extent in the frame of the volume
+  //
+  std::vector<G4SafetyGridDaughter> daughters;
+  std::size_t ndaughters = pVolume->GetNoDaughters();
+  daughters.reserve(ndaughters);
+  for (std::size_t i=0; i<ndaughters; ++i)
+  {
+    const G4VPhysicalVolume* pv = pVolume->GetDaughter(i);
+    const G4VSolid* dsolid = pv->GetLogicalVolume()->GetSolid();
+    G4AffineTransform tf(pv->GetRotation(), pv->GetTranslation());
+    G4ThreeVector dmin, dmax;
+    dsolid->BoundingLimits(dmin, dmax);
+    G4ThreeVector bmin( kInfinity, kInfinity, kInfinity);
+    G4ThreeVector bmax(-kInfinity,-kInfinity,-kInfinity);
+    for (G4int k=0; k<8; ++k)
+    {
+      G4ThreeVector corner((k & 1) != 0 ? dmax.x() : dmin.x(),
+                           (k & 2) != 0 ? dmax.y() : dmin.y(),
+                           (k & 4) != 0 ? dmax.z() : dmin.z());
+      corner = tf.TransformPoint(corner);
+      bmin.set(std::min(bmin.x(), corner.x()),
+               std::min(bmin.y(), corner.y()),
+               std::min(bmin.z(), corner.z()));
+      bmax.set(std::max(bmax.x(), corner.x()),
+               std::max(bmax.y(), corner.y()),
+               std::max(bmax.z(), corner.z()));
+    }
+    tf.Invert();
+    daughters.push_back({dsolid, tf, bmin, bmax});
+  }
+
+  // Compute the bounds, one layer along z per task. Safety computations
+  // are const and used concurrently by worker threads while tracking
+  //
+  fValues.assign((std::size_t)fNx*fNy*fNz, 0.f);
+  G4TaskDispatcher::Execute(fNz, [&](G4int iz)
+  {
+    for (G4int iy=0; iy<fNy; ++iy)
+    {
+      for (G4int ix=0; ix<fNx; ++ix)
+      {
+        G4ThreeVector centre(fMin.x() + (ix + 0.5)*fCell.x(),
+                             fMin.y() + (iy + 0.5)*fCell.y(),
+                             fMin.z() + (iz + 0.5)*fCell.z());
+        if (solid->Inside(centre) == kOutside) { continue; }
+        G4double safety = solid->DistanceToOut(centre);
+        for (const auto& daughter : daughters)
+        {
+          if (safety <= halfDiagonal) { break; }
+          if (DistanceToBox(centre, daughter.pmin, daughter.pmax) >= safety)
+          {
+            continue;
+          }
+          G4ThreeVector p = daughter.transform.TransformPoint(centre);
+          safety = std::min(safety, daughter.solid->DistanceToIn(p));
+        }
+        if (safety <= halfDiagonal) { continue; }
+
+        // Round down to single precision
+        //
+        G4double bound = safety - halfDiagonal;
+        auto value = (G4float)bound;
+        if (value > bound) { value = std::nextafter(value, 0.f); }
+        fValues[((std::size_t)iz*fNy + iy)*fNx + ix] = value;
+      }
+    }
+  });
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// GetMemoryUse
+
+G4long G4SafetyGrid::GetMemoryUse() const
+{
+  return (G4long)(sizeof(G4SafetyGrid) + fValues.capacity()*sizeof(G4float));
+}
@@ -747,7 +747,7 @@ G4ProxyVector* G4SmartVoxelHeader::BuildNodes(G4LogicalVolume* pVolume,
            targetMinExtent= kInfinity, targetMaxExtent= -kInfinity;
   G4VPhysicalVolume* pDaughter = nullptr;
   G4VPVParameterisation* pParam = nullptr;
-  G4VSolid *targetSolid;
+  G4VSolid *targetSolid = nullptr;
   G4AffineTransform targetTransform;
   G4bool replicated;
   std::size_t nCandidates = pCandidates->size();
@@ -806,8 +806,10 @@ G4ProxyVector* G4SmartVoxelHeader::BuildNodes(G4LogicalVolume* pVolume,
     
   // Compute extents
   //
+  G4ThreeVector targetBoxMin, targetBoxMax;
   for (nVol=0; nVol<nCandidates; ++nVol)
   {
+    G4bool extentKnown = false;
     targetVolNo = (*pCandidates)[nVol];
     if (!replicated)
     {
@@ -821,6 +823,34 @@ G4ProxyVector* G4SmartVoxelHeader::BuildNodes(G4LogicalVolume* pVolume,
       //
       targetSolid = pDaughter->GetLogicalVolume()->GetSolid();
     }
+    else if (pParam->ComputeExtent((G4int)targetVolNo, pDaughter,
+                                   targetBoxMin, targetBoxMax))
+    {
+      // Bounding box provided directly by the parameterisation:
+      // clip it to the limits if it intersects them, as done by
+      // the solids in CalculateExtent()
+      //
+      targetMinExtent = targetBoxMin(pAxis);
+      targetMaxExtent = targetBoxMax(pAxis);
+      G4bool intersecting = true;
+      for (auto ax : { kXAxis, kYAxis, kZAxis })
+      {
+        if ( (targetBoxMax(ax) < pLimits.GetMinExtent(ax))
+          || (targetBoxMin(ax) > pLimits.GetMaxExtent(ax)) )
+        {
+          intersecting = false;
+          break;
+        }
+      }
+      if (intersecting && pLimits.IsLimited(pAxis))
+      {
+        targetMinExtent = std::max(targetMinExtent,
+                                   pLimits.GetMinExtent(pAxis));
+        targetMaxExtent = std::min(targetMaxExtent,
+                                   pLimits.GetMaxExtent(pAxis));
+      }
+      extentKnown = true;
+    }
     else
     {
       // Find  solid
@@ -839,8 +869,9 @@ G4ProxyVector* G4SmartVoxelHeader::BuildNodes(G4LogicalVolume* pVolume,
     }
     // Calculate extents
     //
-    if(!targetSolid->CalculateExtent(pAxis, pLimits, targetTransform,
-                                     targetMinExtent, targetMaxExtent))
+    if ( !extentKnown
+      && !targetSolid->CalculateExtent(pAxis, pLimits, targetTransform,
+                                       targetMinExtent, targetMaxExtent) )
     {
       targetSolid->CalculateExtent(pAxis, noLimits, targetTransform,
                                    targetMinExtent,targetMaxExtent);
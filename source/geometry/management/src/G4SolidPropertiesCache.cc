@@ -0,0 +1,254 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SolidPropertiesCache implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "G4SolidPropertiesCache.hh"
+#include "G4VSolid.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4TaskDispatcher.hh"
+#include "G4AutoLock.hh"
+
+namespace
+{
+  G4Mutex cacheMutex = G4MUTEX_INITIALIZER;
+}
+
+// ***************************************************************************
+// Static class data
+// ***************************************************************************
+//
+G4SolidPropertiesCache* G4SolidPropertiesCache::fInstance = nullptr;
+
+// ***************************************************************************
+// Return ptr to singleton instance of the class, creating it if necessary
+// ***************************************************************************
+//
+G4SolidPropertiesCache* G4SolidPropertiesCache::GetInstance()
+{
+  static G4SolidPropertiesCache cache;
+  if (fInstance == nullptr)
+  {
+    fInstance = &cache;
+  }
+  return fInstance;
+}
+
+// ***************************************************************************
+// Destructor
+// ***************************************************************************
+//
+G4SolidPropertiesCache::~G4SolidPropertiesCache()
+{
+  fInstance = nullptr;
+}
+
+// ***************************************************************************
+// Return the cached estimate of the cubic volume, computing it if needed.
+// The lock is released during the estimation, so that other solids can be
+// served meanwhile; concurrent estimates of the same solid are identical.
+// ***************************************************************************
+//
+G4double G4SolidPropertiesCache::GetCubicVolume(const G4VSolid* pSolid,
+                                                G4int nStat, G4double epsilon)
+{
+  G4AutoLock l(&cacheMutex);
+  auto pos = fCache.find(pSolid);
+  Entry* entry = (pos != fCache.end()) ? &pos->second : Restore(pSolid);
+  if ((entry != nullptr) && (entry->volume >= 0.)) { return entry->volume; }
+  l.unlock();
+
+  G4double volume = pSolid->EstimateCubicVolume(nStat, epsilon, fPrecision);
+
+  l.lock();
+  Entry& value = fCache[pSolid];
+  if (value.volume < 0.) { value.volume = volume; }
+  return value.volume;
+}
+
+// ***************************************************************************
+// Return the cached estimate of the surface area, computing it if needed.
+// ***************************************************************************
+//
+G4double G4SolidPropertiesCache::GetSurfaceArea(const G4VSolid* pSolid,
+                                                G4int nStat, G4double ell)
+{
+  G4AutoLock l(&cacheMutex);
+  auto pos = fCache.find(pSolid);
+  Entry* entry = (pos != fCache.end()) ? &pos->second : Restore(pSolid);
+  if ((entry != nullptr) && (entry->area >= 0.)) { return entry->area; }
+  l.unlock();
+
+  G4double area = pSolid->EstimateSurfaceArea(nStat, ell, fPrecision);
+
+  l.lock();
+  Entry& value = fCache[pSolid];
+  if (value.area < 0.) { value.area = area; }
+  return value.area;
+}
+
+// ***************************************************************************
+// Remove the estimates for a solid
+// ***************************************************************************
+//
+void G4SolidPropertiesCache::Invalidate(const G4VSolid* pSolid)
+{
+  G4AutoLock l(&cacheMutex);
+  fCache.erase(pSolid);
+}
+
+// ***************************************************************************
+// Remove the estimates for a solid being deleted, if the cache exists
+// ***************************************************************************
+//
+void G4SolidPropertiesCache::DeRegister(const G4VSolid* pSolid)
+{
+  if (fInstance != nullptr) { fInstance->Invalidate(pSolid); }
+}
+
+// ***************************************************************************
+// Remove all estimates
+// ***************************************************************************
+//
+void G4SolidPropertiesCache::Clear()
+{
+  G4AutoLock l(&cacheMutex);
+  fCache.clear();
+  fRestored.clear();
+}
+
+// ***************************************************************************
+// Execute a set of independent batches, on the thread pool if enabled
+// ***************************************************************************
+//
+void G4SolidPropertiesCache::ForEachBatch(G4int nbatch,
+                                 const std::function<void(G4int)>& func)
+{
+  if (!GetInstance()->fParallel)
+  {
+    for (G4int i=0; i<nbatch; ++i) { func(i); }
+    return;
+  }
+  G4TaskDispatcher::Execute(nbatch, func);
+}
+
+// ***************************************************************************
+// Write the estimates, sorted by solid name for reproducible output
+// ***************************************************************************
+//
+void G4SolidPropertiesCache::Store(std::ostream& os) const
+{
+  G4AutoLock l(&cacheMutex);
+  std::vector<std::pair<const G4VSolid*, Entry>> entries(fCache.cbegin(),
+                                                         fCache.cend());
+  l.unlock();
+
+  std::sort(entries.begin(), entries.end(),
+            [](const std::pair<const G4VSolid*, Entry>& a,
+               const std::pair<const G4VSolid*, Entry>& b)
+            { return a.first->GetName() < b.first->GetName(); });
+
+  std::ios::fmtflags oldflags = os.flags();
+  std::streamsize oldprec = os.precision(17);
+  for (const auto& item : entries)
+  {
+    G4ThreeVector bmin, bmax;
+    item.first->BoundingLimits(bmin, bmax);
+    os << std::quoted(item.first->GetName()) << " "
+       << std::quoted(item.first->GetEntityType()) << " "
+       << bmin.x() << " " << bmin.y() << " " << bmin.z() << " "
+       << bmax.x() << " " << bmax.y() << " " << bmax.z() << " "
+       << item.second.volume << " " << item.second.area << "\n";
+  }
+  os.precision(oldprec);
+  os.flags(oldflags);
+}
+
+// ***************************************************************************
+// Read estimates written by Store()
+// ***************************************************************************
+//
+G4int G4SolidPropertiesCache::Retrieve(std::istream& is)
+{
+  G4int nread = 0;
+  std::string line;
+  G4AutoLock l(&cacheMutex);
+  while (std::getline(is, line))
+  {
+    std::istringstream ss(line);
+    std::string name, type;
+    G4double x0, y0, z0, x1, y1, z1;
+    Persisted item;
+    if (ss >> std::quoted(name) >> std::quoted(type)
+           >> x0 >> y0 >> z0 >> x1 >> y1 >> z1
+           >> item.values.volume >> item.values.area)
+    {
+      item.type = type;
+      item.bmin.set(x0, y0, z0);
+      item.bmax.set(x1, y1, z1);
+      fRestored.insert(std::make_pair(G4String(name), item));
+      ++nread;
+    }
+  }
+  return nread;
+}
+
+// ***************************************************************************
+// Look up restored estimates matching the solid
+// ***************************************************************************
+//
+G4SolidPropertiesCache::Entry*
+G4SolidPropertiesCache::Restore(const G4VSolid* pSolid)
+{
+  if (fRestored.empty()) { return nullptr; }
+
+  auto range = fRestored.equal_range(pSolid->GetName());
+  if (range.first == range.second) { return nullptr; }
+
+  G4double tol = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  G4ThreeVector bmin, bmax;
+  pSolid->BoundingLimits(bmin, bmax);
+  for (auto pos = range.first; pos != range.second; ++pos)
+  {
+    const Persisted& item = pos->second;
+    if (item.type == pSolid->GetEntityType()
+     && (item.bmin - bmin).mag() < tol && (item.bmax - bmax).mag() < tol)
+    {
+      Entry& value = fCache[pSolid];
+      value = item.values;
+      fRestored.erase(pos);
+      return &value;
+    }
+  }
+  return nullptr;
+}
@@ -63,3 +63,12 @@ G4VPVParameterisation::GetMaterialScanner()
 {
   return nullptr;
 }
+
+// --------------------------------------------------------------------
+G4bool
+G4VPVParameterisation::ComputeExtent(const G4int,
+                                     const G4VPhysicalVolume*,
+                                     G4ThreeVector&, G4ThreeVector&) const
+{
+  return false;
+}
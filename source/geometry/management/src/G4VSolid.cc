@@ -31,14 +31,49 @@
 
 #include "G4VSolid.hh"
 #include "G4SolidStore.hh"
+#include "G4SolidPropertiesCache.hh"
 #include "globals.hh"
-#include "G4QuickRand.hh"
 #include "G4GeometryTolerance.hh"
 
 #include "G4VoxelLimits.hh"
 #include "G4AffineTransform.hh"
 #include "G4VisExtent.hh"
 
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+  // Random points for the estimation of volume and surface area are
+  // generated in batches of fixed size, each one with its own seed, so
+  // that the result does not depend on the number of threads used.
+  // Batches are processed in rounds, after which the statistical
+  // precision is checked.
+  //
+  const G4int kBatchSize = 50000;
+  const G4int kBatchesPerRound = 16;
+
+  inline uint32_t BatchSeed(G4int ibatch)
+  {
+    uint32_t z = 0x9E3779B9u * (uint32_t)(ibatch + 1);
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    z ^= z >> 16;
+    return (z == 0) ? 2463534242u : z;
+  }
+
+  inline G4double BatchRand(uint32_t& y)
+  {
+    // Algorithm "xor" from p.4 of G.Marsaglia, "Xorshift RNGs",
+    // as in G4QuickRand(), but with explicit state
+    //
+    y ^= y << 13;
+    y ^= y >> 17;
+    y ^= y << 5;
+    return y * (1. / 4294967296.);
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // Streaming operator dumping solid contents
@@ -98,6 +133,7 @@ G4VSolid::G4VSolid( __void__& )
 G4VSolid::~G4VSolid()
 {
     G4SolidStore::GetInstance()->DeRegister(this);
+    G4SolidPropertiesCache::DeRegister(this);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -196,16 +232,17 @@ G4double G4VSolid::GetCubicVolume()
 //
 // Calculate cubic volume based on Inside() method.
 // Accuracy is limited by the second argument or the statistics
-// expressed by the first argument.
+// expressed by the first argument. If precision is positive, the
+// sampling stops as soon as the relative statistical error of the
+// estimate is below it. Batches of points are distributed on the
+// thread pool, if available (see G4SolidPropertiesCache).
 // Implementation is courtesy of Vasiliki Despoina Mitsou,
 // University of Athens.
 
-G4double G4VSolid::EstimateCubicVolume(G4int nStat, G4double epsilon) const
+G4double G4VSolid::EstimateCubicVolume(G4int nStat, G4double epsilon,
+                                       G4double precision) const
 {
-  G4int iInside=0;
-  G4double px,py,pz,minX,maxX,minY,maxY,minZ,maxZ,volume,halfepsilon;
-  G4ThreeVector p;
-  EInside in;
+  G4double minX,maxX,minY,maxY,minZ,maxZ,halfepsilon;
 
   // values needed for CalculateExtent signature
 
@@ -224,18 +261,45 @@ G4double G4VSolid::EstimateCubicVolume(G4int nStat, G4double epsilon) const
   if(epsilon > 0.01) epsilon = 0.01;
   halfepsilon = 0.5*epsilon;
 
-  for(auto i = 0; i < nStat; ++i )
+  G4double dX = maxX-minX+epsilon;
+  G4double dY = maxY-minY+epsilon;
+  G4double dZ = maxZ-minZ+epsilon;
+  minX -= halfepsilon;
+  minY -= halfepsilon;
+  minZ -= halfepsilon;
+
+  G4int nbatch = (nStat + kBatchSize - 1)/kBatchSize;
+  std::vector<G4long> counts(nbatch, 0);
+  G4long iInside = 0, iTotal = 0;
+
+  for (G4int ifirst = 0; ifirst < nbatch; ifirst += kBatchesPerRound)
   {
-    px = minX-halfepsilon+(maxX-minX+epsilon)*G4QuickRand();
-    py = minY-halfepsilon+(maxY-minY+epsilon)*G4QuickRand();
-    pz = minZ-halfepsilon+(maxZ-minZ+epsilon)*G4QuickRand();
-    p  = G4ThreeVector(px,py,pz);
-    in = Inside(p);
-    if(in != kOutside) ++iInside;
+    G4int nround = std::min(kBatchesPerRound, nbatch - ifirst);
+    G4SolidPropertiesCache::ForEachBatch(nround, [&](G4int k)
+    {
+      G4int ibatch = ifirst + k;
+      G4int npoints = std::min(kBatchSize, nStat - ibatch*kBatchSize);
+      uint32_t y = BatchSeed(ibatch);
+      G4long count = 0;
+      for (auto i = 0; i < npoints; ++i)
+      {
+        G4double px = minX + dX*BatchRand(y);
+        G4double py = minY + dY*BatchRand(y);
+        G4double pz = minZ + dZ*BatchRand(y);
+        if (Inside(G4ThreeVector(px,py,pz)) != kOutside) ++count;
+      }
+      counts[ibatch] = count;
+    });
+    for (G4int k = 0; k < nround; ++k)
+    {
+      G4int ibatch = ifirst + k;
+      iInside += counts[ibatch];
+      iTotal += std::min(kBatchSize, nStat - ibatch*kBatchSize);
+    }
+    if (precision > 0. && iInside > 0 &&
+        G4double(iTotal - iInside) < precision*precision*iTotal*iInside) break;
   }
-  volume = (maxX-minX+epsilon)*(maxY-minY+epsilon)
-         * (maxZ-minZ+epsilon)*iInside/nStat;
-  return volume;
+  return dX*dY*dZ*iInside/iTotal;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -259,10 +323,13 @@ G4double G4VSolid::GetSurfaceArea()
 // Calculate surface area by estimating volume of a thin shell
 // surrounding the surface using Monte-Carlo method.
 // Input parameters:
-//    nstat - statistics (number of random points)
-//    eps   - shell thinkness
+//    nstat     - statistics (number of random points)
+//    eps       - shell thinkness
+//    precision - if positive, relative statistical error at which
+//                the sampling can be stopped before reaching nstat
 
-G4double G4VSolid::EstimateSurfaceArea(G4int nstat, G4double ell) const
+G4double G4VSolid::EstimateSurfaceArea(G4int nstat, G4double ell,
+                                       G4double precision) const
 {
   static const G4double s2 = 1./std::sqrt(2.);
   static const G4double s3 = 1./std::sqrt(3.);
@@ -334,51 +401,78 @@ G4double G4VSolid::EstimateSurfaceArea(G4int nstat, G4double ell) const
 
   // Calculate surface area
   //
-  G4int icount = 0;
-  for(auto i = 0; i < npoints; ++i)
+  auto countInShell = [&](G4int ibatch, G4int nbatchpoints) -> G4long
   {
-    G4double px = minX + dX*G4QuickRand();
-    G4double py = minY + dY*G4QuickRand();
-    G4double pz = minZ + dZ*G4QuickRand();
-    G4ThreeVector p  = G4ThreeVector(px, py, pz);
-    EInside in = Inside(p);
-    G4double dist = 0;
-    if (in == kInside)
+    uint32_t y = BatchSeed(ibatch);
+    G4long icount = 0;
+    for(auto i = 0; i < nbatchpoints; ++i)
     {
-      if (DistanceToOut(p) >= eps) continue;
-      G4int icase = 0;
-      if (Inside(G4ThreeVector(px-del, py, pz)) != kInside) icase += 1;
-      if (Inside(G4ThreeVector(px+del, py, pz)) != kInside) icase += 2;
-      if (Inside(G4ThreeVector(px, py-del, pz)) != kInside) icase += 4;
-      if (Inside(G4ThreeVector(px, py+del, pz)) != kInside) icase += 8;
-      if (Inside(G4ThreeVector(px, py, pz-del)) != kInside) icase += 16;
-      if (Inside(G4ThreeVector(px, py, pz+del)) != kInside) icase += 32;
-      if (icase == 0) continue;
-      G4ThreeVector v = directions[icase];
-      dist = DistanceToOut(p, v);
-      G4ThreeVector n = SurfaceNormal(p + v*dist);
-      dist *= v.dot(n);
+      G4double px = minX + dX*BatchRand(y);
+      G4double py = minY + dY*BatchRand(y);
+      G4double pz = minZ + dZ*BatchRand(y);
+      G4ThreeVector p  = G4ThreeVector(px, py, pz);
+      EInside in = Inside(p);
+      G4double dist = 0;
+      if (in == kInside)
+      {
+        if (DistanceToOut(p) >= eps) continue;
+        G4int icase = 0;
+        if (Inside(G4ThreeVector(px-del, py, pz)) != kInside) icase += 1;
+        if (Inside(G4ThreeVector(px+del, py, pz)) != kInside) icase += 2;
+        if (Inside(G4ThreeVector(px, py-del, pz)) != kInside) icase += 4;
+        if (Inside(G4ThreeVector(px, py+del, pz)) != kInside) icase += 8;
+        if (Inside(G4ThreeVector(px, py, pz-del)) != kInside) icase += 16;
+        if (Inside(G4ThreeVector(px, py, pz+del)) != kInside) icase += 32;
+        if (icase == 0) continue;
+        G4ThreeVector v = directions[icase];
+        dist = DistanceToOut(p, v);
+        G4ThreeVector n = SurfaceNormal(p + v*dist);
+        dist *= v.dot(n);
+      }
+      else if (in == kOutside)
+      {
+        if (DistanceToIn(p) >= eps) continue;
+        G4int icase = 0;
+        if (Inside(G4ThreeVector(px-del, py, pz)) != kOutside) icase += 1;
+        if (Inside(G4ThreeVector(px+del, py, pz)) != kOutside) icase += 2;
+        if (Inside(G4ThreeVector(px, py-del, pz)) != kOutside) icase += 4;
+        if (Inside(G4ThreeVector(px, py+del, pz)) != kOutside) icase += 8;
+        if (Inside(G4ThreeVector(px, py, pz-del)) != kOutside) icase += 16;
+        if (Inside(G4ThreeVector(px, py, pz+del)) != kOutside) icase += 32;
+        if (icase == 0) continue;
+        G4ThreeVector v = directions[icase];
+        dist = DistanceToIn(p, v);
+        if (dist == kInfinity) continue;
+        G4ThreeVector n = SurfaceNormal(p + v*dist);
+        dist *= -(v.dot(n));
+      }
+      if (dist < eps) ++icount;
     }
-    else if (in == kOutside)
+    return icount;
+  };
+
+  G4int nbatch = (npoints + kBatchSize - 1)/kBatchSize;
+  std::vector<G4long> counts(nbatch, 0);
+  G4long icount = 0, itotal = 0;
+
+  for (G4int ifirst = 0; ifirst < nbatch; ifirst += kBatchesPerRound)
+  {
+    G4int nround = std::min(kBatchesPerRound, nbatch - ifirst);
+    G4SolidPropertiesCache::ForEachBatch(nround, [&](G4int k)
+    {
+      G4int ibatch = ifirst + k;
+      counts[ibatch] =
+        countInShell(ibatch, std::min(kBatchSize, npoints - ibatch*kBatchSize));
+    });
+    for (G4int k = 0; k < nround; ++k)
     {
-      if (DistanceToIn(p) >= eps) continue;
-      G4int icase = 0;
-      if (Inside(G4ThreeVector(px-del, py, pz)) != kOutside) icase += 1;
-      if (Inside(G4ThreeVector(px+del, py, pz)) != kOutside) icase += 2;
-      if (Inside(G4ThreeVector(px, py-del, pz)) != kOutside) icase += 4;
-      if (Inside(G4ThreeVector(px, py+del, pz)) != kOutside) icase += 8;
-      if (Inside(G4ThreeVector(px, py, pz-del)) != kOutside) icase += 16;
-      if (Inside(G4ThreeVector(px, py, pz+del)) != kOutside) icase += 32;
-      if (icase == 0) continue;
-      G4ThreeVector v = directions[icase];
-      dist = DistanceToIn(p, v);
-      if (dist == kInfinity) continue;
-      G4ThreeVector n = SurfaceNormal(p + v*dist);
-      dist *= -(v.dot(n));
+      G4int ibatch = ifirst + k;
+      icount += counts[ibatch];
+      itotal += std::min(kBatchSize, npoints - ibatch*kBatchSize);
     }
-    if (dist < eps) ++icount;
+    if (precision > 0. && icount > 0 && 1. < precision*precision*icount) break;
   }
-  return dX*dY*dZ*icount/npoints/dd;
+  return dX*dY*dZ*icount/itotal/dd;
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4FieldParametersTuner
+//
+// Class description:
+//
+// Calibration of the parameters of propagation in field for a region.
+// Sample tracks, of given charge and mass and with momenta log-uniformly
+// distributed in a given range, start at random points of the region in
+// random directions and are propagated through the geometry over a fixed
+// length, first at reference accuracy and then with trial parameters,
+// using the field manager of the region.
+//
+// For each available type of stepper and driver, the accuracy parameters
+// (maximum and minimum epsilon, delta one step and delta intersection)
+// are loosened in turn, as long as the end points of all tracks agree
+// with the reference ones within the position and relative momentum
+// tolerances requested. The fastest of the configurations obtained is
+// chosen and written as the /geometry/field/ commands applying it, to
+// be used in following jobs. The field manager of the region is left
+// unchanged.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4FIELDPARAMETERSTUNER_HH
+#define G4FIELDPARAMETERSTUNER_HH
+
+#include <iosfwd>
+#include <vector>
+
+#include "G4ThreeVector.hh"
+#include "G4String.hh"
+
+class G4Region;
+class G4FieldManager;
+class G4Navigator;
+class G4PropagatorInField;
+class G4MagneticField;
+
+class G4FieldParametersTuner
+{
+  public:  // with description
+
+    struct Settings
+    {
+      G4int fStepperType = 0;
+      G4double fMaxEpsilonStep = 0.0;
+      G4double fMinEpsilonStep = 0.0;
+      G4double fDeltaOneStep = 0.0;
+      G4double fDeltaIntersection = 0.0;
+    };
+
+    G4FieldParametersTuner() = default;
+    ~G4FieldParametersTuner() = default;
+
+    inline void SetParticle(G4double charge, G4double mass);
+      // Charge (in units of the positron charge) and mass of the tracks.
+    inline void SetMomentumRange(G4double pMin, G4double pMax);
+    inline void SetNumberOfTracks(G4int n);
+    inline void SetTrackLength(G4double length);
+      // Sample of tracks and length over which they are propagated.
+    inline void SetPositionTolerance(G4double value);
+    inline void SetMomentumTolerance(G4double value);
+      // Maximum deviations of the end points from the reference ones:
+      // absolute for the position, relative for the momentum.
+
+    G4bool Tune(const G4String& regionName, std::ostream& macro);
+      // Runs the calibration for the region named 'regionName' and
+      // writes the commands applying the configuration chosen to
+      // 'macro'. Returns false if no configuration satisfies the
+      // tolerances, or the calibration could not be done.
+
+    static G4FieldManager* GetFieldManager(const G4Region* region);
+      // Returns the field manager used in 'region': that of the region,
+      // if any, else that of its first root logical volume having one,
+      // else the global field manager.
+
+  private:
+
+    struct SampleTrack
+    {
+      G4ThreeVector fPosition;
+      G4ThreeVector fDirection;
+      G4double fMomentum = 0.0;
+    };
+    struct EndPoint
+    {
+      G4ThreeVector fPosition;
+      G4ThreeVector fMomentum;
+    };
+
+    G4bool GenerateSample(const G4Region* region);
+    G4double Propagate(const Settings& settings,
+                       std::vector<EndPoint>& endPoints);
+      // Propagates the sample with 'settings' applied to the field
+      // manager and returns the time taken. A negative stepper type
+      // keeps the current chord finder.
+    G4bool IsAccurate(const std::vector<EndPoint>& endPoints) const;
+    G4bool Optimise(Settings& settings);
+      // Loosens in turn the accuracy parameters in 'settings', starting
+      // from tight values, while the tolerances are met. Returns false
+      // if they are not met even with the tight values.
+
+  private:
+
+    G4double fCharge = -1.0;
+    G4double fMass = 0.51099895;  // electron, in MeV
+    G4double fMinMomentum = 10.0;  // MeV
+    G4double fMaxMomentum = 1000.0;  // MeV
+    G4int fNumberOfTracks = 100;
+    G4double fTrackLength = 1000.0;  // mm
+    G4double fPositionTolerance = 1.0e-3;  // mm
+    G4double fMomentumTolerance = 1.0e-6;
+
+    std::vector<SampleTrack> fSample;
+    std::vector<EndPoint> fReference;
+
+    G4FieldManager* fFieldManager = nullptr;
+    G4MagneticField* fField = nullptr;
+    G4Navigator* fNavigator = nullptr;
+    G4PropagatorInField* fPropagator = nullptr;
+      // Valid during calibration only
+};
+
+// Inline methods
+
+inline void G4FieldParametersTuner::SetParticle(G4double charge,
+                                                G4double mass)
+{
+  fCharge = charge;
+  fMass = mass;
+}
+
+inline void G4FieldParametersTuner::SetMomentumRange(G4double pMin,
+                                                     G4double pMax)
+{
+  fMinMomentum = pMin;
+  fMaxMomentum = pMax;
+}
+
+inline void G4FieldParametersTuner::SetNumberOfTracks(G4int n)
+{
+  fNumberOfTracks = n;
+}
+
+inline void G4FieldParametersTuner::SetTrackLength(G4double length)
+{
+  fTrackLength = length;
+}
+
+inline void G4FieldParametersTuner::SetPositionTolerance(G4double value)
+{
+  fPositionTolerance = value;
+}
+
+inline void G4FieldParametersTuner::SetMomentumTolerance(G4double value)
+{
+  fMomentumTolerance = value;
+}
+
+#endif
@@ -29,12 +29,20 @@
 //
 // Checks for inconsistencies in the geometric boundaries of a physical
 // volume and the boundaries of all its immediate daughters.
+// The volumes to be checked are first collected from the tree; checks
+// of placements are then distributed on the thread pool, if available
+// (see G4TaskDispatcher), each with random generators seeded from
+// its rank in the list. Results are reported at the end, in tree order,
+// so that the report does not depend on the number of threads used.
 
 // Author: G.Cosmo, CERN
 // --------------------------------------------------------------------
 #ifndef G4GeomTestVolume_hh
 #define G4GeomTestVolume_hh
 
+#include <set>
+#include <vector>
+
 #include "G4ThreeVector.hh"
 
 class G4VPhysicalVolume;
@@ -75,6 +83,18 @@ class G4GeomTestVolume
       // Be careful: depending on the complexity of the geometry, this
       // could require long computational time
 
+  private:
+
+    void CollectRecursive( G4VPhysicalVolume* volume,
+                           G4int sLevel, G4int depth,
+                           std::vector<G4VPhysicalVolume*>& volumes,
+                           std::set<G4VPhysicalVolume*>& collected ) const;
+      // Collect the volumes visited by TestRecursiveOverlap(), in the
+      // order of the recursion, each volume being included only once.
+
+    void CheckVolumes( const std::vector<G4VPhysicalVolume*>& volumes ) const;
+      // Check overlaps for the given volumes and report them in order.
+
   private:
 
     G4VPhysicalVolume *target;        // Target volume
@@ -44,9 +44,13 @@ class G4UIcommand;
 class G4UIcmdWithoutParameter;
 class G4UIcmdWithABool;
 class G4UIcmdWithAnInteger;
+class G4UIcmdWithADouble;
 class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
 class G4TransportationManager;
 class G4GeomTestVolume;
+class G4FieldManager;
+class G4FieldParametersTuner;
 
 #include <vector>
 
@@ -70,16 +74,35 @@ class G4GeometryMessenger : public G4UImessenger
     void SetCheckMode(const G4String& newValue);
     void SetPushFlag(const G4String& newValue);
     void RecursiveOverlapTest();
+    G4FieldManager* GetSelectedFieldManager();
+    void SetFieldParameter(G4UIcommand* command, const G4String& newValue);
+    void SetCalibrationParameter(G4UIcommand* command,
+                                 const G4String& newValue);
+    void RunCalibration(const G4String& newValue);
+    void PersistSolidEstimates(G4UIcommand* command, const G4String& fileName);
 
-    G4UIdirectory             *geodir, *navdir, *testdir;
-    G4UIcmdWithABool          *chkCmd, *pchkCmd, *verCmd, *parCmd;
-    G4UIcmdWithoutParameter   *recCmd, *resCmd;
+    G4UIdirectory             *geodir, *navdir, *testdir, *flddir;
+    G4UIcmdWithABool          *chkCmd, *pchkCmd, *verCmd, *parCmd, *fstCmd;
+    G4UIcmdWithABool          *fhlxCmd;
+    G4UIcmdWithoutParameter   *recCmd, *resCmd, *fprCmd, *frsCmd;
     G4UIcmdWithADoubleAndUnit *tolCmd;
     G4UIcmdWithAnInteger      *verbCmd, *rslCmd, *rcsCmd, *rcdCmd, *errCmd;
+    G4UIdirectory             *caldir;
+    G4UIcmdWithAString        *fregCmd;
+    G4UIcmdWithAnInteger      *fstpCmd, *fntCmd;
+    G4UIcmdWithADoubleAndUnit *fd1Cmd, *fdiCmd, *flenCmd, *fptCmd;
+    G4UIcmdWithADouble        *fmtCmd;
+    G4UIcommand               *fepsCmd, *fparCmd, *fmomCmd, *frunCmd;
+    G4UIdirectory             *soldir;
+    G4UIcmdWithADouble        *sprCmd;
+    G4UIcmdWithABool          *sparCmd;
+    G4UIcmdWithAString        *sstoCmd, *sretCmd;
 
     G4double tol = 0.0;
     G4int recLevel = 0, recDepth = -1;
     G4bool checkParallelWorlds = false;
+    G4String fieldRegion = "DefaultRegionForTheWorld";
+    G4FieldParametersTuner* tuner = nullptr;
 
     G4TransportationManager* tmanager;
     std::vector<G4GeomTestVolume*> tvolumes{};
@@ -191,6 +191,8 @@ class G4Navigator
     //  calculations.  The geometry must be closed.
     // To ensure minimum side effects from the call, keepState
     //  must be true.
+    // If the current volume has a grid of safety bounds (see G4SafetyGrid)
+    //  the bound is returned if large enough, without further computation.
 
   inline G4VPhysicalVolume* GetWorldVolume() const;
     // Return the current  world (`topmost') volume.
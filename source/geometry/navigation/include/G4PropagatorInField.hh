@@ -156,6 +156,14 @@ class G4PropagatorInField
    inline G4bool GetUseSafetyForOptimization();
      // Toggle & view parameter for using safety to discard 
      // unneccesary calls to navigator (thus 'optimising' performance)
+   inline void   SetUseExactHelix( G4bool );
+   inline G4bool GetUseExactHelix() const;
+     // Toggle & view the propagation along the exact helix in volumes
+     // where the field is a G4UniformMagField: the track is moved along
+     // the helix as far as the safety guarantees that no boundary is
+     // crossed, the chord finder and intersection locator being used
+     // only for the final approach to a boundary. Disabled by default.
+
    inline G4bool IntersectChord( const G4ThreeVector& StartPointA,
                                  const G4ThreeVector& EndPointB,
                                        G4double&      NewSafety,
@@ -222,6 +230,14 @@ class G4PropagatorInField
                                G4double stepRequest, const char* methodName,
                                const G4ThreeVector&      momentumVec,
                                G4VPhysicalVolume* physVol);
+   G4double AdvanceExactHelix( G4FieldTrack& state,
+                               G4double stepLength,
+                               G4double& startSafety );
+     // Move 'state' along the exact helix of a uniform magnetic field,
+     // by steps bounded by the safety, for at most 'stepLength'. Return
+     // the length advanced, zero if the field or equation of motion of
+     // the current field manager is not suited or the safety too small.
+
    void ReportStuckParticle(G4int noZeroSteps, G4double proposedStep,
                             G4double lastTriedStep, G4VPhysicalVolume* physVol);
 
@@ -240,6 +256,8 @@ class G4PropagatorInField
    G4int fIncreaseChordDistanceThreshold = 100;
    G4bool fUseSafetyForOptimisation = true;
      // (false) is less sensitive to incorrect safety
+   G4bool fUseExactHelix = false;
+     // Move along the exact helix in uniform magnetic fields
 
    //  Thresholds for identifying "abnormal" cases - which cause looping
    //
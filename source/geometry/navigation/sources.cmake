@@ -8,6 +8,7 @@ geant4_add_module(G4navigation
     G4BrentLocator.hh
     G4DrawVoxels.hh
     G4ErrorPropagationNavigator.hh
+    G4FieldParametersTuner.hh
     G4GeomTestVolume.hh
     G4GeometryMessenger.hh
     G4GlobalMagFieldMessenger.hh
@@ -47,6 +48,7 @@ geant4_add_module(G4navigation
     G4BrentLocator.cc
     G4DrawVoxels.cc
     G4ErrorPropagationNavigator.cc
+    G4FieldParametersTuner.cc
     G4GeomTestVolume.cc
     G4GeometryMessenger.cc
     G4GlobalMagFieldMessenger.cc
@@ -75,4 +77,4 @@ geant4_add_module(G4navigation
 
 geant4_module_link_libraries(G4navigation
   PUBLIC G4geometrymng G4magneticfield G4volumes G4graphics_reps G4globman G4intercoms G4hepgeometry
-  PRIVATE G4materials)
+  PRIVATE G4materials G4heprandom)
@@ -0,0 +1,487 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4FieldParametersTuner implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+#include "G4FieldParametersTuner.hh"
+
+#include "G4TransportationManager.hh"
+#include "G4Navigator.hh"
+#include "G4PropagatorInField.hh"
+#include "G4FieldManager.hh"
+#include "G4ChordFinder.hh"
+#include "G4MagneticField.hh"
+#include "G4EquationOfMotion.hh"
+#include "G4VIntegrationDriver.hh"
+#include "G4ChargeState.hh"
+#include "G4FieldTrack.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4Timer.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4ios.hh"
+
+#include "CLHEP/Random/MixMaxRng.h"
+
+namespace
+{
+  // Reference accuracy, and tight values the search starts from
+  //
+  const G4double kReferenceEpsilon = 1.0e-10;
+  const G4double kReferenceDeltaOneStep = 1.0e-7 * mm;
+  const G4double kReferenceDeltaIntersection = 1.0e-6 * mm;
+
+  const G4double kTightMaxEpsilon = 1.0e-7;
+  const G4double kTightMinEpsilon = 1.0e-9;
+  const G4double kTightDeltaOneStep = 1.0e-4 * mm;
+  const G4double kTightDeltaIntersection = 1.0e-5 * mm;
+
+  const G4double kMaxEpsilon = 1.0e-3;
+  const G4double kMaxDelta = 1.0 * mm;
+
+  const G4int kMaxStepsPerTrack = 100000;
+
+  void SetEpsilonSteps(G4FieldManager* fieldMgr,
+                       G4double epsMin, G4double epsMax)
+  {
+    // Order the changes so that minimum and maximum stay consistent
+    //
+    if (epsMin <= fieldMgr->GetMaximumEpsilonStep())
+    {
+      fieldMgr->SetMinimumEpsilonStep(epsMin);
+      fieldMgr->SetMaximumEpsilonStep(epsMax);
+    }
+    else
+    {
+      fieldMgr->SetMaximumEpsilonStep(epsMax);
+      fieldMgr->SetMinimumEpsilonStep(epsMin);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+G4FieldManager*
+G4FieldParametersTuner::GetFieldManager(const G4Region* region)
+{
+  G4FieldManager* fieldMgr = nullptr;
+  if (region != nullptr)
+  {
+    fieldMgr = region->GetFieldManager();
+    if (fieldMgr == nullptr)
+    {
+      auto lv = const_cast<G4Region*>(region)->GetRootLogicalVolumeIterator();
+      for (std::size_t i = 0; i < region->GetNumberOfRootVolumes(); ++i, ++lv)
+      {
+        if ((*lv)->GetFieldManager() != nullptr)
+        {
+          fieldMgr = (*lv)->GetFieldManager();
+          break;
+        }
+      }
+    }
+  }
+  if (fieldMgr == nullptr)
+  {
+    fieldMgr = G4TransportationManager::GetTransportationManager()
+             ->GetFieldManager();
+  }
+  return fieldMgr;
+}
+
+// --------------------------------------------------------------------
+G4bool G4FieldParametersTuner::Tune(const G4String& regionName,
+                                    std::ostream& macro)
+{
+  G4ExceptionDescription message;
+  const G4Region* region
+    = G4RegionStore::GetInstance()->GetRegion(regionName, false);
+  G4VPhysicalVolume* world = G4TransportationManager::
+    GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume();
+  fFieldManager = GetFieldManager(region);
+  fField = (fFieldManager != nullptr)
+         ? dynamic_cast<G4MagneticField*>(
+             const_cast<G4Field*>(fFieldManager->GetDetectorField()))
+         : nullptr;
+
+  if (region == nullptr)
+  {
+    message << "Region " << regionName << " not found !";
+  }
+  else if (world == nullptr)
+  {
+    message << "Geometry not yet constructed !";
+  }
+  else if (fField == nullptr || fFieldManager->GetChordFinder() == nullptr)
+  {
+    message << "No magnetic field in region " << regionName << " !";
+  }
+  else if (fCharge == 0.0 || fMinMomentum <= 0.0
+        || fMaxMomentum < fMinMomentum || fNumberOfTracks <= 0
+        || fTrackLength <= 0.0)
+  {
+    message << "Invalid sample of tracks: charge " << fCharge
+            << ", momenta [" << fMinMomentum << ", " << fMaxMomentum
+            << "] MeV, " << fNumberOfTracks << " tracks of length "
+            << fTrackLength << " mm !";
+  }
+  if (!message.str().empty())
+  {
+    G4Exception("G4FieldParametersTuner::Tune()", "GeomNav1002",
+                JustWarning, message);
+    return false;
+  }
+
+  G4Navigator navigator;
+  navigator.SetWorldVolume(world);
+  G4PropagatorInField propagator(&navigator, G4TransportationManager::
+    GetTransportationManager()->GetFieldManager());
+  fNavigator = &navigator;
+  fPropagator = &propagator;
+
+  G4bool success = GenerateSample(region);
+  if (!success)
+  {
+    message << "No point of region " << regionName
+            << " found in the extent of the world volume !";
+    G4Exception("G4FieldParametersTuner::Tune()", "GeomNav1002",
+                JustWarning, message);
+  }
+  else
+  {
+    G4cout << "G4FieldParametersTuner: tuning the field parameters of "
+           << "region " << regionName << " with " << fSample.size()
+           << " tracks ..." << G4endl;
+
+    Settings reference { G4ChordFinder::kTemplatedStepperType,
+                         kReferenceEpsilon, kReferenceEpsilon,
+                         kReferenceDeltaOneStep,
+                         kReferenceDeltaIntersection };
+    fReference.resize(fSample.size());
+    Propagate(reference, fReference);
+
+    std::vector<EndPoint> endPoints(fSample.size());
+    Settings current;
+    current.fStepperType = -1;
+    current.fMaxEpsilonStep = fFieldManager->GetMaximumEpsilonStep();
+    current.fMinEpsilonStep = fFieldManager->GetMinimumEpsilonStep();
+    current.fDeltaOneStep = fFieldManager->GetDeltaOneStep();
+    current.fDeltaIntersection = fFieldManager->GetDeltaIntersection();
+    G4double time = Propagate(current, endPoints);
+    G4cout << "  Current settings: " << time << " s, tolerances "
+           << (IsAccurate(endPoints) ? "met" : "NOT met") << G4endl;
+
+    // Candidate steppers and drivers; the fastest configuration
+    // meeting the tolerances is chosen
+    //
+    const G4int stepperTypes[] = { G4ChordFinder::kTemplatedStepperType,
+                                   G4ChordFinder::kRegularStepperType,
+                                   G4ChordFinder::kFSALStepperType,
+                                   G4ChordFinder::kBfieldDriverType };
+    Settings best;
+    G4double bestTime = DBL_MAX;
+    for (auto type : stepperTypes)
+    {
+      Settings settings;
+      settings.fStepperType = type;
+      if (!Optimise(settings))
+      {
+        G4cout << "  Stepper type " << type
+               << ": tolerances not met at tight accuracy" << G4endl;
+        continue;
+      }
+      time = DBL_MAX;
+      for (G4int i = 0; i < 3; ++i)
+      {
+        time = std::min(time, Propagate(settings, endPoints));
+      }
+      G4cout << "  Stepper type " << type << ": " << time << " s, "
+             << "eps_max = " << settings.fMaxEpsilonStep
+             << ", eps_min = " << settings.fMinEpsilonStep
+             << ", delta one step = " << settings.fDeltaOneStep / mm
+             << " mm, delta intersection = "
+             << settings.fDeltaIntersection / mm << " mm" << G4endl;
+      if (time < bestTime)
+      {
+        bestTime = time;
+        best = settings;
+      }
+    }
+
+    success = (bestTime < DBL_MAX);
+    if (!success)
+    {
+      message << "No configuration meets the tolerances for region "
+              << regionName << " !";
+      G4Exception("G4FieldParametersTuner::Tune()", "GeomNav1002",
+                  JustWarning, message);
+    }
+    else
+    {
+      macro << "# Field propagation parameters for region " << regionName
+            << ", tuned for\n"
+            << "# " << fSample.size() << " tracks of charge " << fCharge
+            << " and mass " << fMass / MeV << " MeV, momenta in ["
+            << fMinMomentum / MeV << ", " << fMaxMomentum / MeV
+            << "] MeV, length " << fTrackLength / mm << " mm,\n"
+            << "# tolerances " << fPositionTolerance / mm
+            << " mm on position, " << fMomentumTolerance
+            << " on relative momentum\n"
+            << "/geometry/field/selectRegion " << regionName << "\n"
+            << "/geometry/field/stepperType " << best.fStepperType << "\n"
+            << "/geometry/field/epsilonStep " << best.fMinEpsilonStep
+            << " " << best.fMaxEpsilonStep << "\n"
+            << "/geometry/field/deltaOneStep "
+            << best.fDeltaOneStep / mm << " mm\n"
+            << "/geometry/field/deltaIntersection "
+            << best.fDeltaIntersection / mm << " mm" << std::endl;
+    }
+  }
+
+  fSample.clear();
+  fReference.clear();
+  fNavigator = nullptr;
+  fPropagator = nullptr;
+  fFieldManager = nullptr;
+  fField = nullptr;
+
+  return success;
+}
+
+// --------------------------------------------------------------------
+G4bool G4FieldParametersTuner::GenerateSample(const G4Region* region)
+{
+  // Starting points are sampled in the extent of the world volume, and
+  // kept if inside the region; the sample is the same at each call
+  //
+  CLHEP::MixMaxRng engine(12345);
+  G4ThreeVector pMin, pMax;
+  fNavigator->GetWorldVolume()->GetLogicalVolume()->GetSolid()
+            ->BoundingLimits(pMin, pMax);
+  const G4ThreeVector size = pMax - pMin;
+
+  fSample.clear();
+  const G4int maxAttempts = 1000 * fNumberOfTracks;
+  for (G4int i = 0; i < maxAttempts
+                 && (G4int)fSample.size() < fNumberOfTracks; ++i)
+  {
+    G4ThreeVector point(pMin.x() + size.x() * engine.flat(),
+                        pMin.y() + size.y() * engine.flat(),
+                        pMin.z() + size.z() * engine.flat());
+    G4VPhysicalVolume* volume
+      = fNavigator->LocateGlobalPointAndSetup(point, nullptr, false, true);
+    if (volume == nullptr
+     || volume->GetLogicalVolume()->GetRegion() != region)
+    {
+      continue;
+    }
+    SampleTrack track;
+    track.fPosition = point;
+    G4double cost = 2.0 * engine.flat() - 1.0;
+    G4double sint = std::sqrt((1.0 - cost) * (1.0 + cost));
+    G4double phi = twopi * engine.flat();
+    track.fDirection.set(sint * std::cos(phi), sint * std::sin(phi), cost);
+    track.fMomentum = fMinMomentum
+                    * std::pow(fMaxMomentum / fMinMomentum, engine.flat());
+    fSample.push_back(track);
+  }
+  return !fSample.empty();
+}
+
+// --------------------------------------------------------------------
+G4double G4FieldParametersTuner::Propagate(const Settings& settings,
+                                           std::vector<EndPoint>& endPoints)
+{
+  // Apply the settings, keeping the current ones
+  //
+  Settings current;
+  current.fMaxEpsilonStep = fFieldManager->GetMaximumEpsilonStep();
+  current.fMinEpsilonStep = fFieldManager->GetMinimumEpsilonStep();
+  current.fDeltaOneStep = fFieldManager->GetDeltaOneStep();
+  current.fDeltaIntersection = fFieldManager->GetDeltaIntersection();
+  G4ChordFinder* currentChordFinder = fFieldManager->GetChordFinder();
+
+  G4ChordFinder* chordFinder = nullptr;
+  if (settings.fStepperType >= 0)
+  {
+    chordFinder = new G4ChordFinder(fField, 1.0e-2 * mm, nullptr,
+                                    settings.fStepperType);
+    chordFinder->SetDeltaChord(currentChordFinder->GetDeltaChord());
+    fFieldManager->SetChordFinder(chordFinder);
+  }
+  SetEpsilonSteps(fFieldManager, settings.fMinEpsilonStep,
+                  settings.fMaxEpsilonStep);
+  fFieldManager->SetDeltaOneStep(settings.fDeltaOneStep);
+  fFieldManager->SetDeltaIntersection(settings.fDeltaIntersection);
+
+  const G4double tolerance
+    = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+
+  G4Timer timer;
+  timer.Start();
+  for (std::size_t i = 0; i < fSample.size(); ++i)
+  {
+    const SampleTrack& sample = fSample[i];
+    const G4double energy = std::sqrt(sample.fMomentum * sample.fMomentum
+                                      + fMass * fMass);
+    G4FieldTrack track(sample.fPosition, 0.0, sample.fDirection,
+                       energy - fMass, fMass, fCharge, G4ThreeVector());
+    G4ChargeState chargeState(fCharge, 0.0, -1.0);
+
+    fPropagator->ClearPropagatorState();
+    G4ThreeVector position = sample.fPosition;
+    G4ThreeVector direction = sample.fDirection;
+    G4VPhysicalVolume* volume
+      = fNavigator->LocateGlobalPointAndSetup(position, &direction,
+                                              false, false);
+    G4double remaining = fTrackLength;
+    for (G4int n = 0; volume != nullptr && remaining > tolerance
+                   && n < kMaxStepsPerTrack; ++n)
+    {
+      G4double safety = 0.0, step = 0.0;
+      G4bool limited = false;
+      G4FieldManager* fieldMgr = fPropagator->FindAndSetFieldManager(volume);
+      if (fieldMgr != nullptr && fieldMgr->DoesFieldExist()
+       && fieldMgr->GetChordFinder() != nullptr)
+      {
+        fieldMgr->GetChordFinder()->GetIntegrationDriver()
+                ->GetEquationOfMotion()
+                ->SetChargeMomentumMass(chargeState, sample.fMomentum, fMass);
+        step = fPropagator->ComputeStep(track, remaining, safety, volume);
+        limited = fPropagator->IsLastStepInVolume();
+      }
+      else
+      {
+        step = fNavigator->ComputeStep(position, direction, remaining,
+                                       safety);
+        limited = (step <= remaining);
+        step = std::min(step, remaining);
+        track.SetPosition(position + step * direction);
+      }
+      remaining -= step;
+      position = track.GetPosition();
+      direction = track.GetMomentumDir();
+      if (limited)
+      {
+        fNavigator->SetGeometricallyLimitedStep();
+        volume = fNavigator->LocateGlobalPointAndSetup(position, &direction,
+                                                       true);
+      }
+      else
+      {
+        fNavigator->LocateGlobalPointWithinVolume(position);
+      }
+    }
+    endPoints[i].fPosition = track.GetPosition();
+    endPoints[i].fMomentum = track.GetMomentum();
+  }
+  timer.Stop();
+
+  // Restore the settings of the field manager
+  //
+  fFieldManager->SetChordFinder(currentChordFinder);
+  delete chordFinder;
+  SetEpsilonSteps(fFieldManager, current.fMinEpsilonStep,
+                  current.fMaxEpsilonStep);
+  fFieldManager->SetDeltaOneStep(current.fDeltaOneStep);
+  fFieldManager->SetDeltaIntersection(current.fDeltaIntersection);
+
+  return timer.GetRealElapsed();
+}
+
+// --------------------------------------------------------------------
+G4bool
+G4FieldParametersTuner::IsAccurate(const std::vector<EndPoint>& endPoints) const
+{
+  for (std::size_t i = 0; i < endPoints.size(); ++i)
+  {
+    const EndPoint& point = endPoints[i];
+    const EndPoint& reference = fReference[i];
+    if ((point.fPosition - reference.fPosition).mag() > fPositionTolerance
+     || (point.fMomentum - reference.fMomentum).mag()
+          > fMomentumTolerance * reference.fMomentum.mag())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4FieldParametersTuner::Optimise(Settings& settings)
+{
+  settings.fMaxEpsilonStep = kTightMaxEpsilon;
+  settings.fMinEpsilonStep = kTightMinEpsilon;
+  settings.fDeltaOneStep = kTightDeltaOneStep;
+  settings.fDeltaIntersection = kTightDeltaIntersection;
+
+  std::vector<EndPoint> endPoints(fSample.size());
+  Propagate(settings, endPoints);
+  if (!IsAccurate(endPoints))
+  {
+    return false;
+  }
+
+  // Each parameter is increased by factors sqrt(10) up to its limit,
+  // as long as the tolerances are met; the minimum epsilon is limited
+  // by the maximum one
+  //
+  const G4double factor = std::sqrt(10.0);
+  G4double Settings::* parameters[] = { &Settings::fMaxEpsilonStep,
+                                        &Settings::fMinEpsilonStep,
+                                        &Settings::fDeltaOneStep,
+                                        &Settings::fDeltaIntersection };
+  for (auto parameter : parameters)
+  {
+    const G4double limit
+      = (parameter == &Settings::fMaxEpsilonStep)
+        ? std::min(kMaxEpsilon, G4FieldManager::GetMaxAcceptedEpsilon())
+        : (parameter == &Settings::fMinEpsilonStep)
+          ? settings.fMaxEpsilonStep : kMaxDelta;
+    while (settings.*parameter < limit * (1.0 - 1.0e-6))
+    {
+      Settings trial = settings;
+      trial.*parameter = std::min(settings.*parameter * factor, limit);
+      Propagate(trial, endPoints);
+      if (!IsAccurate(endPoints))
+      {
+        break;
+      }
+      settings = trial;
+    }
+  }
+  return true;
+}
@@ -28,14 +28,34 @@
 // Author: G.Cosmo, CERN
 // --------------------------------------------------------------------
 
+#include <cstdint>
 #include <queue>
 #include <set>
 
 #include "G4GeomTestVolume.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4VPhysicalVolume.hh"
+#include "G4PVPlacement.hh"
 #include "G4LogicalVolume.hh"
 #include "G4VSolid.hh"
+#include "G4TaskDispatcher.hh"
+#include "G4QuickRand.hh"
+#include "Randomize.hh"
+
+namespace
+{
+  // Seed for the random generators used while checking the volume
+  // of given rank in the list of volumes to check
+  //
+  inline uint32_t CheckSeed(std::size_t rank)
+  {
+    auto z = static_cast<uint32_t>(0x9E3779B9u * (rank + 1));
+    z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+    z ^= z >> 16;
+    return (z == 0) ? 2463534242u : z;
+  }
+}
 
 //
 // Constructor
@@ -124,6 +144,7 @@ void G4GeomTestVolume::TestOverlapInTree() const
 {
   std::queue<G4VPhysicalVolume*> volumes;
   std::set<G4LogicalVolume*> checked;
+  std::vector<G4VPhysicalVolume*> tocheck;
 
   volumes.push(target);
   while (!volumes.empty())
@@ -136,8 +157,7 @@ void G4GeomTestVolume::TestOverlapInTree() const
     std::size_t ndaughters = logical->GetNoDaughters();
     for (std::size_t i=0; i<ndaughters; ++i)
     {
-      G4VPhysicalVolume* daughter = logical->GetDaughter(i);
-      daughter->CheckOverlaps(resolution, tolerance, verbosity, maxErr);
+      tocheck.push_back(logical->GetDaughter(i));
     }
 
     // append the queue of volumes
@@ -166,12 +186,27 @@ void G4GeomTestVolume::TestOverlapInTree() const
       }
     }
   }
+  CheckVolumes(tocheck);
 }
 
 //
 // TestRecursiveOverlap
 //
 void G4GeomTestVolume::TestRecursiveOverlap( G4int slevel, G4int depth )
+{
+  std::vector<G4VPhysicalVolume*> tocheck;
+  std::set<G4VPhysicalVolume*> collected;
+  CollectRecursive(target, slevel, depth, tocheck, collected);
+  CheckVolumes(tocheck);
+}
+
+//
+// CollectRecursive
+//
+void G4GeomTestVolume::
+CollectRecursive( G4VPhysicalVolume* volume, G4int slevel, G4int depth,
+                  std::vector<G4VPhysicalVolume*>& volumes,
+                  std::set<G4VPhysicalVolume*>& collected ) const
 {
   // If reached requested level of depth (i.e. set to 0), exit.
   // If not depth specified (i.e. set to -1), visit the whole tree.
@@ -183,37 +218,122 @@ void G4GeomTestVolume::TestRecursiveOverlap( G4int slevel, G4int depth )
 
   //
   // As long as we reached the requested
-  // initial level of depth, test ourselves
+  // initial level of depth, test ourselves.
+  // The same physical volume, found in different branches of the tree,
+  // is in the same mother logical volume: it is checked only once
   //
-  if ( slevel==0 )
+  if ( slevel==0 && collected.insert(volume).second )
   {
-    target->CheckOverlaps(resolution, tolerance, verbosity, maxErr);
+    volumes.push_back(volume);
   }
 
   //
-  // Loop over unique daughters
+  // Recurse over daughters
   //
-  std::set<const G4LogicalVolume *> tested;
-
-  const G4LogicalVolume *logical = target->GetLogicalVolume();
+  const G4LogicalVolume *logical = volume->GetLogicalVolume();
   auto  nDaughter = (G4int)logical->GetNoDaughters();
   for( auto iDaughter=0; iDaughter<nDaughter; ++iDaughter )
   {
-    G4VPhysicalVolume *daughter = logical->GetDaughter(iDaughter);
-    
-    // Tested already?
-    //
-    // const G4LogicalVolume *daughterLogical =
-    //      daughter->GetLogicalVolume();
-    // std::pair<std::set<const G4LogicalVolume *>::iterator, G4bool>
-    //       there = tested.insert(daughterLogical);
-    // if (!there.second) continue;
-
-    //
-    // Recurse
-    //
-    G4GeomTestVolume vTest( daughter, tolerance, resolution, verbosity );
-    vTest.SetErrorsThreshold(maxErr);
-    vTest.TestRecursiveOverlap( slevel,depth );
+    CollectRecursive( logical->GetDaughter(iDaughter), slevel, depth,
+                      volumes, collected );
+  }
+}
+
+//
+// CheckVolumes
+//
+void G4GeomTestVolume::
+CheckVolumes( const std::vector<G4VPhysicalVolume*>& volumes ) const
+{
+  std::size_t nvolumes = volumes.size();
+  std::vector<G4PVPlacement*> placements(nvolumes, nullptr);
+  for (std::size_t i=0; i<nvolumes; ++i)
+  {
+    if (volumes[i]->GetMotherLogical() == nullptr) { continue; }
+    placements[i] = dynamic_cast<G4PVPlacement*>(volumes[i]);
+  }
+
+  CLHEP::HepRandomEngine* engine = G4Random::getTheEngine();
+  std::vector<unsigned long> state = engine->put();
+
+  // Solids may initialise data for the generation of points on their
+  // surface at first call; this is done here sequentially, before the
+  // concurrent checks, for all the solids involved
+  //
+  if (G4TaskDispatcher::IsParallel())
+  {
+    std::set<G4VSolid*> solids;
+    for (auto* placement : placements)
+    {
+      if (placement == nullptr) { continue; }
+      G4LogicalVolume* mother = placement->GetMotherLogical();
+      solids.insert(placement->GetLogicalVolume()->GetSolid());
+      for (std::size_t k=0; k<mother->GetNoDaughters(); ++k)
+      {
+        solids.insert(mother->GetDaughter(k)->GetLogicalVolume()->GetSolid());
+      }
+    }
+    for (auto* solid : solids) { solid->GetPointOnSurface(); }
+  }
+
+  // Check placements, each with its own random sequence; the state of
+  // the random engine of the calling threads is restored afterwards
+  //
+  std::vector<std::vector<G4String>> reports(nvolumes);
+  G4TaskDispatcher::Execute((G4int)nvolumes, [&](G4int i)
+  {
+    if (placements[i] == nullptr) { return; }
+    CLHEP::HepRandomEngine* taskEngine = G4Random::getTheEngine();
+    std::vector<unsigned long> taskState = taskEngine->put();
+    uint32_t seed = CheckSeed(i);
+    taskEngine->setSeed(seed, 0);
+    G4QuickRand(seed);
+    placements[i]->CollectOverlaps(resolution, tolerance, maxErr, reports[i]);
+    taskEngine->get(taskState);
+  });
+  engine->get(state);
+
+  // Report, in the order of the volumes. Volumes other than placements
+  // (i.e. parameterised volumes) are checked at this stage sequentially
+  //
+  G4int nchecked = 0, noverlaps = 0;
+  for (std::size_t i=0; i<nvolumes; ++i)
+  {
+    G4VPhysicalVolume* volume = volumes[i];
+    if (placements[i] == nullptr)
+    {
+      if (volume->CheckOverlaps(resolution, tolerance, verbosity, maxErr))
+      {
+        ++noverlaps;
+      }
+      ++nchecked;
+      continue;
+    }
+    if (verbosity)
+    {
+      G4cout << "Checking overlaps for volume "
+             << volume->GetName() << ':' << volume->GetCopyNo()
+             << " (" << volume->GetLogicalVolume()->GetSolid()->GetEntityType()
+             << ") ... ";
+    }
+    for (const auto& report : reports[i])
+    {
+      G4Exception("G4PVPlacement::CheckOverlaps()",
+                  "GeomVol1002", JustWarning, report.c_str());
+    }
+    if (reports[i].empty())
+    {
+      if (verbosity) { G4cout << "OK! " << G4endl; }
+    }
+    else
+    {
+      ++noverlaps;
+    }
+    ++nchecked;
+  }
+  if (verbosity && nchecked > 1)
+  {
+    G4cout << "Overlaps check completed for " << nchecked << " volumes: "
+           << noverlaps << " with problems reported." << G4endl;
   }
 }
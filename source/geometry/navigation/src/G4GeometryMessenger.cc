@@ -28,6 +28,7 @@
 // Author: G.Cosmo, CERN
 // --------------------------------------------------------------------
 
+#include <fstream>
 #include <iomanip>
 
 #include "G4GeometryMessenger.hh"
@@ -37,13 +38,23 @@
 #include "G4VPhysicalVolume.hh"
 #include "G4Navigator.hh"
 #include "G4PropagatorInField.hh"
+#include "G4FieldStatistics.hh"
+#include "G4FieldManager.hh"
+#include "G4ChordFinder.hh"
+#include "G4MagneticField.hh"
+#include "G4FieldParametersTuner.hh"
+#include "G4RegionStore.hh"
+#include "G4SolidPropertiesCache.hh"
 
 #include "G4UIdirectory.hh"
 #include "G4UIcommand.hh"
 #include "G4UIcmdWithoutParameter.hh"
 #include "G4UIcmdWithABool.hh"
 #include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADouble.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIparameter.hh"
 
 #include "G4GeomTestVolume.hh"
 
@@ -105,6 +116,219 @@ G4GeometryMessenger::G4GeometryMessenger(G4TransportationManager* tman)
   pchkCmd->SetDefaultValue(true);
   pchkCmd->AvailableForStates(G4State_Idle);
 
+  //
+  // Field propagation statistics commands
+  //
+  flddir = new G4UIdirectory( "/geometry/field/" );
+  flddir->SetGuidance( "Propagation in field control setup." );
+
+  fstCmd = new G4UIcmdWithABool( "/geometry/field/statistics", this );
+  fstCmd->SetGuidance( "Activate/deactivate the collection of statistics on" );
+  fstCmd->SetGuidance( "the propagation in field, per logical volume and" );
+  fstCmd->SetGuidance( "particle type: integration steps, field evaluations," );
+  fstCmd->SetGuidance( "chord and locator iterations, looping tracks killed." );
+  fstCmd->SetGuidance( "The statistics are reported at the end of each run." );
+  fstCmd->SetGuidance( "Collection is deactivated by default." );
+  fstCmd->SetParameterName("statFlag",true);
+  fstCmd->SetDefaultValue(true);
+  fstCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fstCmd->SetToBeBroadcasted(false);
+
+  fprCmd = new G4UIcmdWithoutParameter( "/geometry/field/printStatistics", this );
+  fprCmd->SetGuidance( "Print the statistics on the propagation in field" );
+  fprCmd->SetGuidance( "accumulated over the runs so far." );
+  fprCmd->AvailableForStates(G4State_Idle);
+  fprCmd->SetToBeBroadcasted(false);
+
+  frsCmd = new G4UIcmdWithoutParameter( "/geometry/field/resetStatistics", this );
+  frsCmd->SetGuidance( "Reset the statistics on the propagation in field." );
+  frsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  frsCmd->SetToBeBroadcasted(false);
+
+  fhlxCmd = new G4UIcmdWithABool( "/geometry/field/exactHelix", this );
+  fhlxCmd->SetGuidance( "Activate/deactivate the propagation along the exact" );
+  fhlxCmd->SetGuidance( "helix in volumes with a uniform magnetic field, as" );
+  fhlxCmd->SetGuidance( "far as the safety allows, before using the chord finder." );
+  fhlxCmd->SetGuidance( "Deactivated by default." );
+  fhlxCmd->SetParameterName("helixFlag",true);
+  fhlxCmd->SetDefaultValue(true);
+  fhlxCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fregCmd = new G4UIcmdWithAString( "/geometry/field/selectRegion", this );
+  fregCmd->SetGuidance( "Select the region whose field manager is modified by" );
+  fregCmd->SetGuidance( "the following /geometry/field/ parameter commands:" );
+  fregCmd->SetGuidance( "that of the region, else that of its first root" );
+  fregCmd->SetGuidance( "logical volume having one, else the global one." );
+  fregCmd->SetParameterName("region",true);
+  fregCmd->SetDefaultValue("DefaultRegionForTheWorld");
+  fregCmd->AvailableForStates(G4State_Idle);
+
+  fstpCmd = new G4UIcmdWithAnInteger( "/geometry/field/stepperType", this );
+  fstpCmd->SetGuidance( "Create for the selected field manager a new chord" );
+  fstpCmd->SetGuidance( "finder, with the type of stepper and driver given" );
+  fstpCmd->SetGuidance( "(see G4ChordFinder::kIntegrationType). The field" );
+  fstpCmd->SetGuidance( "must be magnetic; delta chord is kept." );
+  fstpCmd->SetParameterName("type",false);
+  fstpCmd->SetRange("type >=0 && type <=6");
+  fstpCmd->AvailableForStates(G4State_Idle);
+
+  fepsCmd = new G4UIcommand( "/geometry/field/epsilonStep", this );
+  fepsCmd->SetGuidance( "Set the minimum and maximum relative accuracies of" );
+  fepsCmd->SetGuidance( "an integration step for the selected field manager." );
+  auto param = new G4UIparameter("epsMin", 'd', false);
+  param->SetParameterRange("epsMin > 0.");
+  fepsCmd->SetParameter(param);
+  param = new G4UIparameter("epsMax", 'd', false);
+  param->SetParameterRange("epsMax > 0.");
+  fepsCmd->SetParameter(param);
+  fepsCmd->AvailableForStates(G4State_Idle);
+
+  fd1Cmd = new G4UIcmdWithADoubleAndUnit( "/geometry/field/deltaOneStep", this );
+  fd1Cmd->SetGuidance( "Set the accuracy of the end point of an integration" );
+  fd1Cmd->SetGuidance( "step for the selected field manager." );
+  fd1Cmd->SetParameterName("delta",false);
+  fd1Cmd->SetRange("delta > 0.");
+  fd1Cmd->SetDefaultUnit("mm");
+  fd1Cmd->SetUnitCategory("Length");
+  fd1Cmd->AvailableForStates(G4State_Idle);
+
+  fdiCmd = new G4UIcmdWithADoubleAndUnit( "/geometry/field/deltaIntersection", this );
+  fdiCmd->SetGuidance( "Set the accuracy of the intersection with a boundary" );
+  fdiCmd->SetGuidance( "for the selected field manager." );
+  fdiCmd->SetParameterName("delta",false);
+  fdiCmd->SetRange("delta > 0.");
+  fdiCmd->SetDefaultUnit("mm");
+  fdiCmd->SetUnitCategory("Length");
+  fdiCmd->AvailableForStates(G4State_Idle);
+
+  //
+  // Field parameters calibration commands
+  //
+  caldir = new G4UIdirectory( "/geometry/field/calibration/" );
+  caldir->SetGuidance( "Tuning of the field propagation parameters of a region." );
+  caldir->SetGuidance( "Sample tracks are propagated in the geometry, starting" );
+  caldir->SetGuidance( "in the region, at reference accuracy and with trial" );
+  caldir->SetGuidance( "settings; the fastest settings meeting the tolerances" );
+  caldir->SetGuidance( "are written as /geometry/field/ commands." );
+
+  fparCmd = new G4UIcommand( "/geometry/field/calibration/particle", this );
+  fparCmd->SetGuidance( "Set the charge (in units of e+) and the mass of the" );
+  fparCmd->SetGuidance( "sample tracks. Default: electrons." );
+  param = new G4UIparameter("charge", 'd', false);
+  fparCmd->SetParameter(param);
+  param = new G4UIparameter("mass", 'd', false);
+  param->SetParameterRange("mass >= 0.");
+  fparCmd->SetParameter(param);
+  param = new G4UIparameter("unit", 's', true);
+  param->SetDefaultUnit("MeV");
+  fparCmd->SetParameter(param);
+  fparCmd->AvailableForStates(G4State_Idle);
+  fparCmd->SetToBeBroadcasted(false);
+
+  fmomCmd = new G4UIcommand( "/geometry/field/calibration/momentumRange", this );
+  fmomCmd->SetGuidance( "Set the range of momenta of the sample tracks." );
+  fmomCmd->SetGuidance( "Default: 10 MeV to 1 GeV." );
+  param = new G4UIparameter("pMin", 'd', false);
+  param->SetParameterRange("pMin > 0.");
+  fmomCmd->SetParameter(param);
+  param = new G4UIparameter("pMax", 'd', false);
+  param->SetParameterRange("pMax > 0.");
+  fmomCmd->SetParameter(param);
+  param = new G4UIparameter("unit", 's', true);
+  param->SetDefaultUnit("MeV");
+  fmomCmd->SetParameter(param);
+  fmomCmd->AvailableForStates(G4State_Idle);
+  fmomCmd->SetToBeBroadcasted(false);
+
+  fntCmd = new G4UIcmdWithAnInteger( "/geometry/field/calibration/numberOfTracks", this );
+  fntCmd->SetGuidance( "Set the number of sample tracks. Default: 100." );
+  fntCmd->SetParameterName("tracks",false);
+  fntCmd->SetRange("tracks > 0");
+  fntCmd->AvailableForStates(G4State_Idle);
+  fntCmd->SetToBeBroadcasted(false);
+
+  flenCmd = new G4UIcmdWithADoubleAndUnit( "/geometry/field/calibration/trackLength", this );
+  flenCmd->SetGuidance( "Set the length over which sample tracks are propagated." );
+  flenCmd->SetGuidance( "Default: 1 m." );
+  flenCmd->SetParameterName("length",false);
+  flenCmd->SetRange("length > 0.");
+  flenCmd->SetDefaultUnit("mm");
+  flenCmd->SetUnitCategory("Length");
+  flenCmd->AvailableForStates(G4State_Idle);
+  flenCmd->SetToBeBroadcasted(false);
+
+  fptCmd = new G4UIcmdWithADoubleAndUnit( "/geometry/field/calibration/positionTolerance", this );
+  fptCmd->SetGuidance( "Set the maximum distance of the end points of sample" );
+  fptCmd->SetGuidance( "tracks from the reference ones. Default: 1 um." );
+  fptCmd->SetParameterName("tolerance",false);
+  fptCmd->SetRange("tolerance > 0.");
+  fptCmd->SetDefaultUnit("mm");
+  fptCmd->SetUnitCategory("Length");
+  fptCmd->AvailableForStates(G4State_Idle);
+  fptCmd->SetToBeBroadcasted(false);
+
+  fmtCmd = new G4UIcmdWithADouble( "/geometry/field/calibration/momentumTolerance", this );
+  fmtCmd->SetGuidance( "Set the maximum relative deviation of the momentum at" );
+  fmtCmd->SetGuidance( "the end of sample tracks from the reference one." );
+  fmtCmd->SetGuidance( "Default: 1.e-6." );
+  fmtCmd->SetParameterName("tolerance",false);
+  fmtCmd->SetRange("tolerance > 0.");
+  fmtCmd->AvailableForStates(G4State_Idle);
+  fmtCmd->SetToBeBroadcasted(false);
+
+  frunCmd = new G4UIcommand( "/geometry/field/calibration/run", this );
+  frunCmd->SetGuidance( "Run the calibration for the given region and write the" );
+  frunCmd->SetGuidance( "commands applying the settings chosen in the macro file" );
+  frunCmd->SetGuidance( "given, or print them if no file is given." );
+  frunCmd->SetGuidance( "NOTE: it may take a long time, depending on the sample!" );
+  param = new G4UIparameter("region", 's', true);
+  param->SetDefaultValue("DefaultRegionForTheWorld");
+  frunCmd->SetParameter(param);
+  param = new G4UIparameter("macroFile", 's', true);
+  param->SetDefaultValue("");
+  frunCmd->SetParameter(param);
+  frunCmd->AvailableForStates(G4State_Idle);
+  frunCmd->SetToBeBroadcasted(false);
+
+  //
+  // Solids properties estimation commands
+  //
+  soldir = new G4UIdirectory( "/geometry/solids/" );
+  soldir->SetGuidance( "Control of the estimation of the cubic volume and" );
+  soldir->SetGuidance( "surface area of solids without analytical expression." );
+
+  sprCmd = new G4UIcmdWithADouble( "/geometry/solids/precision", this );
+  sprCmd->SetGuidance( "Set the relative statistical precision at which the" );
+  sprCmd->SetGuidance( "Monte Carlo estimation of cubic volume and surface" );
+  sprCmd->SetGuidance( "area is stopped before the full statistics is used." );
+  sprCmd->SetGuidance( "A value of 0 (default) implies full statistics." );
+  sprCmd->SetParameterName("precision",false);
+  sprCmd->SetRange("precision>=0.");
+  sprCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  sprCmd->SetToBeBroadcasted(false);
+
+  sparCmd = new G4UIcmdWithABool( "/geometry/solids/parallel", this );
+  sparCmd->SetGuidance( "Enable/disable the distribution of the estimation" );
+  sparCmd->SetGuidance( "on the tasking thread pool. Enabled by default." );
+  sparCmd->SetParameterName("parallel",true);
+  sparCmd->SetDefaultValue(true);
+  sparCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  sparCmd->SetToBeBroadcasted(false);
+
+  sstoCmd = new G4UIcmdWithAString( "/geometry/solids/storeEstimates", this );
+  sstoCmd->SetGuidance( "Write the estimates computed so far to the given file." );
+  sstoCmd->SetParameterName("fileName",false);
+  sstoCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  sstoCmd->SetToBeBroadcasted(false);
+
+  sretCmd = new G4UIcmdWithAString( "/geometry/solids/retrieveEstimates", this );
+  sretCmd->SetGuidance( "Read estimates written by /geometry/solids/storeEstimates." );
+  sretCmd->SetGuidance( "They are assigned to solids at first request, if name," );
+  sretCmd->SetGuidance( "type and extent match." );
+  sretCmd->SetParameterName("fileName",false);
+  sretCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  sretCmd->SetToBeBroadcasted(false);
+
   //
   // Geometry verification test commands
   //
@@ -182,7 +406,14 @@ G4GeometryMessenger::~G4GeometryMessenger()
   delete resCmd; delete rcsCmd; delete rcdCmd; delete errCmd;
   delete tolCmd;
   delete verbCmd; delete pchkCmd; delete chkCmd;
-  delete geodir; delete navdir; delete testdir;
+  delete fstCmd; delete fprCmd; delete frsCmd; delete fhlxCmd;
+  delete fregCmd; delete fstpCmd; delete fepsCmd; delete fd1Cmd; delete fdiCmd;
+  delete fparCmd; delete fmomCmd; delete fntCmd; delete flenCmd;
+  delete fptCmd; delete fmtCmd; delete frunCmd;
+  delete sprCmd; delete sparCmd; delete sstoCmd; delete sretCmd;
+  delete soldir;
+  delete geodir; delete navdir; delete testdir; delete flddir; delete caldir;
+  delete tuner;
   for(auto* tvolume: tvolumes) {
       delete tvolume;
   }
@@ -229,6 +460,44 @@ G4GeometryMessenger::SetNewValue( G4UIcommand* command, G4String newValues )
   else if (command == pchkCmd) {
     SetPushFlag( newValues );
   }
+  else if (command == fstCmd) {
+    G4FieldStatistics::SetActive(fstCmd->GetNewBoolValue( newValues ));
+  }
+  else if (command == fprCmd) {
+    G4FieldStatistics::PrintTotals();
+  }
+  else if (command == frsCmd) {
+    G4FieldStatistics::ResetTotals();
+  }
+  else if (command == fhlxCmd) {
+    tmanager->GetPropagatorInField()
+            ->SetUseExactHelix(fhlxCmd->GetNewBoolValue( newValues ));
+  }
+  else if (command == fregCmd) {
+    fieldRegion = newValues;
+  }
+  else if (command == fstpCmd || command == fepsCmd
+        || command == fd1Cmd || command == fdiCmd) {
+    SetFieldParameter( command, newValues );
+  }
+  else if (command == fparCmd || command == fmomCmd || command == fntCmd
+        || command == flenCmd || command == fptCmd || command == fmtCmd) {
+    SetCalibrationParameter( command, newValues );
+  }
+  else if (command == frunCmd) {
+    RunCalibration( newValues );
+  }
+  else if (command == sprCmd) {
+    G4SolidPropertiesCache::GetInstance()
+      ->SetPrecision(sprCmd->GetNewDoubleValue( newValues ));
+  }
+  else if (command == sparCmd) {
+    G4SolidPropertiesCache::GetInstance()
+      ->SetParallel(sparCmd->GetNewBoolValue( newValues ));
+  }
+  else if (command == sstoCmd || command == sretCmd) {
+    PersistSolidEstimates( command, newValues );
+  }
   else if (command == tolCmd) {
     Init();
     tol = tolCmd->GetNewDoubleValue( newValues )
@@ -258,6 +527,9 @@ G4GeometryMessenger::SetNewValue( G4UIcommand* command, G4String newValues )
   else if (command == rcdCmd) {
     recDepth = rcdCmd->GetNewIntValue( newValues );
   }
+  else if (command == parCmd) {
+    checkParallelWorlds = parCmd->GetNewBoolValue( newValues );
+  }
   else if (command == errCmd) {
     Init();
     for(auto* tvolume: tvolumes)
@@ -284,9 +556,65 @@ G4GeometryMessenger::GetCurrentValue( G4UIcommand* command )
   {
     cv = tolCmd->ConvertToString( tol, "mm" );
   }
+  else if (command == fstCmd)
+  {
+    cv = fstCmd->ConvertToString( G4FieldStatistics::IsActive() );
+  }
+  else if (command == fhlxCmd)
+  {
+    cv = fhlxCmd->ConvertToString(
+           tmanager->GetPropagatorInField()->GetUseExactHelix() );
+  }
+  else if (command == fregCmd)
+  {
+    cv = fieldRegion;
+  }
+  else if (command == sprCmd)
+  {
+    cv = sprCmd->ConvertToString(
+           G4SolidPropertiesCache::GetInstance()->GetPrecision() );
+  }
+  else if (command == sparCmd)
+  {
+    cv = sparCmd->ConvertToString(
+           G4SolidPropertiesCache::GetInstance()->IsParallel() );
+  }
   return cv;
 }
 
+//
+// PersistSolidEstimates
+//
+void
+G4GeometryMessenger::PersistSolidEstimates( G4UIcommand* command,
+                                            const G4String& fileName )
+{
+  G4SolidPropertiesCache* cache = G4SolidPropertiesCache::GetInstance();
+  if (command == sstoCmd)
+  {
+    std::ofstream file(fileName);
+    if (file) { cache->Store(file); }
+    if (!file)
+    {
+      G4String message = "Cannot write solid estimates to file: " + fileName;
+      G4Exception("G4GeometryMessenger::PersistSolidEstimates()",
+                  "GeomNav1002", JustWarning, message);
+    }
+    return;
+  }
+  std::ifstream file(fileName);
+  if (!file)
+  {
+    G4String message = "Cannot read solid estimates from file: " + fileName;
+    G4Exception("G4GeometryMessenger::PersistSolidEstimates()",
+                "GeomNav1002", JustWarning, message);
+    return;
+  }
+  G4int nread = cache->Retrieve(file);
+  G4cout << "Retrieved " << nread << " solid estimates from "
+         << fileName << G4endl;
+}
+
 //
 // CheckGeometry
 //
@@ -379,3 +707,164 @@ G4GeometryMessenger::RecursiveOverlapTest()
     tvolumes.front()->TestRecursiveOverlap( recLevel, recDepth );
   }
 }
+
+//
+// Field manager of the region selected
+//
+G4FieldManager*
+G4GeometryMessenger::GetSelectedFieldManager()
+{
+  G4Region* region = G4RegionStore::GetInstance()->GetRegion(fieldRegion, false);
+  if (region == nullptr)
+  {
+    G4ExceptionDescription message;
+    message << "Region " << fieldRegion << " not found !" << G4endl
+            << "Field parameters are left unchanged.";
+    G4Exception("G4GeometryMessenger::GetSelectedFieldManager()",
+                "GeomNav1002", JustWarning, message);
+    return nullptr;
+  }
+  return G4FieldParametersTuner::GetFieldManager(region);
+}
+
+//
+// Set parameters of the field manager of the region selected
+//
+void
+G4GeometryMessenger::SetFieldParameter(G4UIcommand* command,
+                                       const G4String& input)
+{
+  G4FieldManager* fieldMgr = GetSelectedFieldManager();
+  if (fieldMgr == nullptr)  { return; }
+
+  if (command == fstpCmd)
+  {
+    auto field = dynamic_cast<G4MagneticField*>(
+                   const_cast<G4Field*>(fieldMgr->GetDetectorField()));
+    if (field == nullptr)
+    {
+      G4ExceptionDescription message;
+      message << "No magnetic field in region " << fieldRegion << " !"
+              << G4endl << "Chord finder is left unchanged.";
+      G4Exception("G4GeometryMessenger::SetFieldParameter()",
+                  "GeomNav1002", JustWarning, message);
+      return;
+    }
+    G4ChordFinder* chordFinder = fieldMgr->GetChordFinder();
+    G4double deltaChord = (chordFinder != nullptr)
+                        ? chordFinder->GetDeltaChord() : -1.0;
+    fieldMgr->CreateChordFinder(field, fstpCmd->GetNewIntValue(input));
+    if (deltaChord > 0.0)
+    {
+      fieldMgr->GetChordFinder()->SetDeltaChord(deltaChord);
+    }
+  }
+  else if (command == fepsCmd)
+  {
+    G4double epsMin = 0.0, epsMax = 0.0;
+    std::istringstream is(input);
+    is >> epsMin >> epsMax;
+    if (epsMax < epsMin)  { std::swap(epsMin, epsMax); }
+    if (epsMin <= fieldMgr->GetMaximumEpsilonStep())
+    {
+      fieldMgr->SetMinimumEpsilonStep(epsMin);
+      fieldMgr->SetMaximumEpsilonStep(epsMax);
+    }
+    else
+    {
+      fieldMgr->SetMaximumEpsilonStep(epsMax);
+      fieldMgr->SetMinimumEpsilonStep(epsMin);
+    }
+  }
+  else if (command == fd1Cmd)
+  {
+    fieldMgr->SetDeltaOneStep(fd1Cmd->GetNewDoubleValue(input));
+  }
+  else if (command == fdiCmd)
+  {
+    fieldMgr->SetDeltaIntersection(fdiCmd->GetNewDoubleValue(input));
+  }
+}
+
+//
+// Set parameters of the field calibration
+//
+void
+G4GeometryMessenger::SetCalibrationParameter(G4UIcommand* command,
+                                             const G4String& input)
+{
+  if (tuner == nullptr)  { tuner = new G4FieldParametersTuner(); }
+
+  if (command == fparCmd || command == fmomCmd)
+  {
+    G4double first = 0.0, second = 0.0;
+    G4String unit;
+    std::istringstream is(input);
+    is >> first >> second >> unit;
+    G4double value = G4UIcommand::ValueOf(unit);
+    if (command == fparCmd)
+    {
+      tuner->SetParticle(first, second * value);
+    }
+    else
+    {
+      tuner->SetMomentumRange(std::min(first, second) * value,
+                              std::max(first, second) * value);
+    }
+  }
+  else if (command == fntCmd)
+  {
+    tuner->SetNumberOfTracks(fntCmd->GetNewIntValue(input));
+  }
+  else if (command == flenCmd)
+  {
+    tuner->SetTrackLength(flenCmd->GetNewDoubleValue(input));
+  }
+  else if (command == fptCmd)
+  {
+    tuner->SetPositionTolerance(fptCmd->GetNewDoubleValue(input));
+  }
+  else if (command == fmtCmd)
+  {
+    tuner->SetMomentumTolerance(fmtCmd->GetNewDoubleValue(input));
+  }
+}
+
+//
+// Run the field calibration
+//
+void
+G4GeometryMessenger::RunCalibration(const G4String& input)
+{
+  if (tuner == nullptr)  { tuner = new G4FieldParametersTuner(); }
+
+  G4String regionName, macroName;
+  std::istringstream is(input);
+  is >> regionName >> macroName;
+
+  CheckGeometry();
+  if (macroName.empty())
+  {
+    std::ostringstream macro;
+    if (tuner->Tune(regionName, macro))
+    {
+      G4cout << macro.str();
+    }
+  }
+  else
+  {
+    std::ofstream macro(macroName);
+    if (!macro)
+    {
+      G4ExceptionDescription message;
+      message << "Cannot open file " << macroName << " for writing !";
+      G4Exception("G4GeometryMessenger::RunCalibration()",
+                  "GeomNav1002", JustWarning, message);
+      return;
+    }
+    if (tuner->Tune(regionName, macro))
+    {
+      G4cout << "Field parameters written in " << macroName << G4endl;
+    }
+  }
+}
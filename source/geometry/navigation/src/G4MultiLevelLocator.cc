@@ -35,6 +35,7 @@
 #include "G4MultiLevelLocator.hh"
 #include "G4LocatorChangeRecord.hh"
 #include "G4LocatorChangeLogger.hh"
+#include "G4FieldStatistics.hh"
 
 G4MultiLevelLocator::G4MultiLevelLocator(G4Navigator *theNavigator)
   : G4VIntersectionLocator(theNavigator)
@@ -933,6 +934,8 @@ G4bool G4MultiLevelLocator::EstimateIntersectionPoint(
             && ( ! there_is_no_intersection )     
             && ( substep_no <= fMaxSteps) ); // UNTIL found or failed
 
+  G4FieldStatistics::Count(G4FieldStatistics::kLocatorIterations, substep_no);
+
   if( substep_no > max_no_seen )
   {
     max_no_seen = substep_no; 
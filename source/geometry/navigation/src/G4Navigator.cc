@@ -39,6 +39,7 @@
 #include "G4VPhysicalVolume.hh"
 
 #include "G4VoxelSafety.hh"
+#include "G4SafetyGrid.hh"
 
 // Constant determining how precise normals should be (how close to unit
 // vectors). If exceeded, warnings will be issued.
@@ -1833,6 +1834,34 @@ G4double G4Navigator::ComputeSafety( const G4ThreeVector& pGlobalpoint,
 
   G4double newSafety = 0.0;
 
+  // Use the grid of safety bounds of the current volume, if any,
+  // when the bound is large enough
+  //
+  if ( fHistory.GetTopVolumeType() != kReplica )
+  {
+    const G4SafetyGrid* pSafetyGrid
+      = fHistory.GetTopVolume()->GetLogicalVolume()->GetSafetyGrid();
+    if ( pSafetyGrid != nullptr )
+    {
+      newSafety = pSafetyGrid->GetSafety(ComputeLocalPoint(pGlobalpoint));
+      if ( pSafetyGrid->IsUseful(newSafety, pMaxLength) )
+      {
+        fPreviousSftOrigin = pGlobalpoint;
+        fPreviousSafety = newSafety;
+#ifdef G4DEBUG_NAVIGATION
+        if( fVerbose > 1 )
+        {
+          G4cout << "    Returned value of Safety (from grid) = "
+                 << newSafety << G4endl;
+        }
+        G4cout.precision(oldcoutPrec);
+#endif
+        return newSafety;
+      }
+      newSafety = 0.0;
+    }
+  }
+
     if (keepState)  { SetSavedState(); }
     
     // Pseudo-relocate to this point (updates voxel information only)
@@ -36,10 +36,12 @@
 // ---------------------------------------------------------------------------
 
 #include <iomanip>
+#include <typeinfo>
 
 #include "G4PropagatorInField.hh"
 #include "G4ios.hh"
 #include "G4SystemOfUnits.hh"
+#include "G4PhysicalConstants.hh"
 #include "G4ThreeVector.hh"
 #include "G4Material.hh"
 #include "G4VPhysicalVolume.hh"
@@ -48,6 +50,9 @@
 #include "G4VCurvedTrajectoryFilter.hh"
 #include "G4ChordFinder.hh"
 #include "G4MultiLevelLocator.hh"
+#include "G4UniformMagField.hh"
+#include "G4Mag_UsualEqRhs.hh"
+#include "G4FieldStatistics.hh"
 
 
 // ---------------------------------------------------------------------------
@@ -127,6 +132,14 @@ G4double G4PropagatorInField::ComputeStep(
                 G4bool             canRelaxDeltaChord)
 {  
   GetChordFinder()->OnComputeStep(&pFieldTrack);
+
+  if (G4FieldStatistics::IsActive())
+  {
+    G4FieldStatistics::GetInstance()->SetCurrentVolume(
+      (pPhysVol != nullptr) ? pPhysVol->GetLogicalVolume()->GetName()
+                            : G4String("unknown"));
+  }
+
   const G4double deltaChord = GetChordFinder()->GetDeltaChord();
 
   // If CurrentProposedStepLength is too small for finding Chords
@@ -292,6 +305,26 @@ G4double G4PropagatorInField::ComputeStep(
   }
   fLast_ProposedStepLength = CurrentProposedStepLength;
 
+  // In a uniform field, first move along the exact helix as far as the
+  // safety allows. Only the remainder, if any, is left to the chord finder
+  // and intersection locator (not used after zero steps, for which the
+  // usual recovery applies)
+  //
+  if( fUseExactHelix && (fNoZeroStep <= fActionThreshold_NoZeroSteps) )
+  {
+    StepTaken = AdvanceExactHelix( CurrentState, CurrentProposedStepLength,
+                                   currentSafety );
+    if( StepTaken + kCarTolerance >= CurrentProposedStepLength )
+    {
+      End_PointAndTangent = CurrentState;
+      fLastStepInVolume = false;
+      fNoZeroStep = 0;
+      pFieldTrack = End_PointAndTangent;
+      return StepTaken;
+    }
+    first_substep = (StepTaken == 0.0);
+  }
+
   G4int do_loop_count = 0; 
   do  // Loop checking, 07.10.2016, JA
   { 
@@ -526,6 +559,116 @@ G4double G4PropagatorInField::ComputeStep(
   return TruePathLength;
 }
 
+// ---------------------------------------------------------------------------
+// Move along the exact helix in a uniform magnetic field, by steps
+// bounded by the safety
+//
+G4double G4PropagatorInField::AdvanceExactHelix( G4FieldTrack& state,
+                                                 G4double stepLength,
+                                                 G4double& startSafety )
+{
+  // Only for a pure uniform magnetic field, with the usual equation of
+  // motion (no spin, no additional forces)
+  //
+  auto field = dynamic_cast<const G4UniformMagField*>(
+                 fCurrentFieldMgr->GetDetectorField() );
+  auto equation = dynamic_cast<G4Mag_UsualEqRhs*>(
+                    GetCurrentEquationOfMotion() );
+  if( (field == nullptr) || (equation == nullptr)
+   || (typeid(*equation) != typeid(G4Mag_UsualEqRhs)) )
+  {
+    return 0.0;
+  }
+
+  const G4ThreeVector Bfield = field->GetConstantFieldValue();
+  const G4double Bmag = Bfield.mag();
+  const G4double momentum = state.GetMomentum().mag();
+  if( (Bmag == 0.0) || (momentum == 0.0) || (equation->FCof() == 0.0) )
+  {
+    return 0.0;  // Straight line: a single chord is already exact
+  }
+  G4FieldStatistics::Count(G4FieldStatistics::kFieldEvaluations);
+  const G4ThreeVector Bnorm = Bfield / Bmag;
+  G4ThreeVector position = state.GetPosition();
+  G4ThreeVector tangent = state.GetMomentumDir();
+
+  // Rotation angle of the direction per unit length; a move along the
+  // helix is worth it only if the safety exceeds the length of a chord
+  // within the allowed sagitta
+  //
+  const G4double invRadius = -equation->FCof() * Bmag / momentum;
+  const G4double curvature = std::fabs(invRadius)
+                           * Bnorm.cross(tangent).mag();
+  if( curvature == 0.0 )
+  {
+    return 0.0;
+  }
+  const G4double chordLength =
+    std::sqrt( 8.0 * GetChordFinder()->GetDeltaChord() / curvature );
+
+  G4double taken = 0.0;
+  while( taken < stepLength )  // Loop checking: each move exceeds chordLength
+  {
+    const G4double remaining = stepLength - taken;
+    if( taken > 0.0 )
+    {
+      fNavigator->LocateGlobalPointWithinVolume( position );
+    }
+    const G4double safety = fNavigator->ComputeSafety( position, remaining );
+    if( taken == 0.0 )
+    {
+      startSafety = safety;
+    }
+    fPreviousSftOrigin = position;
+    fPreviousSafety = safety;
+
+    G4double move;
+    if( safety >= remaining )
+    {
+      move = remaining;
+    }
+    else if( safety - kCarTolerance > chordLength )
+    {
+      move = safety - kCarTolerance;
+    }
+    else
+    {
+      break;
+    }
+
+    const G4ThreeVector vpar = Bnorm.dot(tangent) * Bnorm;
+    const G4ThreeVector vperp = tangent - vpar;
+    const G4ThreeVector BxT = Bnorm.cross(tangent);
+    const G4double theta = invRadius * move;
+    const G4double sinT = std::sin(theta);
+    const G4double sinHalfT = std::sin(0.5 * theta);
+    const G4double oneMinusCosT = 2.0 * sinHalfT * sinHalfT;
+
+    position += (sinT * vperp + oneMinusCosT * BxT) / invRadius + move * vpar;
+    tangent = ((1.0 - oneMinusCosT) * vperp + sinT * BxT + vpar).unit();
+    taken += move;
+    G4FieldStatistics::Count(G4FieldStatistics::kIntegrationSteps);
+
+    if (fpTrajectoryFilter != nullptr)
+    {
+      fpTrajectoryFilter->TakeIntermediatePoint(position);
+    }
+  }
+
+  if( taken > 0.0 )
+  {
+    const G4double restMass = state.GetRestMass();
+    const G4double energy = std::sqrt( momentum * momentum
+                                     + restMass * restMass );
+    state.SetPosition( position );
+    state.SetMomentum( momentum * tangent );
+    state.SetCurveLength( state.GetCurveLength() + taken );
+    state.SetLabTimeOfFlight( state.GetLabTimeOfFlight()
+                            + taken * energy / (momentum * CLHEP::c_light) );
+  }
+  return taken;
+}
+
 // ---------------------------------------------------------------------------
 // Dumps status of propagator
 //
@@ -43,6 +43,8 @@
 
 #include "G4VBooleanProcessor.hh"
 
+#include <atomic>
+
 class HepPolyhedronProcessor;
 
 
@@ -74,7 +76,8 @@ class G4BooleanSolid : public G4VSolid
       // If the solid is not a "Boolean", return 0.
 
     G4double GetCubicVolume() override;
-    inline G4double GetSurfaceArea() override;
+    G4double GetSurfaceArea() override;
+      // Estimates are shared through G4SolidPropertiesCache.
 
     G4GeometryType  GetEntityType() const override;
     G4Polyhedron* GetPolyhedron () const override;
@@ -83,13 +86,13 @@ class G4BooleanSolid : public G4VSolid
 
     inline G4int GetCubVolStatistics() const;
     inline G4double GetCubVolEpsilon() const;
-    inline void SetCubVolStatistics(G4int st);
-    inline void SetCubVolEpsilon(G4double ep);
+    void SetCubVolStatistics(G4int st);
+    void SetCubVolEpsilon(G4double ep);
    
     inline G4int GetAreaStatistics() const;
     inline G4double GetAreaAccuracy() const;
-    inline void SetAreaStatistics(G4int st);
-    inline void SetAreaAccuracy(G4double ep);
+    void SetAreaStatistics(G4int st);
+    void SetAreaAccuracy(G4double ep);
    
     G4ThreeVector GetPointOnSurface() const override;
 
@@ -117,6 +120,13 @@ class G4BooleanSolid : public G4VSolid
                                   const G4VSolid*) const;
       // Stack polyhedra for processing. Return top polyhedron.
 
+  private:
+
+    G4bool OverlapsExtent(const G4VSolid* primitive,
+                          const G4Transform3D& transform) const;
+      // Check if the extent of the placed primitive overlaps that of
+      // the solid.
+
   protected:
   
     G4VSolid* fPtrSolidA = nullptr;
@@ -139,7 +149,13 @@ class G4BooleanSolid : public G4VSolid
     mutable G4Polyhedron* fpPolyhedron = nullptr;
 
     mutable std::vector<std::pair<G4VSolid *,G4Transform3D>> fPrimitives;
+    mutable std::vector<G4double> fPrimitivesCumulativeArea;
     mutable G4double fPrimitivesSurfaceArea = 0.0;
+    mutable G4ThreeVector fPrimitivesMin, fPrimitivesMax;
+      // Extent of the solid, enlarged by the tolerance, for fast
+      // rejection of points generated on the primitives.
+    mutable std::atomic<G4bool> fPrimitivesReady{false};
+      // Set once the data above are filled, for use by all threads.
 
     G4bool  createdDisplacedSolid = false;
       // If & only if this object created it, it must delete it
@@ -38,6 +38,7 @@
 #ifndef G4MULTIUNION_HH
 #define G4MULTIUNION_HH
 
+#include <atomic>
 #include <vector>
 
 #include "G4VSolid.hh"
@@ -180,6 +181,10 @@ class G4MultiUnion : public G4VSolid
 
     mutable G4bool fRebuildPolyhedron = false;
     mutable G4Polyhedron* fpPolyhedron = nullptr;
+
+    mutable std::vector<G4double> fCumulativeArea; // For GetPointOnSurface()
+    mutable std::atomic<std::size_t> fCumulativeSize{0};
+      // Number of nodes for which fCumulativeArea is filled
 };
 
 //______________________________________________________________________________
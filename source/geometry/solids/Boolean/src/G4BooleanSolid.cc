@@ -34,15 +34,19 @@
 #include "G4DisplacedSolid.hh"
 #include "G4ReflectedSolid.hh"
 #include "G4ScaledSolid.hh"
+#include "G4SolidPropertiesCache.hh"
 #include "G4Polyhedron.hh"
 #include "HepPolyhedronProcessor.h"
 #include "G4QuickRand.hh"
 
 #include "G4AutoLock.hh"
 
+#include <algorithm>
+
 namespace
 {
   G4RecursiveMutex polyhedronMutex = G4MUTEX_INITIALIZER;
+  G4Mutex primitivesMutex = G4MUTEX_INITIALIZER;
 }
 
 G4VBooleanProcessor* G4BooleanSolid::fExternalBoolProcessor = nullptr;
@@ -121,6 +125,8 @@ G4BooleanSolid::G4BooleanSolid(const G4BooleanSolid& rhs)
     fSurfaceArea(rhs.fSurfaceArea),  createdDisplacedSolid(rhs.createdDisplacedSolid)
 {
   fPrimitives.resize(0); fPrimitivesSurfaceArea = 0.;
+  fPrimitivesCumulativeArea.resize(0);
+  fPrimitivesReady = false;
 }
 
 ///////////////////////////////////////////////////////////////
@@ -147,6 +153,8 @@ G4BooleanSolid& G4BooleanSolid::operator = (const G4BooleanSolid& rhs)
   fRebuildPolyhedron = false;
   delete fpPolyhedron; fpPolyhedron = nullptr;
   fPrimitives.resize(0); fPrimitivesSurfaceArea = 0.;
+  fPrimitivesCumulativeArea.resize(0);
+  fPrimitivesReady = false;
 
   return *this;
 }  
@@ -289,25 +297,46 @@ void G4BooleanSolid::GetListOfPrimitives(
 //////////////////////////////////////////////////////////////////////////
 //
 // Returns a point (G4ThreeVector) randomly and uniformly selected
-// on the surface of the solid
+// on the surface of the solid.
+// A primitive is selected with probability proportional to its area and
+// a point generated on it is accepted if it belongs to the surface of the
+// solid. Primitives lying entirely outside the extent of the solid can't
+// contribute to its surface and are given null weight; points outside the
+// extent are rejected without calling Inside(). Both are exact, as the
+// surface of the solid lies within its extent.
 
 G4ThreeVector G4BooleanSolid::GetPointOnSurface() const
 {
-  std::size_t nprims = fPrimitives.size();
-  std::pair<G4VSolid *, G4Transform3D> prim;
-
-  // Get list of primitives and find the total area of their surfaces
+  // Get list of primitives and the cumulative areas of their surfaces,
+  // used for selecting a primitive by binary search
   //
-  if (nprims == 0)
+  if (!fPrimitivesReady.load(std::memory_order_acquire))
   {
-    GetListOfPrimitives(fPrimitives, G4Transform3D());
-    nprims = fPrimitives.size();
-    fPrimitivesSurfaceArea = 0.;
-    for (std::size_t i=0; i<nprims; ++i)
+    G4AutoLock l(&primitivesMutex);
+    if (!fPrimitivesReady.load(std::memory_order_relaxed))
     {
-      fPrimitivesSurfaceArea += fPrimitives[i].first->GetSurfaceArea();
+      G4double tol = 0.5*kCarTolerance;
+      G4ThreeVector delta(tol, tol, tol);
+      BoundingLimits(fPrimitivesMin, fPrimitivesMax);
+      fPrimitivesMin -= delta;
+      fPrimitivesMax += delta;
+
+      fPrimitives.resize(0);
+      GetListOfPrimitives(fPrimitives, G4Transform3D());
+      fPrimitivesCumulativeArea.resize(fPrimitives.size());
+      fPrimitivesSurfaceArea = 0.;
+      for (std::size_t i=0; i<fPrimitives.size(); ++i)
+      {
+        if (OverlapsExtent(fPrimitives[i].first, fPrimitives[i].second))
+        {
+          fPrimitivesSurfaceArea += fPrimitives[i].first->GetSurfaceArea();
+        }
+        fPrimitivesCumulativeArea[i] = fPrimitivesSurfaceArea;
+      }
+      fPrimitivesReady.store(true, std::memory_order_release);
     }
   }
+  std::size_t nprims = fPrimitives.size();
 
   // Select random primitive, get random point on its surface and
   // check that the point belongs to the surface of the solid
@@ -316,15 +345,16 @@ G4ThreeVector G4BooleanSolid::GetPointOnSurface() const
   for (std::size_t k=0; k<100000; ++k) // try 100k times
   {
      G4double rand = fPrimitivesSurfaceArea * G4QuickRand();
-     G4double area = 0.;
-     for (std::size_t i=0; i<nprims; ++i)
-     {
-       prim  = fPrimitives[i];
-       area += prim.first->GetSurfaceArea();
-       if (rand < area) break;
-     }
+     auto pos = std::upper_bound(fPrimitivesCumulativeArea.cbegin(),
+                                 fPrimitivesCumulativeArea.cend(), rand);
+     std::size_t i = std::min(std::size_t(pos - fPrimitivesCumulativeArea.cbegin()),
+                              nprims - 1);
+     const auto& prim = fPrimitives[i];
      p = prim.first->GetPointOnSurface();
      p = prim.second * G4Point3D(p);
+     if (p.x() < fPrimitivesMin.x() || p.x() > fPrimitivesMax.x() ||
+         p.y() < fPrimitivesMin.y() || p.y() > fPrimitivesMax.y() ||
+         p.z() < fPrimitivesMin.z() || p.z() > fPrimitivesMax.z()) continue;
      if (Inside(p) == kSurface) return p;
   }
   std::ostringstream message;
@@ -336,6 +366,34 @@ G4ThreeVector G4BooleanSolid::GetPointOnSurface() const
   return p;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Checks whether the extent of a placed primitive overlaps the extent
+// of the solid
+
+G4bool G4BooleanSolid::OverlapsExtent(const G4VSolid* primitive,
+                                      const G4Transform3D& transform) const
+{
+  G4ThreeVector bmin, bmax;
+  primitive->BoundingLimits(bmin, bmax);
+  G4ThreeVector pmin( kInfinity, kInfinity, kInfinity);
+  G4ThreeVector pmax(-kInfinity,-kInfinity,-kInfinity);
+  for (auto icorner=0; icorner<8; ++icorner)
+  {
+    G4Point3D corner((icorner & 1) ? bmax.x() : bmin.x(),
+                     (icorner & 2) ? bmax.y() : bmin.y(),
+                     (icorner & 4) ? bmax.z() : bmin.z());
+    G4ThreeVector p = transform * corner;
+    pmin.set(std::min(pmin.x(), p.x()), std::min(pmin.y(), p.y()),
+             std::min(pmin.z(), p.z()));
+    pmax.set(std::max(pmax.x(), p.x()), std::max(pmax.y(), p.y()),
+             std::max(pmax.z(), p.z()));
+  }
+  return pmin.x() <= fPrimitivesMax.x() && pmax.x() >= fPrimitivesMin.x()
+      && pmin.y() <= fPrimitivesMax.y() && pmax.y() >= fPrimitivesMin.y()
+      && pmin.z() <= fPrimitivesMax.z() && pmax.z() >= fPrimitivesMin.z();
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // Returns polyhedron for visualization
@@ -415,16 +473,64 @@ G4BooleanSolid::StackPolyhedron(HepPolyhedronProcessor& processor,
 //////////////////////////////////////////////////////////////////////////
 //
 // Estimate Cubic Volume (capacity) and store it for reuse.
+// The estimate is shared across threads through G4SolidPropertiesCache.
 
 G4double G4BooleanSolid::GetCubicVolume()
 {
   if(fCubicVolume < 0.)
   {
-    fCubicVolume = EstimateCubicVolume(fStatistics,fCubVolEpsilon);
+    fCubicVolume = G4SolidPropertiesCache::GetInstance()
+                 ->GetCubicVolume(this, fStatistics, fCubVolEpsilon);
   }
   return fCubicVolume;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Estimate Surface Area and store it for reuse.
+
+G4double G4BooleanSolid::GetSurfaceArea()
+{
+  if(fSurfaceArea < 0.)
+  {
+    fSurfaceArea = G4SolidPropertiesCache::GetInstance()
+                 ->GetSurfaceArea(this, fStatistics, fAreaAccuracy);
+  }
+  return fSurfaceArea;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Set statistics and accuracy of the estimates, discarding cached values.
+
+void G4BooleanSolid::SetCubVolStatistics(G4int st)
+{
+  fCubicVolume = -1.;
+  fStatistics = st;
+  G4SolidPropertiesCache::GetInstance()->Invalidate(this);
+}
+
+void G4BooleanSolid::SetCubVolEpsilon(G4double ep)
+{
+  fCubicVolume = -1.;
+  fCubVolEpsilon = ep;
+  G4SolidPropertiesCache::GetInstance()->Invalidate(this);
+}
+
+void G4BooleanSolid::SetAreaStatistics(G4int st)
+{
+  fSurfaceArea = -1.;
+  fStatistics = st;
+  G4SolidPropertiesCache::GetInstance()->Invalidate(this);
+}
+
+void G4BooleanSolid::SetAreaAccuracy(G4double ep)
+{
+  fSurfaceArea = -1.;
+  fAreaAccuracy = ep;
+  G4SolidPropertiesCache::GetInstance()->Invalidate(this);
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // Set external Boolean processor.
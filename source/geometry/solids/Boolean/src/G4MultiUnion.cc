@@ -29,6 +29,7 @@
 // 06.04.17 G.Cosmo - Adapted implementation in Geant4 for VecGeom migration
 // --------------------------------------------------------------------
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -38,6 +39,7 @@
 #include "G4BoundingEnvelope.hh"
 #include "G4AffineTransform.hh"
 #include "G4DisplacedSolid.hh"
+#include "G4SolidPropertiesCache.hh"
 
 #include "G4VGraphicsScene.hh"
 #include "G4Polyhedron.hh"
@@ -51,6 +53,7 @@
 namespace
 {
   G4Mutex polyhedronMutex = G4MUTEX_INITIALIZER;
+  G4Mutex surfaceMutex = G4MUTEX_INITIALIZER;
 }
 
 //______________________________________________________________________________
@@ -818,7 +821,8 @@ G4double G4MultiUnion::GetSurfaceArea()
 {
   if (fSurfaceArea == 0.0)
   {
-    fSurfaceArea = EstimateSurfaceArea(1000000, 0.001);
+    fSurfaceArea = G4SolidPropertiesCache::GetInstance()
+                 ->GetSurfaceArea(this, 1000000, 0.001);
   }
   return fSurfaceArea;
 }
@@ -946,13 +950,37 @@ std::ostream& G4MultiUnion::StreamInfo(std::ostream& os) const
 //______________________________________________________________________________
 G4ThreeVector G4MultiUnion::GetPointOnSurface() const
 {
+  // Select constituent solids with probability proportional to the
+  // area of their surfaces, through a table of cumulative areas
+  //
+  if (fCumulativeSize.load(std::memory_order_acquire) != fSolids.size())
+  {
+    G4AutoLock l(&surfaceMutex);
+    if (fCumulativeSize.load(std::memory_order_relaxed) != fSolids.size())
+    {
+      std::vector<G4double> areas(fSolids.size());
+      G4double area = 0.;
+      for (std::size_t i = 0; i < fSolids.size(); ++i)
+      {
+        area += fSolids[i]->GetSurfaceArea();
+        areas[i] = area;
+      }
+      fCumulativeArea = std::move(areas);
+      fCumulativeSize.store(fSolids.size(), std::memory_order_release);
+    }
+  }
+
   G4ThreeVector point;
 
-  G4long size = fSolids.size();
+  std::size_t size = fSolids.size();
 
   do
   {
-    G4long rnd = G4RandFlat::shootInt(G4long(0), size);
+    G4double rand = fCumulativeArea.back() * G4UniformRand();
+    auto pos = std::upper_bound(fCumulativeArea.cbegin(),
+                                fCumulativeArea.cend(), rand);
+    std::size_t rnd = std::min(std::size_t(pos - fCumulativeArea.cbegin()),
+                               size - 1);
     G4VSolid& solid = *fSolids[rnd];
     point = solid.GetPointOnSurface();
     const G4Transform3D& transform = fTransformObjs[rnd];
@@ -30,6 +30,7 @@
 
 #include "G4ScaledSolid.hh"
 #include "G4BoundingEnvelope.hh"
+#include "G4SolidPropertiesCache.hh"
 
 #include "G4VPVParameterisation.hh"
 
@@ -353,6 +354,9 @@ void G4ScaledSolid::SetScaleTransform(const G4Scale3D& scale)
 {
   delete fScale; 
   fScale = new G4ScaleTransform(scale);
+  fCubicVolume = -1.;
+  fSurfaceArea = -1.;
+  G4SolidPropertiesCache::GetInstance()->Invalidate(this);
   fRebuildPolyhedron = true;
 }
 
@@ -380,7 +384,8 @@ G4double G4ScaledSolid::GetSurfaceArea()
 {
   if(fSurfaceArea < 0.)
   {
-    fSurfaceArea = G4VSolid::GetSurfaceArea();
+    fSurfaceArea = G4SolidPropertiesCache::GetInstance()
+                 ->GetSurfaceArea(this, 1000000, -1.);
   }
   return fSurfaceArea;
 }
@@ -148,8 +148,13 @@ class G4ExtrudedSolid : public G4TessellatedSolid
 
     void ComputeProjectionParameters();
     void ComputeLateralPlanes();
+    void ComputeEdgeBands();
+    inline std::size_t EdgeBand(G4double y) const;
     inline G4bool PointInPolygon(const G4ThreeVector& p) const;
+    inline G4double DistanceToEdgeSqr(const G4ThreeVector& p,
+                                      std::size_t i) const;
     inline G4double DistanceToPolygonSqr(const G4ThreeVector& p) const;
+    G4double DistanceToBandedPolygonSqr(const G4ThreeVector& p) const;
     G4ThreeVector ApproxSurfaceNormal(const G4ThreeVector& p) const;
 
     G4ThreeVector GetVertex(G4int iz, G4int ind) const;
@@ -196,6 +201,16 @@ class G4ExtrudedSolid : public G4TessellatedSolid
     std::vector<line> fLines;
     std::vector<G4double> fLengths;     // edge lengths
 
+    // Edges of the polygon sorted into bands in y, for polygons with
+    // many vertices; edge i joins vertices i-1 and i
+    //
+    G4double fBandY0 = 0.;
+    G4double fBandHeight = 0.;
+    std::vector<std::size_t> fBandStart;    // first entry of each band
+    std::vector<std::size_t> fBandEdges;    // edges of the bands
+    std::vector<std::size_t> fEdgeFirstBand;
+    std::vector<std::size_t> fEdgeLastBand;
+
     std::vector<G4double>      fKScales;
     std::vector<G4double>      fScale0s;
     std::vector<G4TwoVector>   fKOffsets;
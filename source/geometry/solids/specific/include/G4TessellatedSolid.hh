@@ -280,6 +280,9 @@ class G4TessellatedSolid : public G4VSolid
     G4double       fCubicVolume = 0.0;
     G4double       fSurfaceArea = 0.0;
 
+    std::vector<G4double> fCumulativeArea; // Cumulative areas of facets,
+                                           // for GetPointOnSurface()
+
     std::vector<G4ThreeVector> fVertexList;
 
     std::set<G4VertexInfo,G4VertexComparator> fFacetList;
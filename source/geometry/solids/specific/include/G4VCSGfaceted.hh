@@ -29,6 +29,9 @@
 //
 //   Virtual class defining CSG-like type shape that is built entirely
 //   of G4CSGface faces.
+//   For shapes with many faces, an index of the faces by z-section is
+//   built once the faces are created, so that point and ray queries
+//   only consider the faces of the sections they can reach.
 
 // Author: David C. Williams (davidw@scipp.ucsc.edu)
 // --------------------------------------------------------------------
@@ -37,6 +40,8 @@
 
 #include "G4VSolid.hh"
 
+#include <vector>
+
 class G4VCSGface;
 class G4VisExtent;
 
@@ -121,8 +126,45 @@ class G4VCSGfaceted : public G4VSolid
     void CopyStuff( const G4VCSGfaceted& source );
     void DeleteStuff();
 
+    void BuildSectionIndex();
+      // Builds the lookup table of faces by z-section. To be called by
+      // concrete shapes once their faces have been created; does nothing
+      // for shapes with few faces, which are then simply looped over.
+
   private:
 
+    G4int SectionIndex( G4double z ) const;
+      // Returns the index of the z-section containing z, clamped to
+      // the sections of the lookup table.
+
+    template <class Visitor>
+    void VisitFacesNear( G4double z, const G4double& bound,
+                         Visitor&& visit ) const;
+      // Calls visit(iface) on every face which may be closer than bound
+      // to a point at height z, bound being updated by the caller as
+      // faces are visited. Iteration stops if visit returns true.
+
+    template <class Visitor>
+    void VisitFacesAlong( const G4ThreeVector& p, const G4ThreeVector& v,
+                          const G4double& limit, Visitor&& visit ) const;
+      // Calls visit(iface) on every face which may be intersected by the
+      // ray (p,v) at a distance not larger than limit, section after
+      // section along the ray. Iteration stops if visit returns true.
+
+    std::vector<G4double> fSectionZ;
+      // Boundaries of the z-sections, in increasing order
+    std::vector<G4double> fSectionRmax;
+      // Maximum radius of the faces in each section
+    std::vector<G4int> fSectionStart;
+    std::vector<G4int> fSectionFaces;
+      // Faces of each section, in increasing order of face index:
+      // fSectionFaces[fSectionStart[i]] to fSectionFaces[fSectionStart[i+1]-1]
+    std::vector<G4int> fFaceFirstSection;
+    std::vector<G4int> fFaceLastSection;
+    std::vector<G4double> fFaceZmin;
+    std::vector<G4double> fFaceZmax;
+      // Range of sections and z-extent of each face
+
     G4int    fStatistics;
     G4double fCubVolEpsilon;
     G4double fAreaAccuracy;
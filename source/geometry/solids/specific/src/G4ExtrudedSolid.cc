@@ -171,6 +171,7 @@ G4ExtrudedSolid::G4ExtrudedSolid( const G4String& pName,
   fIsConvex = G4GeomTools::IsConvex(fPolygon);
   
   ComputeProjectionParameters();
+  ComputeEdgeBands();
 
   // Check if the solid is a right prism, if so then set lateral planes
   //
@@ -267,6 +268,7 @@ G4ExtrudedSolid::G4ExtrudedSolid( const G4String& pName,
   fIsConvex = G4GeomTools::IsConvex(fPolygon);
 
   ComputeProjectionParameters();
+  ComputeEdgeBands();
 
   // Check if the solid is a right prism, if so then set lateral planes
   //
@@ -313,6 +315,9 @@ G4ExtrudedSolid& G4ExtrudedSolid::operator = (const G4ExtrudedSolid& rhs)
    fLines = rhs.fLines; fLengths = rhs.fLengths;
    fKScales = rhs.fKScales; fScale0s = rhs.fScale0s;
    fKOffsets = rhs.fKOffsets; fOffset0s = rhs.fOffset0s;
+   fBandY0 = rhs.fBandY0; fBandHeight = rhs.fBandHeight;
+   fBandStart = rhs.fBandStart; fBandEdges = rhs.fBandEdges;
+   fEdgeFirstBand = rhs.fEdgeFirstBand; fEdgeLastBand = rhs.fEdgeLastBand;
 
    return *this;
 }
@@ -398,6 +403,131 @@ void G4ExtrudedSolid::ComputeLateralPlanes()
 
 //_____________________________________________________________________________
 
+void G4ExtrudedSolid::ComputeEdgeBands()
+{
+  // Sort the polygon edges into bands of equal height in y, so that
+  // point queries only look at the edges near the point. An edge is
+  // listed in all the bands its y-extent, enlarged by the tolerance,
+  // overlaps with. Not worth for polygons with few vertices
+  //
+  fBandStart.clear();
+  fBandEdges.clear();
+  fEdgeFirstBand.clear();
+  fEdgeLastBand.clear();
+  if (fNv < 16) { return; }
+
+  G4double ymin = kInfinity, ymax = -kInfinity;
+  for (const auto& v : fPolygon)
+  {
+    ymin = std::min(ymin, v.y());
+    ymax = std::max(ymax, v.y());
+  }
+  fBandY0 = ymin;
+
+  // Reduce the number of bands if the edges are listed too many times,
+  // as for comb-like polygons
+  //
+  fEdgeFirstBand.resize(fNv);
+  fEdgeLastBand.resize(fNv);
+  std::size_t nbands = fNv;
+  std::size_t nentries = 0;
+  while (true)
+  {
+    fBandHeight = (ymax - ymin)/nbands;
+    fBandStart.assign(nbands+1, 0);
+    nentries = 0;
+    for (std::size_t i=0, k=fNv-1; i<fNv; k=i++)
+    {
+      G4double y1 = std::min(fPolygon[k].y(), fPolygon[i].y()) - kCarTolerance;
+      G4double y2 = std::max(fPolygon[k].y(), fPolygon[i].y()) + kCarTolerance;
+      fEdgeFirstBand[i] = EdgeBand(y1);
+      fEdgeLastBand[i] = EdgeBand(y2);
+      nentries += fEdgeLastBand[i] - fEdgeFirstBand[i] + 1;
+    }
+    if (nbands == 1 || nentries <= 8*fNv) { break; }
+    nbands /= 2;
+  }
+  if (nbands == 1)
+  {
+    fBandStart.clear();
+    fEdgeFirstBand.clear();
+    fEdgeLastBand.clear();
+    return;
+  }
+
+  // Edges of each band, in increasing order
+  //
+  for (std::size_t i=0; i<fNv; ++i)
+  {
+    for (std::size_t ib=fEdgeFirstBand[i]; ib<=fEdgeLastBand[i]; ++ib)
+    {
+      ++fBandStart[ib+1];
+    }
+  }
+  for (std::size_t ib=0; ib<nbands; ++ib)
+  {
+    fBandStart[ib+1] += fBandStart[ib];
+  }
+  fBandEdges.resize(nentries);
+  std::vector<std::size_t> fill(fBandStart.cbegin(), fBandStart.cend()-1);
+  for (std::size_t i=0; i<fNv; ++i)
+  {
+    for (std::size_t ib=fEdgeFirstBand[i]; ib<=fEdgeLastBand[i]; ++ib)
+    {
+      fBandEdges[fill[ib]++] = i;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+
+G4double
+G4ExtrudedSolid::DistanceToBandedPolygonSqr(const G4ThreeVector& p) const
+{
+  // Search the edges band after band, starting from the band containing
+  // the point, until the bands are farther than the closest edge found.
+  // Edges spanning several bands are looked at in the first one reached
+  //
+  std::size_t nbands = fBandStart.size() - 1;
+  std::size_t ib = EdgeBand(p.y());
+
+  G4double dd = DBL_MAX;
+  for (std::size_t j=fBandStart[ib]; j<fBandStart[ib+1]; ++j)
+  {
+    G4double tmp = DistanceToEdgeSqr(p, fBandEdges[j]);
+    if (tmp < dd) dd = tmp;
+  }
+
+  for (std::size_t jb=ib; jb-- > 0; )   // bands below
+  {
+    G4double dy = p.y() - (fBandY0 + (jb+1)*fBandHeight);
+    if (dy > 0 && dy*dy > dd) break;
+    for (std::size_t j=fBandStart[jb]; j<fBandStart[jb+1]; ++j)
+    {
+      std::size_t i = fBandEdges[j];
+      if (fEdgeLastBand[i] != jb) continue;
+      G4double tmp = DistanceToEdgeSqr(p, i);
+      if (tmp < dd) dd = tmp;
+    }
+  }
+
+  for (std::size_t jb=ib+1; jb<nbands; ++jb)   // bands above
+  {
+    G4double dy = (fBandY0 + jb*fBandHeight) - p.y();
+    if (dy > 0 && dy*dy > dd) break;
+    for (std::size_t j=fBandStart[jb]; j<fBandStart[jb+1]; ++j)
+    {
+      std::size_t i = fBandEdges[j];
+      if (fEdgeFirstBand[i] != jb) continue;
+      G4double tmp = DistanceToEdgeSqr(p, i);
+      if (tmp < dd) dd = tmp;
+    }
+  }
+  return dd;
+}
+
+//_____________________________________________________________________________
+
 G4ThreeVector G4ExtrudedSolid::GetVertex(G4int iz, G4int ind) const
 {
   // Shift and scale vertices
@@ -903,30 +1033,62 @@ EInside G4ExtrudedSolid::Inside(const G4ThreeVector &p) const
   //
   G4TwoVector pscaled = ProjectPoint(p);
   
-  // Check if on surface of polygon
-  //
-  for ( G4int i=0; i<(G4int)fNv; ++i )
+  G4bool inside = false;
+  if ( !fBandEdges.empty() )
   {
-    G4int j = (i+1) % fNv;
-    if ( IsSameLineSegment(pscaled, fPolygon[i], fPolygon[j]) )
+    // Many vertices: only look at the edges in the band of the point.
+    // Check if on surface of polygon, then count the edges crossed
+    // on the left of the point
+    //
+    std::size_t ib = EdgeBand(pscaled.y());
+    for ( std::size_t j=fBandStart[ib]; j<fBandStart[ib+1]; ++j )
     {
-      // G4cout << "G4ExtrudedSolid::Inside return Surface (on polygon) "
-      //        << G4endl;
-
-      return kSurface;
+      std::size_t i = fBandEdges[j];
+      std::size_t k = (i == 0) ? fNv-1 : i-1;
+      if ( IsSameLineSegment(pscaled, fPolygon[k], fPolygon[i]) )
+      {
+        return kSurface;
+      }
+    }
+    for ( std::size_t j=fBandStart[ib]; j<fBandStart[ib+1]; ++j )
+    {
+      std::size_t i = fBandEdges[j];
+      std::size_t k = (i == 0) ? fNv-1 : i-1;
+      const G4TwoVector& a = fPolygon[k];
+      const G4TwoVector& b = fPolygon[i];
+      if ( (b.y() > pscaled.y()) != (a.y() > pscaled.y()) )
+      {
+        G4double x = b.x() + (pscaled.y()-b.y())*(a.x()-b.x())/(a.y()-b.y());
+        inside ^= (x < pscaled.x());
+      }
     }
   }
-
-  // Now check if inside triangles
-  //
-  auto it = fTriangles.cbegin();
-  G4bool inside = false;
-  do    // Loop checking, 13.08.2015, G.Cosmo
+  else
   {
-    if ( IsPointInside(fPolygon[(*it)[0]], fPolygon[(*it)[1]],
-                       fPolygon[(*it)[2]], pscaled) )  { inside = true; }
-    ++it;
-  } while ( (!inside) && (it != fTriangles.cend()) );
+    // Check if on surface of polygon
+    //
+    for ( G4int i=0; i<(G4int)fNv; ++i )
+    {
+      G4int j = (i+1) % fNv;
+      if ( IsSameLineSegment(pscaled, fPolygon[i], fPolygon[j]) )
+      {
+        // G4cout << "G4ExtrudedSolid::Inside return Surface (on polygon) "
+        //        << G4endl;
+
+        return kSurface;
+      }
+    }
+
+    // Now check if inside triangles
+    //
+    auto it = fTriangles.cbegin();
+    do    // Loop checking, 13.08.2015, G.Cosmo
+    {
+      if ( IsPointInside(fPolygon[(*it)[0]], fPolygon[(*it)[1]],
+                         fPolygon[(*it)[2]], pscaled) )  { inside = true; }
+      ++it;
+    } while ( (!inside) && (it != fTriangles.cend()) );
+  }
 
   if ( inside )
   {
@@ -990,9 +1152,23 @@ G4ThreeVector G4ExtrudedSolid::SurfaceNormal(const G4ThreeVector& p) const
         nz =  1; ++nsurf;
       }
 
+      // Only the edges of the band containing p can be close to it
+      //
+      std::size_t jbeg = 0, jend = fNv;
+      const std::size_t* edges = nullptr;
+      if (!fBandEdges.empty())
+      {
+        std::size_t ib = EdgeBand(p.y());
+        jbeg = fBandStart[ib];
+        jend = fBandStart[ib+1];
+        edges = fBandEdges.data();
+      }
+
       G4double sqrCarToleranceHalf = kCarToleranceHalf*kCarToleranceHalf;
-      for (std::size_t i=0, k=fNv-1; i<fNv; k=i++)
+      for (std::size_t j=jbeg; j<jend; ++j)
       {
+        std::size_t i = (edges != nullptr) ? edges[j] : j;
+        std::size_t k = (i == 0) ? fNv-1 : i-1;
         G4double ix = p.x() - fPolygon[i].x();
         G4double iy = p.y() - fPolygon[i].y();
         G4double u  = fPlanes[i].a*iy - fPlanes[i].b*ix;
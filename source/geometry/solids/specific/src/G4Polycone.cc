@@ -324,6 +324,11 @@ void G4Polycone::Create( G4double phiStart,
   //
   enclosingCylinder =
     new G4EnclosingCylinder( rz, phiIsOpen, phiStart, phiTotal );
+
+  //
+  // Index the faces by z-section
+  //
+  BuildSectionIndex();
 }
 
 // Fake default constructor - sets only member data and allocates memory
@@ -175,6 +175,7 @@ void G4TessellatedSolid::DeleteObjects()
   std::size_t size = fFacets.size();
   for (std::size_t i = 0; i < size; ++i)  { delete fFacets[i]; }
   fFacets.clear();
+  fCumulativeArea.clear();
   delete fpPolyhedron; fpPolyhedron = nullptr;
 }
 
@@ -607,6 +608,17 @@ void G4TessellatedSolid::SetSolidClosed (const G4bool t)
 #endif
     Voxelize();
 
+    // Cumulative areas of facets, for sampling points on surface
+    //
+    std::size_t nfacets = fFacets.size();
+    fCumulativeArea.resize(nfacets);
+    G4double area = 0.;
+    for (std::size_t i = 0; i < nfacets; ++i)
+    {
+      area += fFacets[i]->GetArea();
+      fCumulativeArea[i] = area;
+    }
+
 #ifdef G4SPECSDEBUG
     DisplayAllocatedMemory();
 #endif
@@ -2148,9 +2160,21 @@ G4double G4TessellatedSolid::GetSurfaceArea ()
 //
 G4ThreeVector G4TessellatedSolid::GetPointOnSurface() const
 {
-  // Select randomly a facet and return a random point on it
+  // Select randomly a facet, with probability proportional to its area
+  // if the solid is closed, and return a random point on it
 
-  auto i = (G4int) G4RandFlat::shoot(0., fFacets.size());
+  std::size_t nfacets = fFacets.size();
+  if (fCumulativeArea.empty() || fCumulativeArea.size() != nfacets
+   || fCumulativeArea.back() <= 0.)
+  {
+    auto i = (G4int) G4RandFlat::shoot(0., nfacets);
+    return fFacets[i]->GetPointOnFace();
+  }
+  G4double rand = fCumulativeArea.back() * G4UniformRand();
+  auto pos = std::upper_bound(fCumulativeArea.cbegin(),
+                              fCumulativeArea.cend(), rand);
+  std::size_t i = std::min(std::size_t(pos - fCumulativeArea.cbegin()),
+                           nfacets - 1);
   return fFacets[i]->GetPointOnFace();
 }
 
@@ -44,9 +44,15 @@
 
 #include "G4AutoLock.hh"
 
+#include <algorithm>
+
 namespace
 {
   G4Mutex polyhedronMutex = G4MUTEX_INITIALIZER;
+
+  // Minimum number of faces for which the z-section index is built
+  //
+  const G4int kMinFacesForSectionIndex = 16;
 }
 
 //
@@ -139,6 +145,15 @@ void G4VCSGfaceted::CopyStuff( const G4VCSGfaceted& source )
   fSurfaceArea = source.fSurfaceArea;
   fRebuildPolyhedron = false;
   fpPolyhedron = nullptr;
+
+  fSectionZ = source.fSectionZ;
+  fSectionRmax = source.fSectionRmax;
+  fSectionStart = source.fSectionStart;
+  fSectionFaces = source.fSectionFaces;
+  fFaceFirstSection = source.fFaceFirstSection;
+  fFaceLastSection = source.fFaceLastSection;
+  fFaceZmin = source.fFaceZmin;
+  fFaceZmax = source.fFaceZmax;
 }
 
 
@@ -160,6 +175,267 @@ void G4VCSGfaceted::DeleteStuff()
     delete [] faces;
   }
   delete fpPolyhedron; fpPolyhedron = nullptr;
+
+  fSectionZ.clear();
+  fSectionRmax.clear();
+  fSectionStart.clear();
+  fSectionFaces.clear();
+  fFaceFirstSection.clear();
+  fFaceLastSection.clear();
+  fFaceZmin.clear();
+  fFaceZmax.clear();
+}
+
+
+//
+// BuildSectionIndex (protected)
+//
+// Sort the faces into sections delimited by the distinct z-limits of
+// the faces. Each face is listed, in order of index, in all the sections
+// its z-extent (enlarged by the tolerance) overlaps with.
+//
+void G4VCSGfaceted::BuildSectionIndex()
+{
+  fSectionZ.clear();
+  fSectionRmax.clear();
+  fSectionStart.clear();
+  fSectionFaces.clear();
+  fFaceFirstSection.clear();
+  fFaceLastSection.clear();
+  fFaceZmin.clear();
+  fFaceZmax.clear();
+  if (numFace < kMinFacesForSectionIndex) { return; }
+
+  const G4ThreeVector xAxis(1,0,0), yAxis(0,1,0), zAxis(0,0,1);
+  std::vector<G4double> faceRmax(numFace);
+  std::vector<G4double> limits;
+  limits.reserve(2*numFace);
+  fFaceZmin.resize(numFace);
+  fFaceZmax.resize(numFace);
+  for (G4int i=0; i<numFace; ++i)
+  {
+    G4double zmin = -faces[i]->Extent(-zAxis);
+    G4double zmax =  faces[i]->Extent( zAxis);
+    G4double xmax = std::max(faces[i]->Extent(xAxis), faces[i]->Extent(-xAxis));
+    G4double ymax = std::max(faces[i]->Extent(yAxis), faces[i]->Extent(-yAxis));
+    faceRmax[i] = std::sqrt(xmax*xmax + ymax*ymax);
+    fFaceZmin[i] = zmin - kCarTolerance;
+    fFaceZmax[i] = zmax + kCarTolerance;
+    limits.push_back(zmin);
+    limits.push_back(zmax);
+  }
+
+  // Section boundaries: distinct z-limits of the faces
+  //
+  std::sort(limits.begin(), limits.end());
+  fSectionZ.push_back(limits.front());
+  for (auto z : limits)
+  {
+    if (z - fSectionZ.back() > kCarTolerance) { fSectionZ.push_back(z); }
+  }
+  auto nsec = (G4int)fSectionZ.size() - 1;
+  if (nsec < 2)
+  {
+    fSectionZ.clear();
+    fFaceZmin.clear();
+    fFaceZmax.clear();
+    return;
+  }
+
+  // Range of sections of each face
+  //
+  fFaceFirstSection.resize(numFace);
+  fFaceLastSection.resize(numFace);
+  std::vector<G4int> count(nsec, 0);
+  for (G4int i=0; i<numFace; ++i)
+  {
+    auto first = (G4int)(std::lower_bound(fSectionZ.cbegin()+1,
+                         fSectionZ.cend(), fFaceZmin[i]) - fSectionZ.cbegin()) - 1;
+    auto last = (G4int)(std::upper_bound(fSectionZ.cbegin(),
+                        fSectionZ.cend(), fFaceZmax[i]) - fSectionZ.cbegin()) - 1;
+    first = std::min(std::max(first, 0), nsec-1);
+    last = std::min(std::max(last, first), nsec-1);
+    fFaceFirstSection[i] = first;
+    fFaceLastSection[i] = last;
+    for (G4int k=first; k<=last; ++k) { ++count[k]; }
+  }
+
+  // Faces of each section
+  //
+  fSectionStart.resize(nsec+1, 0);
+  for (G4int k=0; k<nsec; ++k)
+  {
+    fSectionStart[k+1] = fSectionStart[k] + count[k];
+    count[k] = fSectionStart[k];
+  }
+  fSectionFaces.resize(fSectionStart[nsec]);
+  fSectionRmax.resize(nsec, 0.);
+  for (G4int i=0; i<numFace; ++i)
+  {
+    for (G4int k=fFaceFirstSection[i]; k<=fFaceLastSection[i]; ++k)
+    {
+      fSectionFaces[count[k]++] = i;
+      fSectionRmax[k] = std::max(fSectionRmax[k], faceRmax[i]);
+    }
+  }
+}
+
+
+//
+// SectionIndex (private)
+//
+G4int G4VCSGfaceted::SectionIndex( G4double z ) const
+{
+  auto nsec = (G4int)fSectionZ.size() - 1;
+  auto k = (G4int)(std::upper_bound(fSectionZ.cbegin(), fSectionZ.cend(), z)
+                   - fSectionZ.cbegin()) - 1;
+  return std::min(std::max(k, 0), nsec-1);
+}
+
+
+//
+// VisitFacesNear (private)
+//
+// Faces are visited first in the section containing z, then in the
+// sections below and above, as long as these are closer than bound.
+// Every face is visited at most once. Without section index, all faces
+// are visited in order.
+//
+template <class Visitor>
+void G4VCSGfaceted::VisitFacesNear( G4double z, const G4double& bound,
+                                    Visitor&& visit ) const
+{
+  if (fSectionFaces.empty())
+  {
+    for (G4int i=0; i<numFace; ++i)
+    {
+      if (visit(i)) { return; }
+    }
+    return;
+  }
+
+  auto nsec = (G4int)fSectionZ.size() - 1;
+  G4int isec = SectionIndex(z);
+  for (G4int k=fSectionStart[isec]; k<fSectionStart[isec+1]; ++k)
+  {
+    if (visit(fSectionFaces[k])) { return; }
+  }
+
+  // Sections below: faces not reaching section isec, visited in
+  // their upper section
+  //
+  for (G4int j=isec-1; j>=0; --j)
+  {
+    if (z - fSectionZ[j+1] > bound + kCarTolerance) { break; }
+    for (G4int k=fSectionStart[j]; k<fSectionStart[j+1]; ++k)
+    {
+      G4int i = fSectionFaces[k];
+      if (fFaceLastSection[i] != j) { continue; }
+      if (z - fFaceZmax[i] > bound + kCarTolerance) { continue; }
+      if (visit(i)) { return; }
+    }
+  }
+
+  // Sections above: faces not reaching section isec, visited in
+  // their lower section
+  //
+  for (G4int j=isec+1; j<nsec; ++j)
+  {
+    if (fSectionZ[j] - z > bound + kCarTolerance) { break; }
+    for (G4int k=fSectionStart[j]; k<fSectionStart[j+1]; ++k)
+    {
+      G4int i = fSectionFaces[k];
+      if (fFaceFirstSection[i] != j) { continue; }
+      if (fFaceZmin[i] - z > bound + kCarTolerance) { continue; }
+      if (visit(i)) { return; }
+    }
+  }
+}
+
+
+//
+// VisitFacesAlong (private)
+//
+// Sections are traversed in the order they are crossed by the ray,
+// until the ray enters a section beyond limit. Sections the ray crosses
+// at a radius larger than all of their faces are skipped. Every face is
+// visited at most once, in the first tested section it belongs to.
+// Without section index, all faces are visited in order.
+//
+template <class Visitor>
+void G4VCSGfaceted::VisitFacesAlong( const G4ThreeVector& p,
+                                     const G4ThreeVector& v,
+                                     const G4double& limit,
+                                           Visitor&& visit ) const
+{
+  if (fSectionFaces.empty())
+  {
+    for (G4int i=0; i<numFace; ++i)
+    {
+      if (visit(i)) { return; }
+    }
+    return;
+  }
+
+  auto nsec = (G4int)fSectionZ.size() - 1;
+  G4int isec = SectionIndex(p.z());
+  G4int step = (v.z() < 0) ? -1 : 1;
+  G4int lastTested = isec - step;
+
+  // Squared distance from the z-axis along the ray: c + 2*b*t + a*t*t
+  //
+  G4double a = v.x()*v.x() + v.y()*v.y();
+  G4double b = p.x()*v.x() + p.y()*v.y();
+  G4double c = p.x()*p.x() + p.y()*p.y();
+
+  for (G4int j=isec; j>=0 && j<nsec; j+=step)
+  {
+    // Range of distances along the ray within the section
+    //
+    G4double tmin = 0., tmax = kInfinity;
+    if (v.z() != 0.)
+    {
+      G4double t1 = (fSectionZ[j] - kCarTolerance - p.z())/v.z();
+      G4double t2 = (fSectionZ[j+1] + kCarTolerance - p.z())/v.z();
+      tmin = std::min(t1, t2);
+      tmax = std::max(t1, t2);
+      if (j != isec && tmin > limit + kCarTolerance) { return; }
+      tmin = std::max(tmin, 0.);
+    }
+    else if (j != isec)
+    {
+      return;
+    }
+
+    // Skip the section if the ray passes beyond all of its faces
+    //
+    if (tmax >= tmin)
+    {
+      G4double rho2 = c;
+      if (a > 0.)
+      {
+        G4double t = std::min(std::max(-b/a, tmin), tmax);
+        rho2 = c + t*(2.*b + a*t);
+      }
+      G4double rlim = fSectionRmax[j] + kCarTolerance;
+      if (rho2 > rlim*rlim) { continue; }
+    }
+
+    for (G4int k=fSectionStart[j]; k<fSectionStart[j+1]; ++k)
+    {
+      G4int i = fSectionFaces[k];
+      if (step > 0)
+      {
+        if (lastTested >= std::max(fFaceFirstSection[i], isec)) { continue; }
+      }
+      else
+      {
+        if (lastTested <= std::min(fFaceLastSection[i], isec)) { continue; }
+      }
+      if (visit(i)) { return; }
+    }
+    lastTested = j;
+  }
 }
 
 
@@ -201,19 +477,21 @@ G4bool G4VCSGfaceted::CalculateExtent( const EAxis axis,
 EInside G4VCSGfaceted::Inside( const G4ThreeVector& p ) const
 {
   EInside answer=kOutside;
-  G4VCSGface **face = faces;
   G4double best = kInfinity;
-  do    // Loop checking, 13.08.2015, G.Cosmo
+  G4int bestIndex = numFace;
+  VisitFacesNear( p.z(), best, [&](G4int i)
   {
     G4double distance;
-    EInside result = (*face)->Inside( p, kCarTolerance/2, &distance );
-    if (result == kSurface) { return kSurface; }
-    if (distance < best)
+    EInside result = faces[i]->Inside( p, kCarTolerance/2, &distance );
+    if (result == kSurface) { answer = kSurface; return true; }
+    if (distance < best || (distance == best && i < bestIndex))
     {
       best = distance;
+      bestIndex = i;
       answer = result;
     }
-  } while( ++face < faces + numFace );
+    return false;
+  } );
 
   return answer;
 }
@@ -225,18 +503,20 @@ EInside G4VCSGfaceted::Inside( const G4ThreeVector& p ) const
 G4ThreeVector G4VCSGfaceted::SurfaceNormal( const G4ThreeVector& p ) const
 {
   G4ThreeVector answer;
-  G4VCSGface **face = faces;
   G4double best = kInfinity;
-  do    // Loop checking, 13.08.2015, G.Cosmo
+  G4int bestIndex = numFace;
+  VisitFacesNear( p.z(), best, [&](G4int i)
   {
     G4double distance = kInfinity;
-    G4ThreeVector normal = (*face)->Normal( p, &distance );
-    if (distance < best)
+    G4ThreeVector normal = faces[i]->Normal( p, &distance );
+    if (distance < best || (distance == best && i < bestIndex))
     {
       best = distance;
+      bestIndex = i;
       answer = normal;
     }
-  } while( ++face < faces + numFace );
+    return false;
+  } );
 
   return answer;
 }
@@ -250,15 +530,14 @@ G4double G4VCSGfaceted::DistanceToIn( const G4ThreeVector& p,
 {
   G4double distance = kInfinity;
   G4double distFromSurface = kInfinity;
-  G4VCSGface **face = faces;
-  G4VCSGface *bestFace = *face;
-  do    // Loop checking, 13.08.2015, G.Cosmo
+  G4VCSGface *bestFace = *faces;
+  VisitFacesAlong( p, v, distance, [&](G4int i)
   {
     G4double   faceDistance,
                faceDistFromSurface;
     G4ThreeVector   faceNormal;
     G4bool    faceAllBehind;
-    if ((*face)->Intersect( p, v, false, kCarTolerance/2,
+    if (faces[i]->Intersect( p, v, false, kCarTolerance/2,
                 faceDistance, faceDistFromSurface,
                 faceNormal, faceAllBehind ) )
     {
@@ -269,12 +548,14 @@ G4double G4VCSGfaceted::DistanceToIn( const G4ThreeVector& p,
       {
         distance = faceDistance;
         distFromSurface = faceDistFromSurface;
-        bestFace = *face;
-        if (distFromSurface <= 0) { return 0; }
+        bestFace = faces[i];
+        if (distFromSurface <= 0) { return true; }
       }
     }
-  } while( ++face < faces + numFace );
-  
+    return false;
+  } );
+  if (distFromSurface <= 0) { return 0; }
+
   if (distance < kInfinity && distFromSurface<kCarTolerance/2)
   {
     if (bestFace->Distance(p,false) < kCarTolerance/2)  { distance = 0; }
@@ -306,16 +587,19 @@ G4double G4VCSGfaceted::DistanceToOut( const G4ThreeVector& p,
   G4double distance = kInfinity;
   G4double distFromSurface = kInfinity;
   G4ThreeVector normal;
-  
-  G4VCSGface **face = faces;
-  G4VCSGface *bestFace = *face;
-  do    // Loop checking, 13.08.2015, G.Cosmo
+
+  // Faces beyond the exit point only matter for telling whether the
+  // solid lies entirely behind it, as long as this is still possible
+  //
+  G4double limit = kInfinity;
+  G4VCSGface *bestFace = *faces;
+  VisitFacesAlong( p, v, limit, [&](G4int i)
   {
     G4double  faceDistance,
               faceDistFromSurface;
     G4ThreeVector  faceNormal;
     G4bool    faceAllBehind;
-    if ((*face)->Intersect( p, v, true, kCarTolerance/2,
+    if (faces[i]->Intersect( p, v, true, kCarTolerance/2,
                 faceDistance, faceDistFromSurface,
                 faceNormal, faceAllBehind ) )
     {
@@ -328,11 +612,13 @@ G4double G4VCSGfaceted::DistanceToOut( const G4ThreeVector& p,
         distance = faceDistance;
         distFromSurface = faceDistFromSurface;
         normal = faceNormal;
-        bestFace = *face;
-        if (distFromSurface <= 0.)  { break; }
+        bestFace = faces[i];
+        if (distFromSurface <= 0.)  { return true; }
       }
+      if (!calcNorm || !allBehind)  { limit = distance; }
     }
-  } while( ++face < faces + numFace );
+    return false;
+  } );
   
   if (distance < kInfinity)
   {
@@ -378,13 +664,13 @@ G4double G4VCSGfaceted::DistanceToOut( const G4ThreeVector& p ) const
 G4double G4VCSGfaceted::DistanceTo( const G4ThreeVector& p,
                                     const G4bool outgoing ) const
 {
-  G4VCSGface **face = faces;
   G4double best = kInfinity;
-  do    // Loop checking, 13.08.2015, G.Cosmo
+  VisitFacesNear( p.z(), best, [&](G4int i)
   {
-    G4double distance = (*face)->Distance( p, outgoing );
+    G4double distance = faces[i]->Distance( p, outgoing );
     if (distance < best)  { best = distance; }
-  } while( ++face < faces + numFace );
+    return false;
+  } );
 
   return (best < 0.5*kCarTolerance) ? 0. : best;
 }
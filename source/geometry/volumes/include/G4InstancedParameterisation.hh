@@ -0,0 +1,113 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4InstancedParameterisation
+//
+// Class description:
+//
+// Parameterisation for many copies of the same logical volume, differing
+// only by their position and orientation. Translations are kept in a
+// packed array, one entry per instance; rotations are either shared by
+// all instances or stored once per distinct orientation and referenced by
+// a 32-bit index. The copy number of an instance is its index in the
+// array. Solid and material are not parameterised.
+//
+// The parameterisation also provides the bounding box of each instance
+// in the mother frame (ComputeExtent()), allowing voxelisation to skip
+// the computation of the extent of each copy of the solid.
+// Normally used through G4PVInstanced.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4INSTANCEDPARAMETERISATION_HH
+#define G4INSTANCEDPARAMETERISATION_HH
+
+#include <cstdint>
+#include <vector>
+
+#include "G4VPVParameterisation.hh"
+#include "G4ThreeVector.hh"
+#include "G4RotationMatrix.hh"
+#include "G4Transform3D.hh"
+
+class G4InstancedParameterisation : public G4VPVParameterisation
+{
+  public:  // with description
+
+    G4InstancedParameterisation(const std::vector<G4ThreeVector>& positions,
+                                const G4RotationMatrix* pRot = nullptr);
+      // Instances placed at the given positions, all in a frame rotated
+      // by *pRot (same convention as for G4PVPlacement). The rotation is
+      // copied; if pRot=nullptr the instances are unrotated.
+
+    G4InstancedParameterisation(const std::vector<G4Transform3D>& transforms);
+      // Instances placed according to the direct rotation and translation
+      // of the solid (same convention as the G4PVPlacement constructor
+      // taking a G4Transform3D). Identical rotations are stored once.
+
+    ~G4InstancedParameterisation() override;
+
+    G4InstancedParameterisation(const G4InstancedParameterisation&) = delete;
+    G4InstancedParameterisation&
+      operator=(const G4InstancedParameterisation&) = delete;
+
+    void ComputeTransformation(const G4int copyNo,
+                               G4VPhysicalVolume* pPhysicalVol) const override;
+
+    G4bool ComputeExtent(const G4int copyNo,
+                         const G4VPhysicalVolume* pPhysicalVol,
+                         G4ThreeVector& pMin,
+                         G4ThreeVector& pMax) const override;
+      // Bounding box of the instance in the mother frame, computed from
+      // the bounding limits of the solid of the logical volume.
+
+    inline G4int GetNoInstances() const;
+    inline const G4ThreeVector& GetTranslation(G4int copyNo) const;
+    inline G4RotationMatrix* GetRotation(G4int copyNo) const;
+      // Position and frame rotation of the given instance;
+      // a null rotation stands for the identity.
+
+    inline std::size_t GetNoRotations() const;
+      // Number of distinct non-identity rotations stored.
+
+    std::size_t GetMemoryUse() const;
+      // Estimated memory, in bytes, used for the storage of the instances.
+
+  private:
+
+    std::uint32_t AddRotation(const G4RotationMatrix& rot);
+
+  private:
+
+    std::vector<G4ThreeVector> fTranslations;
+    std::vector<G4RotationMatrix*> fRotations;
+      // Distinct frame rotations; entry 0 is the shared rotation, or null.
+    std::vector<std::uint32_t> fRotationIndex;
+      // Index in fRotations per instance; empty if the rotation is shared.
+};
+
+#include "G4InstancedParameterisation.icc"
+
+#endif
@@ -0,0 +1,107 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4PVInstanced
+//
+// Class description:
+//
+// Represents a large number of identical copies of a logical volume,
+// positioned and oriented individually within the same mother volume,
+// e.g. fibres, straws or repeated molecular units. It is a parameterised
+// volume whose positions are kept in a packed array through a
+// G4InstancedParameterisation, so that each instance costs a translation
+// and (if not shared) a 32-bit rotation index, instead of a complete
+// G4PVPlacement with its own name, rotation matrix and store entry.
+//
+// Copy numbers are implicit and equal to the index of the instance.
+// As for any parameterised volume, it must be the only daughter of its
+// mother volume. Voxels are built along all three axes, using the
+// bounding boxes of the instances computed directly from the packed
+// transformations.
+
+// 19.10.2026: Initial version.
+// ----------------------------------------------------------------------
+#ifndef G4PVINSTANCED_HH
+#define G4PVINSTANCED_HH
+
+#include <vector>
+
+#include "G4PVParameterised.hh"
+#include "G4InstancedParameterisation.hh"
+
+class G4PVInstanced : public G4PVParameterised
+{
+  public:  // with description
+
+    G4PVInstanced(const G4String& pName,
+                        G4LogicalVolume* pLogical,
+                        G4LogicalVolume* pMotherLogical,
+                  const std::vector<G4ThreeVector>& positions,
+                  const G4RotationMatrix* pRot = nullptr,
+                        G4bool pSurfChk = false);
+      // Places one instance of pLogical at each of the given positions
+      // inside pMotherLogical, all in a frame rotated by *pRot (copied).
+      // pSurfChk if true activates check for overlaps of the instances.
+
+    G4PVInstanced(const G4String& pName,
+                        G4LogicalVolume* pLogical,
+                        G4LogicalVolume* pMotherLogical,
+                  const std::vector<G4Transform3D>& transforms,
+                        G4bool pSurfChk = false);
+      // Places one instance of pLogical for each transformation, given
+      // as direct rotation and translation of the solid (NOT of the frame),
+      // as for the equivalent G4PVPlacement constructor.
+
+    ~G4PVInstanced() override;
+
+    G4PVInstanced(const G4PVInstanced&) = delete;
+    G4PVInstanced& operator=(const G4PVInstanced&) = delete;
+
+    inline G4int GetNoInstances() const;
+    inline const G4ThreeVector& GetInstanceTranslation(G4int copyNo) const;
+    inline const G4RotationMatrix* GetInstanceRotation(G4int copyNo) const;
+      // Position and frame rotation of the instance with given copy number.
+
+    inline const G4InstancedParameterisation* GetInstances() const;
+      // Returns the internal parameterisation holding the transformations.
+
+    std::size_t GetMemoryUse() const;
+      // Estimated memory, in bytes, used by the volume and its instances.
+
+    G4bool CheckOverlaps(G4int res = 1000, G4double tol = 0.,
+                         G4bool verbose = true, G4int maxErr = 1) override;
+      // Verifies if the instances are overlapping with each other or with
+      // the mother volume. Points are sampled once on the surface of the
+      // shared solid and each instance is only compared to the instances
+      // whose bounding boxes intersect its own.
+
+  private:
+
+    G4InstancedParameterisation* fInstances = nullptr;
+};
+
+#include "G4PVInstanced.icc"
+
+#endif
@@ -129,6 +129,14 @@ class G4PVPlacement : public G4VPhysicalVolume
       // Reports a maximum of overlaps errors according to parameter in input.
       // Returns true if the volume is overlapping.
 
+    G4bool CollectOverlaps(G4int res, G4double tol, G4int maxErr,
+                           std::vector<G4String>& reports) const;
+      // Performs the same verification as CheckOverlaps(), but collects
+      // the messages describing the overlaps found in 'reports' instead of
+      // issuing them, with no printout. Can be invoked concurrently for
+      // different volumes, once the solids have been prepared for the
+      // generation of points on their surface.
+
   public:  // without description
 
     G4PVPlacement(__void__&);
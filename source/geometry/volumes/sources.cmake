@@ -18,6 +18,8 @@ geant4_add_module(G4volumes
     G4GRSVolume.hh
     G4GRSVolume.icc
     G4GRSVolumeHandle.hh
+    G4InstancedParameterisation.hh
+    G4InstancedParameterisation.icc
     G4LogicalBorderSurface.hh
     G4LogicalBorderSurface.icc
     G4LogicalSkinSurface.hh
@@ -29,6 +31,8 @@ geant4_add_module(G4volumes
     G4NavigationLevel.icc
     G4NavigationLevelRep.hh
     G4NavigationLevelRep.icc
+    G4PVInstanced.hh
+    G4PVInstanced.icc
     G4PVParameterised.hh
     G4PVPlacement.hh
     G4PVReplica.hh
@@ -43,12 +47,14 @@ geant4_add_module(G4volumes
     G4GeometryWorkspace.cc
     G4GRSSolid.cc
     G4GRSVolume.cc
+    G4InstancedParameterisation.cc
     G4LogicalBorderSurface.cc
     G4LogicalSkinSurface.cc
     G4NavigationHistory.cc
     G4NavigationHistoryPool.cc
     G4NavigationLevel.cc
     G4NavigationLevelRep.cc
+    G4PVInstanced.cc
     G4PVParameterised.cc
     G4PVPlacement.cc
     G4PVReplica.cc
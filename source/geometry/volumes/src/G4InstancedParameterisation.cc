@@ -0,0 +1,181 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4InstancedParameterisation implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "G4InstancedParameterisation.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4AffineTransform.hh"
+
+// --------------------------------------------------------------------
+G4InstancedParameterisation::
+G4InstancedParameterisation(const std::vector<G4ThreeVector>& positions,
+                            const G4RotationMatrix* pRot)
+  : fTranslations(positions)
+{
+  if (positions.size() > std::size_t(std::numeric_limits<G4int>::max()))
+  {
+    G4Exception("G4InstancedParameterisation::G4InstancedParameterisation()",
+                "GeomVol0002", FatalException,
+                "Number of instances exceeds the range of copy numbers.");
+  }
+  fRotations.push_back(((pRot == nullptr) || pRot->isIdentity())
+                       ? nullptr : new G4RotationMatrix(*pRot));
+}
+
+// --------------------------------------------------------------------
+G4InstancedParameterisation::
+G4InstancedParameterisation(const std::vector<G4Transform3D>& transforms)
+{
+  std::size_t n = transforms.size();
+  if (n > std::size_t(std::numeric_limits<G4int>::max()))
+  {
+    G4Exception("G4InstancedParameterisation::G4InstancedParameterisation()",
+                "GeomVol0002", FatalException,
+                "Number of instances exceeds the range of copy numbers.");
+  }
+  fTranslations.reserve(n);
+  fRotationIndex.reserve(n);
+  fRotations.push_back(nullptr);
+
+  // Rotations are looked up by their components, so that instances
+  // sharing the same orientation refer to the same matrix
+  //
+  std::map<std::array<G4double,9>, std::uint32_t> lookup;
+  for (const auto& transform : transforms)
+  {
+    fTranslations.push_back(transform.getTranslation());
+    G4RotationMatrix rot = transform.getRotation().inverse();
+    if (rot.isIdentity())
+    {
+      fRotationIndex.push_back(0);
+      continue;
+    }
+    std::array<G4double,9> key = { rot.xx(), rot.xy(), rot.xz(),
+                                   rot.yx(), rot.yy(), rot.yz(),
+                                   rot.zx(), rot.zy(), rot.zz() };
+    auto pos = lookup.find(key);
+    if (pos == lookup.cend())
+    {
+      pos = lookup.emplace(key, AddRotation(rot)).first;
+    }
+    fRotationIndex.push_back(pos->second);
+  }
+
+  // No need to keep indices if all instances share the same orientation
+  //
+  if (fRotations.size() == 1)
+  {
+    fRotationIndex.clear();
+  }
+  else if (fRotations.size() == 2 && lookup.size() == 1
+        && std::find(fRotationIndex.cbegin(), fRotationIndex.cend(), 0)
+           == fRotationIndex.cend())
+  {
+    delete fRotations[0];
+    fRotations.erase(fRotations.begin());
+    fRotationIndex.clear();
+  }
+  fRotationIndex.shrink_to_fit();
+}
+
+// --------------------------------------------------------------------
+G4InstancedParameterisation::~G4InstancedParameterisation()
+{
+  for (auto rot : fRotations) { delete rot; }
+}
+
+// --------------------------------------------------------------------
+std::uint32_t
+G4InstancedParameterisation::AddRotation(const G4RotationMatrix& rot)
+{
+  fRotations.push_back(new G4RotationMatrix(rot));
+  return std::uint32_t(fRotations.size()-1);
+}
+
+// --------------------------------------------------------------------
+void G4InstancedParameterisation::
+ComputeTransformation(const G4int copyNo, G4VPhysicalVolume* pPhysVol) const
+{
+  pPhysVol->SetTranslation(fTranslations[copyNo]);
+  pPhysVol->SetRotation(GetRotation(copyNo));
+}
+
+// --------------------------------------------------------------------
+G4bool G4InstancedParameterisation::
+ComputeExtent(const G4int copyNo, const G4VPhysicalVolume* pPhysVol,
+              G4ThreeVector& pMin, G4ThreeVector& pMax) const
+{
+  G4ThreeVector bmin, bmax;
+  pPhysVol->GetLogicalVolume()->GetSolid()->BoundingLimits(bmin, bmax);
+  G4ThreeVector centre = 0.5*(bmax + bmin);
+  G4ThreeVector delta = 0.5*(bmax - bmin);
+
+  const G4RotationMatrix* rot = GetRotation(copyNo);
+  if (rot == nullptr)
+  {
+    pMin = fTranslations[copyNo] + centre - delta;
+    pMax = fTranslations[copyNo] + centre + delta;
+    return true;
+  }
+
+  // Box of the rotated box: the half-widths are projected with
+  // the absolute values of the matrix elements
+  //
+  G4AffineTransform tf(rot, fTranslations[copyNo]);
+  G4ThreeVector pos = tf.TransformPoint(centre);
+  G4ThreeVector half(
+    std::abs(rot->xx())*delta.x() + std::abs(rot->yx())*delta.y()
+                                  + std::abs(rot->zx())*delta.z(),
+    std::abs(rot->xy())*delta.x() + std::abs(rot->yy())*delta.y()
+                                  + std::abs(rot->zy())*delta.z(),
+    std::abs(rot->xz())*delta.x() + std::abs(rot->yz())*delta.y()
+                                  + std::abs(rot->zz())*delta.z());
+  pMin = pos - half;
+  pMax = pos + half;
+  return true;
+}
+
+// --------------------------------------------------------------------
+std::size_t G4InstancedParameterisation::GetMemoryUse() const
+{
+  std::size_t mem = sizeof(*this);
+  mem += fTranslations.capacity()*sizeof(G4ThreeVector);
+  mem += fRotationIndex.capacity()*sizeof(std::uint32_t);
+  mem += fRotations.capacity()*sizeof(G4RotationMatrix*);
+  mem += GetNoRotations()*sizeof(G4RotationMatrix);
+  return mem;
+}
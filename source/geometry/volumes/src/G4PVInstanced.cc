@@ -0,0 +1,356 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4PVInstanced implementation
+//
+// 19.10.2026: Initial version.
+// ----------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+
+#include "G4PVInstanced.hh"
+#include "G4AffineTransform.hh"
+#include "G4UnitsTable.hh"
+#include "G4VSolid.hh"
+#include "G4LogicalVolume.hh"
+
+// ----------------------------------------------------------------------
+// Constructors
+//
+G4PVInstanced::G4PVInstanced( const G4String& pName,
+                                    G4LogicalVolume* pLogical,
+                                    G4LogicalVolume* pMotherLogical,
+                              const std::vector<G4ThreeVector>& positions,
+                              const G4RotationMatrix* pRot,
+                                    G4bool pSurfChk )
+  : G4PVParameterised(pName, pLogical, pMotherLogical, kUndefined,
+                      G4int(positions.size()),
+                      new G4InstancedParameterisation(positions, pRot))
+{
+  fInstances = static_cast<G4InstancedParameterisation*>(GetParameterisation());
+  if (pSurfChk) { CheckOverlaps(); }
+}
+
+G4PVInstanced::G4PVInstanced( const G4String& pName,
+                                    G4LogicalVolume* pLogical,
+                                    G4LogicalVolume* pMotherLogical,
+                              const std::vector<G4Transform3D>& transforms,
+                                    G4bool pSurfChk )
+  : G4PVParameterised(pName, pLogical, pMotherLogical, kUndefined,
+                      G4int(transforms.size()),
+                      new G4InstancedParameterisation(transforms))
+{
+  fInstances = static_cast<G4InstancedParameterisation*>(GetParameterisation());
+  if (pSurfChk) { CheckOverlaps(); }
+}
+
+// ----------------------------------------------------------------------
+// Destructor
+//
+G4PVInstanced::~G4PVInstanced()
+{
+  delete fInstances;
+}
+
+// ----------------------------------------------------------------------
+// GetMemoryUse
+//
+std::size_t G4PVInstanced::GetMemoryUse() const
+{
+  return sizeof(*this) + GetName().capacity() + fInstances->GetMemoryUse();
+}
+
+// ----------------------------------------------------------------------
+// CheckOverlaps
+//
+// The instances are binned in a uniform grid according to their bounding
+// boxes, with cells of about the average size of an instance, so that
+// the number of pairs to be verified grows linearly with the number of
+// instances for densely packed arrays.
+//
+G4bool G4PVInstanced::CheckOverlaps(G4int res, G4double tol,
+                                    G4bool verbose, G4int maxErr)
+{
+  if (res <= 0) { return false; }
+  G4LogicalVolume* motherLog = GetMotherLogical();
+  if (motherLog == nullptr) { return false; }
+
+  G4int trials = 0;
+  G4bool retval = false;
+  G4VSolid* solid = GetLogicalVolume()->GetSolid();
+  G4VSolid* motherSolid = motherLog->GetSolid();
+  G4int nInstances = GetNoInstances();
+  if (nInstances == 0) { return false; }
+
+  if (verbose)
+  {
+    G4cout << "Checking overlaps for instanced volume "
+           << GetName() << " (" << nInstances << " instances) ... ";
+  }
+
+  // All instances share the same solid: sample its surface once
+  //
+  std::vector<G4ThreeVector> points(res);
+  for (auto& point : points) { point = solid->GetPointOnSurface(); }
+
+  // Bounding boxes of the instances and of the whole set
+  //
+  std::vector<G4ThreeVector> bmin(nInstances), bmax(nInstances);
+  G4ThreeVector gmin( kInfinity,  kInfinity,  kInfinity);
+  G4ThreeVector gmax(-kInfinity, -kInfinity, -kInfinity);
+  G4ThreeVector size;
+  for (G4int i = 0; i < nInstances; ++i)
+  {
+    fInstances->ComputeExtent(i, this, bmin[i], bmax[i]);
+    for (auto k = 0; k < 3; ++k)
+    {
+      gmin[k] = std::min(gmin[k], bmin[i][k]);
+      gmax[k] = std::max(gmax[k], bmax[i][k]);
+    }
+    size += bmax[i] - bmin[i];
+  }
+  size /= nInstances;
+
+  // Uniform grid, limited to a few cells per instance
+  //
+  G4int ncells[3];
+  G4double cellSize[3];
+  for (auto k = 0; k < 3; ++k)
+  {
+    G4double extent = gmax[k] - gmin[k];
+    ncells[k] = (size[k] > 0.)
+              ? G4int(std::min(extent/size[k], 1024.)) : 1;
+    ncells[k] = std::max(ncells[k], 1);
+  }
+  while (G4double(ncells[0])*ncells[1]*ncells[2] > 8.*nInstances + 64.)
+  {
+    G4int kmax = (ncells[0] >= ncells[1] && ncells[0] >= ncells[2]) ? 0
+               : ((ncells[1] >= ncells[2]) ? 1 : 2);
+    ncells[kmax] = (ncells[kmax] + 1)/2;
+  }
+  for (auto k = 0; k < 3; ++k)
+  {
+    G4double extent = gmax[k] - gmin[k];
+    cellSize[k] = (extent > 0.) ? extent/ncells[k] : 1.;
+  }
+  auto cellRange = [&](G4int i, G4int* lo, G4int* hi)
+  {
+    for (auto k = 0; k < 3; ++k)
+    {
+      lo[k] = std::clamp(G4int((bmin[i][k] - gmin[k])/cellSize[k]),
+                         0, ncells[k]-1);
+      hi[k] = std::clamp(G4int((bmax[i][k] - gmin[k])/cellSize[k]),
+                         0, ncells[k]-1);
+    }
+  };
+
+  // Fill the cells (compressed storage: offsets and instance numbers)
+  //
+  std::size_t totCells = std::size_t(ncells[0])*ncells[1]*ncells[2];
+  std::vector<std::size_t> offsets(totCells + 1, 0);
+  std::vector<G4int> contents;
+  G4int lo[3], hi[3];
+  for (auto pass = 0; pass < 2; ++pass)
+  {
+    for (G4int i = 0; i < nInstances; ++i)
+    {
+      cellRange(i, lo, hi);
+      for (auto iz = lo[2]; iz <= hi[2]; ++iz)
+      {
+        for (auto iy = lo[1]; iy <= hi[1]; ++iy)
+        {
+          for (auto ix = lo[0]; ix <= hi[0]; ++ix)
+          {
+            std::size_t cell = (std::size_t(iz)*ncells[1] + iy)*ncells[0] + ix;
+            if (pass == 0) { ++offsets[cell + 1]; }
+            else           { contents[offsets[cell]++] = i; }
+          }
+        }
+      }
+    }
+    if (pass == 0)
+    {
+      for (std::size_t c = 0; c < totCells; ++c)
+      {
+        offsets[c + 1] += offsets[c];
+      }
+      contents.resize(offsets[totCells]);
+    }
+    else
+    {
+      // Offsets have been shifted by one cell while filling
+      //
+      for (std::size_t c = totCells; c > 0; --c)
+      {
+        offsets[c] = offsets[c - 1];
+      }
+      offsets[0] = 0;
+    }
+  }
+
+  // Verify each instance against the mother and its neighbours
+  //
+  std::vector<G4int> visited(nInstances, -1);
+  std::vector<G4ThreeVector> mpoints(res);
+  for (G4int i = 0; i < nInstances; ++i)
+  {
+    G4AffineTransform Tm(fInstances->GetRotation(i),
+                         fInstances->GetTranslation(i));
+    for (auto n = 0; n < res; ++n)
+    {
+      mpoints[n] = Tm.TransformPoint(points[n]);
+    }
+
+    // Checking overlaps with the mother volume
+    //
+    G4int overlapCount = 0;
+    G4double overlapSize = -kInfinity;
+    G4ThreeVector overlapPoint;
+    for (const auto& mp : mpoints)
+    {
+      if (motherSolid->Inside(mp) != kOutside) { continue; }
+      G4double distin = motherSolid->DistanceToIn(mp);
+      if (distin <= tol) { continue; }
+      ++overlapCount;
+      if (distin > overlapSize)
+      {
+        overlapSize = distin;
+        overlapPoint = mp;
+      }
+    }
+    if (overlapCount > 0)
+    {
+      ++trials; retval = true;
+      std::ostringstream message;
+      message << "Overlap with mother volume !" << G4endl
+              << "          Overlap is detected for volume "
+              << GetName() << ", instance: " << i << G4endl
+              << "          with its mother volume "
+              << motherLog->GetName() << G4endl
+              << "          protrusion at mother local point " << overlapPoint
+              << " by " << G4BestUnit(overlapSize, "Length")
+              << " (max of " << overlapCount << " cases)";
+      if (trials >= maxErr)
+      {
+        message << G4endl
+                << "NOTE: Reached maximum fixed number -" << maxErr
+                << "- of overlaps reports for this volume !";
+      }
+      G4Exception("G4PVInstanced::CheckOverlaps()",
+                  "GeomVol1002", JustWarning, message);
+      if (trials >= maxErr)  { return true; }
+    }
+
+    // Checking overlaps with the following instances whose
+    // bounding boxes intersect the one of this instance
+    //
+    cellRange(i, lo, hi);
+    for (auto iz = lo[2]; iz <= hi[2]; ++iz)
+    {
+      for (auto iy = lo[1]; iy <= hi[1]; ++iy)
+      {
+        for (auto ix = lo[0]; ix <= hi[0]; ++ix)
+        {
+          std::size_t cell = (std::size_t(iz)*ncells[1] + iy)*ncells[0] + ix;
+          for (auto c = offsets[cell]; c < offsets[cell + 1]; ++c)
+          {
+            G4int j = contents[c];
+            if (j <= i || visited[j] == i) { continue; }
+            visited[j] = i;
+            if (bmax[j].x() < bmin[i].x() || bmin[j].x() > bmax[i].x() ||
+                bmax[j].y() < bmin[i].y() || bmin[j].y() > bmax[i].y() ||
+                bmax[j].z() < bmin[i].z() || bmin[j].z() > bmax[i].z())
+            {
+              continue;
+            }
+            G4AffineTransform Td(fInstances->GetRotation(j),
+                                 fInstances->GetTranslation(j));
+            overlapCount = 0;
+            overlapSize = -kInfinity;
+            for (const auto& mp : mpoints)
+            {
+              // Points of instance i within instance j
+              //
+              G4ThreeVector md = Td.InverseTransformPoint(mp);
+              if (solid->Inside(md) != kInside) { continue; }
+              G4double distout = solid->DistanceToOut(md);
+              if (distout <= tol) { continue; }
+              ++overlapCount;
+              if (distout > overlapSize)
+              {
+                overlapSize = distout;
+                overlapPoint = mp;
+              }
+            }
+            for (const auto& point : points)
+            {
+              // Points of instance j within instance i
+              //
+              G4ThreeVector mp = Td.TransformPoint(point);
+              G4ThreeVector md = Tm.InverseTransformPoint(mp);
+              if (solid->Inside(md) != kInside) { continue; }
+              G4double distout = solid->DistanceToOut(md);
+              if (distout <= tol) { continue; }
+              ++overlapCount;
+              if (distout > overlapSize)
+              {
+                overlapSize = distout;
+                overlapPoint = mp;
+              }
+            }
+            if (overlapCount == 0) { continue; }
+
+            ++trials; retval = true;
+            std::ostringstream message;
+            message << "Overlap within instanced volume !" << G4endl
+                    << "          Overlap is detected for volume "
+                    << GetName() << ", instance: " << i << G4endl
+                    << "          with instance: " << j << G4endl
+                    << "          at mother local point " << overlapPoint << ", "
+                    << "overlapping by at least: "
+                    << G4BestUnit(overlapSize, "Length")
+                    << " (max of " << overlapCount << " cases)";
+            if (trials >= maxErr)
+            {
+              message << G4endl
+                      << "NOTE: Reached maximum fixed number -" << maxErr
+                      << "- of overlaps reports for this volume !";
+            }
+            G4Exception("G4PVInstanced::CheckOverlaps()",
+                        "GeomVol1002", JustWarning, message);
+            if (trials >= maxErr)  { return true; }
+          }
+        }
+      }
+    }
+  }
+  if (verbose && !retval)
+  {
+    G4cout << "OK! " << G4endl;
+  }
+
+  return retval;
+}
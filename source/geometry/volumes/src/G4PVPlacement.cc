@@ -244,6 +244,39 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
                                     G4bool verbose, G4int maxErr)
 {
   if (res <= 0) { return false; }
+  if (GetMotherLogical() == nullptr) { return false; }
+
+  if (verbose)
+  {
+    G4cout << "Checking overlaps for volume "
+           << GetName() << ':' << GetCopyNo()
+           << " (" << GetLogicalVolume()->GetSolid()->GetEntityType()
+           << ") ... ";
+  }
+
+  std::vector<G4String> reports;
+  G4bool retval = CollectOverlaps(res, tol, maxErr, reports);
+  for (const auto& report : reports)
+  {
+    G4Exception("G4PVPlacement::CheckOverlaps()",
+                "GeomVol1002", JustWarning, report.c_str());
+  }
+
+  if (verbose && reports.empty()) { G4cout << "OK! " << G4endl; }
+  return retval;
+}
+
+// ----------------------------------------------------------------------
+// CollectOverlaps
+//
+// Does not modify any state shared with other threads, except for the
+// lazy initialisation of data in solids for the generation of points
+// on surface (see G4GeomTestVolume).
+//
+G4bool G4PVPlacement::CollectOverlaps(G4int res, G4double tol, G4int maxErr,
+                                      std::vector<G4String>& reports) const
+{
+  if (res <= 0) { return false; }
 
   G4VSolid* solid = GetLogicalVolume()->GetSolid();
   G4LogicalVolume* motherLog = GetMotherLogical();
@@ -252,13 +285,6 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
   G4int trials = 0;
   G4bool retval = false;
 
-  if (verbose)
-  {
-    G4cout << "Checking overlaps for volume "
-           << GetName() << ':' << GetCopyNo()
-           << " (" << solid->GetEntityType() << ") ... ";
-  }
-
   // Check that random points are gererated correctly
   //
   G4ThreeVector ptmp = solid->GetPointOnSurface();
@@ -272,8 +298,7 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
             << " (" << solid->GetEntityType() << ")" << G4endl
             << "          generated point " << ptmp
             << " is " << position[solid->Inside(ptmp)];
-    G4Exception("G4PVPlacement::CheckOverlaps()",
-                "GeomVol1002", JustWarning, message);
+    reports.push_back(message.str());
     return false;
   }
 
@@ -338,8 +363,7 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
               << "NOTE: Reached maximum fixed number -" << maxErr
               << "- of overlaps reports for this volume !";
     }
-    G4Exception("G4PVPlacement::CheckOverlaps()",
-                "GeomVol1002", JustWarning, message);
+    reports.push_back(message.str());
     if (trials >= maxErr)  { return true; }
   }
 
@@ -481,8 +505,7 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
                 << "NOTE: Reached maximum fixed number -" << maxErr
                 << "- of overlaps reports for this volume !";
       }
-      G4Exception("G4PVPlacement::CheckOverlaps()",
-                  "GeomVol1002", JustWarning, message);
+      reports.push_back(message.str());
       if (trials >= maxErr)  { return true; }
     }
     else if (check_encapsulation)
@@ -523,14 +546,12 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
                   << "NOTE: Reached maximum fixed number -" << maxErr
                   << "- of overlaps reports for this volume !";
         }
-        G4Exception("G4PVPlacement::CheckOverlaps()",
-                    "GeomVol1002", JustWarning, message);
+        reports.push_back(message.str());
         if (trials >= maxErr)  { return true; }
       }
     }
   }
 
-  if (verbose && trials == 0) { G4cout << "OK! " << G4endl; }
   return retval;
 }
 
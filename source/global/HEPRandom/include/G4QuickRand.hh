@@ -31,12 +31,15 @@
 #include "G4Types.hh"
 #include <cstdint>
 
-inline G4double G4QuickRand()
+// A non-zero seed resets the state of the generator of the calling thread
+//
+inline G4double G4QuickRand(uint32_t seed = 0)
 {
   static const G4double f = 1. / 4294967296.;  // 2^-32
 
   // Algorithm "xor" from p.4 of G.Marsaglia, "Xorshift RNGs"
   static G4ThreadLocal uint32_t y = 2463534242;
+  if (seed != 0) y = seed;
   uint32_t x                      = y;
   x ^= x << 13;
   x ^= x >> 17;
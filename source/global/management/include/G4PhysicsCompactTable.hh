@@ -0,0 +1,101 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4PhysicsCompactTable
+//
+// Class description:
+//
+// Collection of G4PhysicsCompactVector copies of the vectors of a
+// G4PhysicsTable, indexed as the original table and owning them.
+// Null vectors of the original table have null copies. The table
+// object may be shared and stays valid when it is rebuilt, while
+// its vectors are replaced.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4PhysicsCompactTable_hh
+#define G4PhysicsCompactTable_hh 1
+
+#include <algorithm>
+#include <vector>
+
+#include "G4PhysicsCompactVector.hh"
+#include "G4PhysicsTable.hh"
+#include "globals.hh"
+
+template <typename T>
+class G4PhysicsCompactTable : public std::vector<G4PhysicsCompactVector<T>*>
+{
+ public:
+  G4PhysicsCompactTable() = default;
+
+  explicit G4PhysicsCompactTable(const G4PhysicsTable& table)
+  {
+    Build(table);
+  }
+
+  ~G4PhysicsCompactTable() { Clear(); }
+
+  G4PhysicsCompactTable(const G4PhysicsCompactTable&) = delete;
+  G4PhysicsCompactTable& operator=(const G4PhysicsCompactTable&) = delete;
+
+  void Build(const G4PhysicsTable& table)
+  {
+    Clear();
+    this->reserve(table.size());
+    for(auto v : table)
+    {
+      this->push_back((nullptr != v) ? new G4PhysicsCompactVector<T>(*v)
+                                     : nullptr);
+    }
+  }
+  // Replaces the vectors by copies of the ones of the given table
+
+  G4double MaxDeviation(const G4PhysicsTable& table) const
+  {
+    G4double deviation = 0.0;
+    const std::size_t n = std::min(this->size(), table.size());
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      if(nullptr != (*this)[i] && nullptr != table[i])
+      {
+        deviation = std::max(deviation, (*this)[i]->MaxDeviation(*table[i]));
+      }
+    }
+    return deviation;
+  }
+  // Maximal relative deviation from the values of the given table
+  // (see G4PhysicsCompactVector::MaxDeviation())
+
+ private:
+
+  void Clear()
+  {
+    for(auto v : *this) { delete v; }
+    this->clear();
+  }
+};
+
+#endif
@@ -0,0 +1,148 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4PhysicsCompactVector
+//
+// Class description:
+//
+// A read-only copy of a filled G4PhysicsVector, for lookups done at
+// each step. Energy, value and second derivative of each node are
+// stored together, so that a lookup reads one or two cache lines
+// instead of three arrays; values and second derivatives are stored
+// with the type T, e.g. G4float to halve the memory they use, while
+// energies are kept and the interpolation is done in double precision.
+// Bins of a free vector with positive energies are located through an
+// index on a logarithmic grid instead of a binary search.
+// The copy does not follow later changes of the original vector and
+// has to be rebuilt with it.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4PhysicsCompactVector_hh
+#define G4PhysicsCompactVector_hh 1
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "G4Exp.hh"
+#include "G4PhysicsVector.hh"
+#include "globals.hh"
+
+template <typename T>
+class G4PhysicsCompactVector
+{
+public:
+  explicit G4PhysicsCompactVector(const G4PhysicsVector& vec);
+
+  ~G4PhysicsCompactVector() = default;
+
+  G4PhysicsCompactVector(const G4PhysicsCompactVector&) = delete;
+  G4PhysicsCompactVector& operator=(const G4PhysicsCompactVector&) = delete;
+
+  // Same as G4PhysicsVector::Value(); the index is the one of the
+  // original vector.
+  inline G4double Value(const G4double energy, std::size_t& lastidx) const;
+
+  // Same as G4PhysicsVector::Value().
+  inline G4double Value(const G4double energy) const;
+
+  // Same as G4PhysicsVector::LogVectorValue(); this method
+  // will work properly only for a copy of G4PhysicsLogVector.
+  inline G4double LogVectorValue(const G4double energy,
+                                 const G4double theLogEnergy) const;
+
+  // Get the values corresponding to 'n' energies at once, e.g. for
+  // a batch of tracks. The bins of all energies are located first,
+  // then the values interpolated, both in loops suited to compiler
+  // vectorisation.
+  void Value(const G4double* energies, G4double* values,
+             const std::size_t n) const;
+
+  // Same as above, with the log of the energies given; this method
+  // will work properly only for a copy of G4PhysicsLogVector.
+  void LogVectorValue(const G4double* energies, const G4double* logEnergies,
+                      G4double* values, const std::size_t n) const;
+
+  // Returns the value or the energy of the node 'index'
+  // The boundary check will not be done
+  inline G4double operator[](const std::size_t index) const;
+  inline G4double Energy(const std::size_t index) const;
+
+  inline G4double GetMinEnergy() const;
+  inline G4double GetMaxEnergy() const;
+  inline std::size_t GetVectorLength() const;
+
+  // Maximal relative deviation from the values of the given vector,
+  // at the nodes and at the middle of the bins, as a check of the
+  // accuracy of the copy.
+  G4double MaxDeviation(const G4PhysicsVector& vec) const;
+
+private:
+
+  // Linear or spline interpolation.
+  inline G4double Interpolation(const std::size_t idx,
+                                const G4double energy) const;
+
+  // Assuming (edgeMin <= energy <= edgeMax).
+  inline std::size_t GetBin(const G4double energy) const;
+
+  inline std::size_t ComputeLogVectorBin(const G4double loge) const;
+
+  void BuildLogIndex();
+
+  // Interpolation for a batch of located energies.
+  void BatchInterpolation(const G4double* energies, const std::size_t* idx,
+                          G4double* values, const std::size_t n) const;
+
+  struct Node
+  {
+    G4double energy;
+    T value;
+    T sd;
+  };
+
+  std::vector<Node> nodes;
+
+  // Index of the bins of a free vector on a logarithmic grid
+  std::vector<std::size_t> logIndex;
+  G4double logIndexMin = 0.0;
+  G4double logIndexInv = 0.0;
+
+  G4double edgeMin = 0.0;
+  G4double edgeMax = 0.0;
+  G4double invdBin = 0.0;
+  G4double logemin = 0.0;
+
+  std::size_t idxmax = 0;
+  std::size_t numberOfNodes = 0;
+
+  G4PhysicsVectorType type = T_G4PhysicsFreeVector;
+  G4bool useSpline = false;
+};
+
+#include "G4PhysicsCompactVector.icc"
+
+#endif
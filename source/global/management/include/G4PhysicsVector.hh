@@ -173,6 +173,9 @@ public:
   friend std::ostream& operator<<(std::ostream&, const G4PhysicsVector&);
   void DumpValues(G4double unitE = 1.0, G4double unitV = 1.0) const;
 
+  // Compact copies of the vector, see G4PhysicsCompactVector
+  template <typename T> friend class G4PhysicsCompactVector;
+
 protected:
 
   // The default implements a free vector initialisation.
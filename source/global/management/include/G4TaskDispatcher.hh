@@ -0,0 +1,74 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4TaskDispatcher
+//
+// Class description:
+//
+// Utility for distributing independent tasks issued at initialisation,
+// e.g. the estimation of solid properties, overlaps checking or the
+// building of physics tables for independent materials or couples, on
+// the thread pool of the tasking run-manager. The pool is registered by
+// the run-manager once created; if no pool is available, or when invoked
+// from a thread other than the master or from inside a task, tasks are
+// executed sequentially on the calling thread. Clients must not rely on
+// the order of execution of the tasks.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4TASKDISPATCHER_HH
+#define G4TASKDISPATCHER_HH 1
+
+#include <functional>
+
+#include "G4Types.hh"
+
+namespace PTL { class ThreadPool; }
+
+class G4TaskDispatcher
+{
+  public:
+
+    static void SetThreadPool(PTL::ThreadPool* pool);
+    static PTL::ThreadPool* GetThreadPool();
+      // Set/get the thread pool on which tasks are distributed.
+
+    static G4bool IsParallel();
+      // Return true if tasks issued from the calling thread would be
+      // distributed on the thread pool, i.e. from the master thread and
+      // not from inside a task, where waiting for nested tasks could
+      // deadlock the pool.
+
+    static void Execute(G4int ntasks, const std::function<void(G4int)>& func);
+      // Execute func(i) for i in [0,ntasks) and wait for completion.
+
+  private:
+
+    static PTL::ThreadPool* fThreadPool;
+    static G4ThreadLocal G4bool fInTask;
+      // True on a thread while it executes a distributed task.
+};
+
+#endif
@@ -64,6 +64,9 @@ geant4_add_module(G4globman
     G4PhysicalConstants.hh
     G4Physics2DVector.hh
     G4Physics2DVector.icc
+    G4PhysicsCompactTable.hh
+    G4PhysicsCompactVector.hh
+    G4PhysicsCompactVector.icc
     G4PhysicsFreeVector.hh
     G4PhysicsLinearVector.hh
     G4PhysicsLogVector.hh
@@ -88,6 +91,7 @@ geant4_add_module(G4globman
     G4SystemOfUnits.hh
     G4TaskGroup.hh
     G4Task.hh
+    G4TaskDispatcher.hh
     G4TaskManager.hh
     G4TaskSingletonDelegator.hh
     G4TBBTaskGroup.hh
@@ -150,6 +154,7 @@ geant4_add_module(G4globman
     G4ReferenceCountedHandle.cc
     G4SliceTimer.cc
     G4StateManager.cc
+    G4TaskDispatcher.cc
     G4ThreadLocalSingleton.cc
     G4Threading.cc
     G4Timer.cc
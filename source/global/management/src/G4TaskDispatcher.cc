@@ -0,0 +1,93 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4TaskDispatcher implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include "G4TaskDispatcher.hh"
+#include "G4TaskGroup.hh"
+#include "G4ThreadPool.hh"
+#include "G4Threading.hh"
+
+// ***************************************************************************
+// Static class data
+// ***************************************************************************
+//
+PTL::ThreadPool* G4TaskDispatcher::fThreadPool = nullptr;
+G4ThreadLocal G4bool G4TaskDispatcher::fInTask = false;
+
+// ***************************************************************************
+// Set/get the thread pool
+// ***************************************************************************
+//
+void G4TaskDispatcher::SetThreadPool(PTL::ThreadPool* pool)
+{
+  fThreadPool = pool;
+}
+
+PTL::ThreadPool* G4TaskDispatcher::GetThreadPool()
+{
+  return fThreadPool;
+}
+
+// ***************************************************************************
+// Tasks are distributed only from the master thread and not from inside
+// a task, whichever thread executes it, to avoid nested submission
+// ***************************************************************************
+//
+G4bool G4TaskDispatcher::IsParallel()
+{
+  return (fThreadPool != nullptr) && (fThreadPool->size() > 1)
+      && G4Threading::IsMasterThread() && !fInTask;
+}
+
+// ***************************************************************************
+// Execute the tasks and wait for their completion
+// ***************************************************************************
+//
+void G4TaskDispatcher::Execute(G4int ntasks,
+                               const std::function<void(G4int)>& func)
+{
+  if (ntasks < 2 || !IsParallel())
+  {
+    for (G4int i=0; i<ntasks; ++i) { func(i); }
+    return;
+  }
+
+  G4TaskGroup<void> group(fThreadPool);
+  for (G4int i=0; i<ntasks; ++i)
+  {
+    group.exec([&func, i]()
+    {
+      const G4bool inTask = fInTask;
+      fInTask = true;
+      func(i);
+      fInTask = inTask;
+    });
+  }
+  group.join();
+}
@@ -0,0 +1,208 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4GDMLBinaryCache
+//
+// Class description:
+//
+// Compact binary image of a geometry imported from GDML, to be used in
+// place of the GDML file by following jobs, so skipping the XML parsing
+// and the evaluation of expressions. The fully resolved geometry tree is
+// stored, in internal units: isotopes, elements and materials with their
+// property tables, solids, logical volumes with their user limits,
+// placed, replicated, divided and GDML-parameterised volumes, optical
+// surfaces with the border and skin surfaces using them, and the regions
+// having a root logical volume in the tree, with their production cuts
+// and user limits. The estimates of cubic volume and surface area of
+// solids available in G4SolidPropertiesCache at writing are stored as
+// well, as are, if provided, the definitions and auxiliary information
+// of the GDML reader (G4GDMLReaderData), so that they are available from
+// G4GDMLParser after the geometry is imported from the cache.
+//
+// The header of the file holds a hash of the content of the GDML file
+// the geometry was imported from and of the files it refers to, modules,
+// external entities and binary mesh files, recursively. A cache is
+// rejected, without creating any object, if any of this content has
+// changed since the cache was written, if it was written with a
+// different format version or byte order, or if its payload is damaged.
+// Where supported, the file is mapped in memory for reading.
+//
+// Volumes with parameterisations other than the GDML one, user limits of
+// classes derived from G4UserLimits, and solids which cannot be exported
+// to GDML either, are not represented: Write() fails on trees including
+// them. Visualisation attributes are not stored.
+
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+#ifndef G4GDMLBINARYCACHE_HH
+#define G4GDMLBINARYCACHE_HH 1
+
+#include "G4Types.hh"
+#include "G4String.hh"
+#include "G4ThreeVector.hh"
+#include "G4GDMLAuxStructType.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+class G4Isotope;
+class G4Element;
+class G4Material;
+class G4MaterialPropertiesTable;
+class G4OpticalSurface;
+class G4VSolid;
+class G4LogicalVolume;
+class G4VPhysicalVolume;
+class G4Region;
+class G4UserLimits;
+
+struct G4GDMLReaderData
+{
+  // Definitions and auxiliary information of the GDML reader, stored
+  // in the cache along with the geometry. Matrices are stored by number
+  // of columns and values, row by row
+
+  std::map<G4String, G4double> constants;
+  std::map<G4String, G4double> variables;
+  std::map<G4String, G4double> quantities;
+  std::map<G4String, G4ThreeVector> positions;
+  std::map<G4String, G4ThreeVector> rotations;
+  std::map<G4String, G4ThreeVector> scales;
+  std::map<G4String, std::pair<std::size_t, std::vector<G4double>>> matrices;
+  std::map<G4LogicalVolume*, G4GDMLAuxListType> volumeAuxiliaries;
+  G4GDMLAuxListType auxiliaries;
+};
+
+class G4GDMLBinaryCache
+{
+  public:
+
+    G4GDMLBinaryCache() = default;
+    ~G4GDMLBinaryCache() = default;
+
+    static std::uint64_t SourceHash(const G4String& filename);
+    //
+    // Returns the hash of the content of file 'filename' and of the files
+    // it refers to, to be stored in the cache; zero if 'filename' cannot
+    // be read.
+
+    G4bool Write(const G4String& filename, const G4VPhysicalVolume* world,
+                 std::uint64_t sourceHash,
+                 const G4GDMLReaderData* readerData = nullptr);
+    //
+    // Writes the geometry tree starting from 'world' in the cache file
+    // 'filename', tagged with 'sourceHash', together with 'readerData'
+    // if not null. Returns false, writing nothing, if the tree includes
+    // volumes, solids or user limits not supported.
+
+    G4VPhysicalVolume* Read(const G4String& filename,
+                            std::uint64_t sourceHash,
+                            G4GDMLReaderData* readerData = nullptr);
+    //
+    // Creates the geometry stored in the cache file 'filename' and
+    // returns its world volume, filling 'readerData' if not null. Returns
+    // null, creating nothing, if the file does not exist or is not valid
+    // for 'sourceHash'.
+
+  private:
+
+    class Output;
+    class Input;
+
+    void Clear();
+    G4VPhysicalVolume* Load(const char* data, std::size_t size,
+                            std::uint64_t sourceHash,
+                            const G4String& filename,
+                            G4GDMLReaderData* readerData);
+
+    static G4bool HashFile(const G4String& filename, std::uint64_t& hash,
+                           std::set<G4String>& visited);
+
+    G4bool CollectVolume(const G4LogicalVolume* lvol);
+    G4bool CollectSolid(const G4VSolid* solid);
+    void CollectMaterial(const G4Material* material);
+    G4bool CollectUserLimits(const G4UserLimits* limits);
+    G4bool CollectSurfaces();
+    G4bool CollectRegions();
+
+    void WriteMaterials(Output& out) const;
+    void WriteProperties(Output& out,
+                         const G4MaterialPropertiesTable* table) const;
+    void WriteSolid(Output& out, const G4VSolid* solid) const;
+    void WriteVolumes(Output& out) const;
+    void WriteSurfaces(Output& out) const;
+    void WriteReaderData(Output& out, const G4GDMLReaderData& data) const;
+    void WriteAuxiliaries(Output& out, const G4GDMLAuxListType& list) const;
+
+    void ReadMaterials(Input& in);
+    G4MaterialPropertiesTable* ReadProperties(Input& in) const;
+    G4VSolid* ReadSolid(Input& in) const;
+    void ReadVolumes(Input& in);
+    void ReadSurfaces(Input& in);
+    void ReadReaderData(Input& in, G4GDMLReaderData& data) const;
+    void ReadAuxiliaries(Input& in, G4GDMLAuxListType& list) const;
+
+    template <class T>
+    static G4int IndexOf(const std::map<const T*, G4int>& index, const T* p);
+
+  private:
+
+    // Objects collected for writing, in order of creation
+    //
+    std::vector<const G4Isotope*> fIsotopes;
+    std::vector<const G4Element*> fElements;
+    std::vector<const G4Material*> fMaterials;
+    std::vector<const G4OpticalSurface*> fOpticalSurfaces;
+    std::vector<const G4VSolid*> fSolids;
+    std::vector<const G4LogicalVolume*> fVolumes;
+    std::vector<const G4VPhysicalVolume*> fPhysVolumes;
+    std::vector<const G4Region*> fRegions;
+    std::vector<const G4UserLimits*> fUserLimits;
+
+    std::map<const G4Isotope*, G4int> fIsotopeIndex;
+    std::map<const G4Element*, G4int> fElementIndex;
+    std::map<const G4Material*, G4int> fMaterialIndex;
+    std::map<const G4OpticalSurface*, G4int> fOpticalSurfaceIndex;
+    std::map<const G4VSolid*, G4int> fSolidIndex;
+    std::map<const G4LogicalVolume*, G4int> fVolumeIndex;
+    std::map<const G4VPhysicalVolume*, G4int> fPhysVolumeIndex;
+    std::map<const G4UserLimits*, G4int> fUserLimitsIndex;
+
+    // Objects created when reading, by index in the cache
+    //
+    std::vector<G4Isotope*> fReadIsotopes;
+    std::vector<G4Element*> fReadElements;
+    std::vector<G4Material*> fReadMaterials;
+    std::vector<G4OpticalSurface*> fReadOpticalSurfaces;
+    std::vector<G4VSolid*> fReadSolids;
+    std::vector<G4LogicalVolume*> fReadVolumes;
+    std::vector<G4VPhysicalVolume*> fReadPhysVolumes;
+    std::vector<G4UserLimits*> fReadUserLimits;
+};
+
+#endif
@@ -55,6 +55,7 @@ class G4GDMLEvaluator
     G4int EvaluateInteger(const G4String&);
     G4double GetConstant(const G4String&);
     G4double GetVariable(const G4String&);
+    const std::vector<G4String>& GetVariableList() const;
     G4String ConvertToString(G4int ival);
     G4String ConvertToString(G4double dval);
 
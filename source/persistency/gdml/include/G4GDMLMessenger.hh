@@ -70,7 +70,9 @@ class G4GDMLMessenger : public G4UImessenger
     G4UIcmdWithABool* EcutsCmd = nullptr;
     G4UIcmdWithABool* SDCmd = nullptr;
     G4UIcmdWithABool* StripCmd = nullptr;
+    G4UIcmdWithABool* StreamCmd = nullptr;
     G4UIcmdWithABool* AppendCmd = nullptr;
+    G4UIcmdWithABool* MeshCmd = nullptr;
 
     G4bool pFlag = true;  // Append pointers to names flag
 };
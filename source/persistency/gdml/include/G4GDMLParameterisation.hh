@@ -75,6 +75,7 @@ class G4GDMLParameterisation : public G4VPVParameterisation
 
     G4int GetSize() const;
     void AddParameter(const PARAMETER&);
+    const PARAMETER& GetParameter(G4int index) const;
 
   private:
 
@@ -39,6 +39,7 @@
 #include "G4STRead.hh"
 #include "G4GDMLMessenger.hh"
 #include "G4GDMLEvaluator.hh"
+#include "G4GDMLBinaryCache.hh"
 
 #include "G4TransportationManager.hh"
 #include "G4Navigator.hh"
@@ -91,6 +92,31 @@ class G4GDMLParser
     // the URL to the GDML web site is used. Same as method above except
     // that the logical volume must be provided here.
 
+    G4bool ReadBinaryCache(const G4String& cachename,
+                           const G4String& filename);
+    //
+    // Imports geometry from the binary cache 'cachename', written for the
+    // GDML file 'filename', with the definitions and auxiliary information
+    // read from it. Returns false, importing nothing, if the cache does
+    // not exist or the content of 'filename', or of the files it refers
+    // to, has changed since.
+
+    G4bool WriteBinaryCache(const G4String& cachename,
+                            const G4String& filename,
+                            const G4VPhysicalVolume* pvol = nullptr);
+    //
+    // Exports on the binary cache 'cachename' the geometry tree starting
+    // from 'pvol', by default the world volume imported, together with
+    // the definitions and auxiliary information read, tagged with the
+    // content of the GDML file 'filename' the geometry was imported from.
+
+    void ReadWithCache(const G4String& filename, const G4String& cachename,
+                       G4bool Validate = true);
+    //
+    // Imports geometry from the binary cache 'cachename' if valid for the
+    // GDML file 'filename'; otherwise imports 'filename' and writes the
+    // cache for following jobs.
+
     inline G4LogicalVolume* ParseST(const G4String& name, G4Material* medium,
                                     G4Material* solid);
     //
@@ -125,6 +151,7 @@ class G4GDMLParser
     inline void SetEnergyCutsExport(G4bool);
     inline void SetSDExport(G4bool);
     inline void SetReverseSearch(G4bool);
+    inline void SetStreamingRead(G4bool);
     inline void SetImportSchema(const G4String& path_and_filename);
 
     inline G4int GetMaxExportLevel() const;  // Manage max number of levels
@@ -137,6 +164,7 @@ class G4GDMLParser
     inline void AddModule(const G4VPhysicalVolume* const physvol);
     inline void AddModule(const G4int depth);
     inline void SetAddPointerToName(G4bool set);
+    inline void SetBinaryMeshes(G4bool set);
     inline void AddVolumeAuxiliary(G4GDMLAuxStructType myaux,
                                    const G4LogicalVolume* const lvol);
     inline void SetOutputFileOverwrite(G4bool flag);
@@ -153,6 +181,7 @@ class G4GDMLParser
     G4GDMLWriteStructure* writer = nullptr;
     G4GDMLAuxListType *rlist = nullptr, *ullist = nullptr;
     G4GDMLMessenger* messenger = nullptr;
+    G4VPhysicalVolume* cachedWorld = nullptr;
     G4bool urcode = false, uwcode = false, strip = false, rexp = false;
 };
 
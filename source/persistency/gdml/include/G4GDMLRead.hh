@@ -140,6 +140,14 @@ class G4GDMLRead
     //
     // Activate/de-activate surface check for overlaps (default is off).
 
+    void SetStreaming(G4bool);
+    //
+    // Activate/de-activate streaming read (default is off). The document
+    // is then parsed sequentially and each element of the "define",
+    // "materials", "solids" and "structure" sections is imported and
+    // released as soon as complete, rather than after building the tree
+    // of the whole document.
+
     const G4GDMLAuxListType* GetAuxList() const;
 
   protected:
@@ -162,12 +170,23 @@ class G4GDMLRead
     G4bool validate = true;
     G4bool check = false;
     G4bool dostrip = true;
+    G4bool streaming = false;
     G4String schema = "";
+    G4String currentFile = "";
+    G4GDMLAuxListType auxGlobalList;
+
+  private:
+
+    void DocumentRead(const G4String& fileName);
+    void StreamRead(const G4String& fileName);
+    void SectionRead(const xercesc::DOMElement* const);
+    //
+    // Import of a whole document, of a document in streaming mode
+    // and of a single section of the document.
 
   private:
 
     G4int inLoop = 0, loopCount = 0;
-    G4GDMLAuxListType auxGlobalList;
 };
 
 #endif
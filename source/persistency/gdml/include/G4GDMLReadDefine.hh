@@ -101,6 +101,7 @@ class G4GDMLReadDefine : public G4GDMLRead
 
   protected:
     G4bool reverseSearch = false;
+    std::map<G4String, G4double> constantMap;
     std::map<G4String, G4double> quantityMap;
     std::map<G4String, G4ThreeVector> positionMap;
     std::map<G4String, G4ThreeVector> rotationMap;
@@ -104,6 +104,10 @@ class G4GDMLReadSolids : public G4GDMLReadMaterials
     void SphereRead(const xercesc::DOMElement* const);
     void TessellatedRead(const xercesc::DOMElement* const);
     void TetRead(const xercesc::DOMElement* const);
+    void MeshRead(const G4String& meshfile, const G4String& meshoffset,
+                  const G4String& solidName,
+                  std::vector<G4ThreeVector>& vertices,
+                  std::vector<G4int>& facetSizes);
     void TorusRead(const xercesc::DOMElement* const);
     void GenTrapRead(const xercesc::DOMElement* const);
     void TrapRead(const xercesc::DOMElement* const);
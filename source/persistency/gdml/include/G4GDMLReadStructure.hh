@@ -44,6 +44,7 @@
 class G4AssemblyVolume;
 class G4LogicalVolume;
 class G4VPhysicalVolume;
+struct G4GDMLReaderData;
 
 using G4GDMLAuxMapType = std::map<G4LogicalVolume*, G4GDMLAuxListType>;
 using G4GDMLAssemblyMapType = std::map<G4String, G4AssemblyVolume*>;
@@ -63,6 +64,11 @@ class G4GDMLReadStructure : public G4GDMLReadParamvol
     const G4GDMLAuxMapType* GetAuxMap() const { return &auxMap; }
     void Clear();  // Clears internal map and evaluator
 
+    void ExportReaderData(G4GDMLReaderData&);
+    void ImportReaderData(const G4GDMLReaderData&);
+      // Copy definitions and auxiliary information from/to the reader,
+      // to store them in a binary cache or restore them from it
+
     virtual void VolumeRead(const xercesc::DOMElement* const);
     virtual void Volume_contentRead(const xercesc::DOMElement* const);
     virtual void StructureRead(const xercesc::DOMElement* const);
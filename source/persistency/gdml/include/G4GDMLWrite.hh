@@ -92,6 +92,11 @@ class G4GDMLWrite
     //
     // Pure virtual methods implemented in concrete writer plugin's classes.
 
+    virtual void BinaryDataWrite();
+    //
+    // Completes the binary data attached to the file being written, if
+    // any, once the document is complete. Empty by default.
+
     virtual void ExtensionWrite(xercesc::DOMElement*);
     virtual void UserinfoWrite(xercesc::DOMElement*);
     virtual void AddExtension(xercesc::DOMElement*,
@@ -128,6 +133,7 @@ class G4GDMLWrite
   protected:
 
     G4String SchemaLocation;
+    G4String outputFileName;
     static G4bool addPointerToName;
     xercesc::DOMDocument* doc = nullptr;
     xercesc::DOMElement* extElement = nullptr;
@@ -39,6 +39,9 @@
 #include "G4GDMLWriteMaterials.hh"
 #include "G4MultiUnion.hh"
 
+#include <cstdint>
+#include <fstream>
+
 class G4BooleanSolid;
 class G4ScaledSolid;
 class G4Box;
@@ -95,6 +98,14 @@ class G4GDMLWriteSolids : public G4GDMLWriteMaterials
     virtual void AddSolid(const G4VSolid* const);
     virtual void SolidsWrite(xercesc::DOMElement*);
 
+    static void SetBinaryMeshes(G4bool);
+    //
+    // Specify if to write the vertices of tessellated and tetrahedral
+    // solids in a binary file attached to the GDML file, named as the
+    // GDML file with suffix ".mesh", instead of as GDML positions.
+    // The solids refer to the file through the attributes 'meshfile'
+    // and 'meshoffset' of the GDML schema.
+
   protected:
 
     G4GDMLWriteSolids();
@@ -122,6 +133,10 @@ class G4GDMLWriteSolids : public G4GDMLWriteMaterials
     void TessellatedWrite(xercesc::DOMElement*,
                           const G4TessellatedSolid* const);
     void TetWrite(xercesc::DOMElement*, const G4Tet* const);
+    void MeshWrite(xercesc::DOMElement*, const G4String&,
+                   const std::vector<G4ThreeVector>& vertices,
+                   const std::vector<G4int>& facetSizes);
+    void BinaryDataWrite();
     void TorusWrite(xercesc::DOMElement*, const G4Torus* const);
     void GenTrapWrite(xercesc::DOMElement*, const G4GenericTrap* const);
     void TrapWrite(xercesc::DOMElement*, const G4Trap* const);
@@ -146,6 +161,9 @@ class G4GDMLWriteSolids : public G4GDMLWriteMaterials
     static const G4int maxTransforms = 8;  // Constant for limiting the number
                                            // of displacements/reflections
                                            // applied to a single solid
+    static G4bool binaryMeshes;
+    std::ofstream meshFile;
+    std::uint64_t meshOffset = 0;
 };
 
 #endif
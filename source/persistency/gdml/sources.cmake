@@ -4,6 +4,7 @@
 geant4_add_module(G4gdml
   PUBLIC_HEADERS
     G4GDMLAuxStructType.hh
+    G4GDMLBinaryCache.hh
     G4GDMLEvaluator.hh
     G4GDMLMessenger.hh
     G4GDMLParameterisation.hh
@@ -25,6 +26,7 @@ geant4_add_module(G4gdml
     G4GDMLWriteStructure.hh
     G4STRead.hh
   SOURCES
+    G4GDMLBinaryCache.cc
     G4GDMLEvaluator.cc
     G4GDMLMessenger.cc
     G4GDMLParameterisation.cc
@@ -0,0 +1,2609 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4GDMLBinaryCache implementation
+//
+// 19.10.2026: Initial version.
+// --------------------------------------------------------------------
+
+#include "G4GDMLBinaryCache.hh"
+
+#include "G4Isotope.hh"
+#include "G4Element.hh"
+#include "G4Material.hh"
+#include "G4NistManager.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4OpticalSurface.hh"
+#include "G4LogicalBorderSurface.hh"
+#include "G4LogicalSkinSurface.hh"
+#include "G4LogicalVolume.hh"
+#include "G4PVPlacement.hh"
+#include "G4PVReplica.hh"
+#include "G4PVDivision.hh"
+#include "G4PVParameterised.hh"
+#include "G4VDivisionParameterisation.hh"
+#include "G4GDMLParameterisation.hh"
+#include "G4UserLimits.hh"
+#include "G4Track.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4ProductionCuts.hh"
+#include "G4SolidPropertiesCache.hh"
+
+#include "G4Box.hh"
+#include "G4Cons.hh"
+#include "G4CutTubs.hh"
+#include "G4Orb.hh"
+#include "G4Para.hh"
+#include "G4Sphere.hh"
+#include "G4Torus.hh"
+#include "G4Trap.hh"
+#include "G4Trd.hh"
+#include "G4Tubs.hh"
+#include "G4Ellipsoid.hh"
+#include "G4EllipticalCone.hh"
+#include "G4EllipticalTube.hh"
+#include "G4ExtrudedSolid.hh"
+#include "G4GenericPolycone.hh"
+#include "G4GenericTrap.hh"
+#include "G4Hype.hh"
+#include "G4Paraboloid.hh"
+#include "G4Polycone.hh"
+#include "G4Polyhedra.hh"
+#include "G4QuadrangularFacet.hh"
+#include "G4TessellatedSolid.hh"
+#include "G4Tet.hh"
+#include "G4TriangularFacet.hh"
+#include "G4TwistedBox.hh"
+#include "G4TwistedTrap.hh"
+#include "G4TwistedTrd.hh"
+#include "G4TwistedTubs.hh"
+#include "G4DisplacedSolid.hh"
+#include "G4IntersectionSolid.hh"
+#include "G4MultiUnion.hh"
+#include "G4ReflectedSolid.hh"
+#include "G4ScaledSolid.hh"
+#include "G4SubtractionSolid.hh"
+#include "G4UnionSolid.hh"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <typeinfo>
+
+#ifndef WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+  // Layout of the header: magic word, format version, byte order mark,
+  // hash of the GDML source, size and hash of the payload following it
+  //
+  const char kMagic[8] = { 'G', '4', 'G', 'D', 'M', 'L', 'B', 'C' };
+  const std::uint32_t kVersion = 3;
+  const std::uint32_t kByteOrder = 0x01020304;
+  const std::size_t kHeaderSize = 8 + 4 + 4 + 8 + 8 + 8;
+
+  enum SolidCode : std::uint8_t
+  {
+    kBox = 1, kCons, kCutTubs, kOrb, kPara, kSphere, kTorus, kTrap, kTrd,
+    kTubs, kEllipsoid, kEllipticalCone, kEllipticalTube, kExtruded,
+    kGenericPolycone, kGenericTrap, kHype, kParaboloid, kPolycone,
+    kPolyhedra, kGenericPolyhedra, kTessellated, kTet, kTwistedBox,
+    kTwistedTrap, kTwistedTrd, kTwistedTubs, kUnion, kSubtraction,
+    kIntersection, kDisplaced, kScaled, kReflected, kMultiUnion
+  };
+
+  enum PhysVolumeCode : std::uint8_t
+  {
+    kPVPlacement = 1, kPVReplica, kPVDivision, kPVParameterised
+  };
+
+  // FNV-1a hash, used for both the GDML sources and the payload
+  //
+  const std::uint64_t kHashSeed = 14695981039346656037ULL;
+
+  std::uint64_t Hash(const char* data, std::size_t size,
+                     std::uint64_t hash = kHashSeed)
+  {
+    for(std::size_t i = 0; i < size; ++i)
+    {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  // Radius to the sides giving back, through the G4Polyhedra constructor,
+  // the radius 'r' to the corners; of the neighbours of r*convertRad the
+  // one also giving a corner of the solid is preferred, as the corners
+  // are scaled from the given radius by a multiplication
+  //
+  G4double SideRadius(G4double r, G4double convertRad,
+                      const std::vector<G4double>& corners)
+  {
+    G4double side = r * convertRad;
+    G4double x = side;
+    for(G4int i = 0; i < 4; ++i)
+    {
+      x = std::nextafter(x, 0.0);
+    }
+    G4bool found = false;
+    for(G4int i = 0; i < 9; ++i, x = std::nextafter(x, DBL_MAX))
+    {
+      if(x / convertRad != r)
+      {
+        continue;
+      }
+      if(std::find(corners.cbegin(), corners.cend(), x * (1 / convertRad))
+         != corners.cend())
+      {
+        return x;
+      }
+      if(!found)
+      {
+        side = x;
+        found = true;
+      }
+    }
+    return side;
+  }
+}
+
+// --------------------------------------------------------------------
+// Buffer to which the payload is serialised before being written
+// --------------------------------------------------------------------
+class G4GDMLBinaryCache::Output
+{
+  public:
+
+    template <typename T>
+    void Put(T value)
+    {
+      const char* p = reinterpret_cast<const char*>(&value);
+      fData.insert(fData.end(), p, p + sizeof(T));
+    }
+
+    void PutIndex(std::size_t value) { Put<std::int32_t>((std::int32_t)value); }
+
+    void PutString(const G4String& value)
+    {
+      Put<std::uint32_t>((std::uint32_t)value.size());
+      fData.insert(fData.end(), value.cbegin(), value.cend());
+    }
+
+    void PutDoubles(const G4double* values, std::size_t n)
+    {
+      Put<std::uint32_t>((std::uint32_t)n);
+      for(std::size_t i = 0; i < n; ++i) { Put(values[i]); }
+    }
+
+    void PutVector(const G4ThreeVector& v)
+    {
+      Put(v.x()); Put(v.y()); Put(v.z());
+    }
+
+    void PutRotation(const G4RotationMatrix& rot)
+    {
+      Put(rot.xx()); Put(rot.xy()); Put(rot.xz());
+      Put(rot.yx()); Put(rot.yy()); Put(rot.yz());
+      Put(rot.zx()); Put(rot.zy()); Put(rot.zz());
+    }
+
+    void PutTransform(const G4Transform3D& transform)
+    {
+      // Stored decomposed as scale, rotation and translation, so that
+      // reflections are also represented
+      //
+      HepGeom::Scale3D scale;
+      HepGeom::Rotate3D rotation;
+      HepGeom::Translate3D translation;
+      transform.getDecomposition(scale, rotation, translation);
+      Put(scale.xx()); Put(scale.yy()); Put(scale.zz());
+      PutRotation(G4RotationMatrix(CLHEP::HepRep3x3(
+        rotation.xx(), rotation.xy(), rotation.xz(),
+        rotation.yx(), rotation.yy(), rotation.yz(),
+        rotation.zx(), rotation.zy(), rotation.zz())));
+      PutVector(translation.getTranslation());
+    }
+
+    const std::vector<char>& Data() const { return fData; }
+
+  private:
+
+    std::vector<char> fData;
+};
+
+// --------------------------------------------------------------------
+// Cursor over the payload of a cache being read. Reading beyond the
+// end of the payload, or an invalid index, sets the failure flag
+// --------------------------------------------------------------------
+class G4GDMLBinaryCache::Input
+{
+  public:
+
+    Input(const char* begin, const char* end)
+      : fCur(begin), fEnd(end) {}
+
+    template <typename T>
+    T Get()
+    {
+      T value{};
+      if((std::size_t)(fEnd - fCur) < sizeof(T))
+      {
+        fFailed = true;
+        return value;
+      }
+      std::memcpy(&value, fCur, sizeof(T));
+      fCur += sizeof(T);
+      return value;
+    }
+
+    void GetBytes(char* values, std::size_t n)
+    {
+      if((std::size_t)(fEnd - fCur) < n)
+      {
+        fFailed = true;
+        return;
+      }
+      std::memcpy(values, fCur, n);
+      fCur += n;
+    }
+
+    G4double GetDouble() { return Get<G4double>(); }
+
+    G4int GetIndex(std::size_t size, G4bool allowNone = false)
+    {
+      auto index = Get<std::int32_t>();
+      if(index >= (std::int32_t)size || index < (allowNone ? -1 : 0))
+      {
+        fFailed = true;
+        return -1;
+      }
+      return index;
+    }
+
+    std::size_t GetCount(std::size_t unitSize = 1)
+    {
+      // A count of items can never exceed the number of bytes left
+      //
+      std::size_t count = Get<std::uint32_t>();
+      if(count * unitSize > (std::size_t)(fEnd - fCur))
+      {
+        fFailed = true;
+        return 0;
+      }
+      return count;
+    }
+
+    G4String GetString()
+    {
+      std::size_t size = GetCount();
+      G4String value(fCur, size);
+      fCur += size;
+      return value;
+    }
+
+    G4ThreeVector GetVector()
+    {
+      G4double x = GetDouble();
+      G4double y = GetDouble();
+      G4double z = GetDouble();
+      return G4ThreeVector(x, y, z);
+    }
+
+    G4RotationMatrix GetRotation()
+    {
+      G4double m[9];
+      for(auto& e : m) { e = GetDouble(); }
+      return G4RotationMatrix(CLHEP::HepRep3x3(m));
+    }
+
+    G4Transform3D GetTransform()
+    {
+      G4double sx = GetDouble();
+      G4double sy = GetDouble();
+      G4double sz = GetDouble();
+      G4RotationMatrix rotation = GetRotation();
+      G4ThreeVector translation = GetVector();
+      return HepGeom::Translate3D(translation) * HepGeom::Rotate3D(rotation)
+             * HepGeom::Scale3D(sx, sy, sz);
+    }
+
+    std::vector<G4double> GetDoubles()
+    {
+      std::size_t n = GetCount(sizeof(G4double));
+      std::vector<G4double> values(n);
+      for(auto& v : values) { v = GetDouble(); }
+      return values;
+    }
+
+    void Fail() { fFailed = true; }
+    G4bool Failed() const { return fFailed; }
+    G4bool AtEnd() const { return fCur == fEnd; }
+
+  private:
+
+    const char* fCur = nullptr;
+    const char* fEnd = nullptr;
+    G4bool fFailed = false;
+};
+
+// --------------------------------------------------------------------
+std::uint64_t G4GDMLBinaryCache::SourceHash(const G4String& filename)
+{
+  std::uint64_t hash = kHashSeed;
+  std::set<G4String> visited;
+  if(!HashFile(filename, hash, visited))
+  {
+    return 0;
+  }
+  return (hash != 0) ? hash : 1;
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::HashFile(const G4String& filename,
+                                   std::uint64_t& hash,
+                                   std::set<G4String>& visited)
+{
+  if(!visited.insert(filename).second)
+  {
+    return true;
+  }
+  std::ifstream file(filename, std::ios::binary);
+  if(!file)
+  {
+    // A missing file referred to is hashed by name, so that the cache
+    // is rejected once it appears
+    //
+    hash = Hash(filename.c_str(), filename.size(), hash);
+    return false;
+  }
+  const std::string content((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  hash = Hash(content.data(), content.size(), hash);
+
+  // Files referred to: modules, named by the 'name' attribute of <file>
+  // elements and opened from the working directory as by the reader,
+  // and external entities, named after SYSTEM and resolved relative to
+  // the directory of the referring file
+  //
+  auto quoted = [&content](std::size_t pos) -> G4String
+  {
+    pos = content.find_first_not_of(" \t\r\n=", pos);
+    if(pos == std::string::npos
+       || (content[pos] != '"' && content[pos] != '\''))
+    {
+      return "";
+    }
+    const std::size_t end = content.find(content[pos], pos + 1);
+    return (end != std::string::npos)
+           ? G4String(content.substr(pos + 1, end - pos - 1)) : G4String();
+  };
+  std::vector<G4String> modules, entities;
+  for(std::size_t pos = content.find("<file"); pos != std::string::npos;
+      pos = content.find("<file", pos + 5))
+  {
+    const std::size_t end = content.find('>', pos);
+    std::size_t attr = content.find("name", pos + 5);
+    if(end != std::string::npos && attr < end)
+    {
+      modules.push_back(quoted(attr + 4));
+    }
+  }
+  for(std::size_t pos = content.find("SYSTEM"); pos != std::string::npos;
+      pos = content.find("SYSTEM", pos + 6))
+  {
+    entities.push_back(quoted(pos + 6));
+  }
+
+  // Binary mesh files of tessellated and tetrahedral solids, named by
+  // 'meshfile' attributes and resolved as external entities, are only
+  // data: their content is hashed without looking for references
+  //
+  std::vector<G4String> meshes;
+  for(std::size_t pos = content.find("meshfile"); pos != std::string::npos;
+      pos = content.find("meshfile", pos + 8))
+  {
+    meshes.push_back(quoted(pos + 8));
+  }
+
+  const std::size_t slash = filename.find_last_of('/');
+  const G4String directory =
+    (slash != std::string::npos) ? filename.substr(0, slash + 1) : "";
+  for(auto* names : { &entities, &meshes })
+  {
+    for(auto& entity : *names)
+    {
+      if(!entity.empty() && entity[0] != '/'
+         && entity.find("://") == std::string::npos)
+      {
+        entity = directory + entity;
+      }
+    }
+  }
+
+  for(const auto& name : modules)
+  {
+    if(!name.empty()) { HashFile(name, hash, visited); }
+  }
+  for(const auto& name : entities)
+  {
+    if(!name.empty() && name.find("://") == std::string::npos)
+    {
+      HashFile(name, hash, visited);
+    }
+  }
+  for(const auto& name : meshes)
+  {
+    if(name.empty() || !visited.insert(name).second)
+    {
+      continue;
+    }
+    std::ifstream mesh(name, std::ios::binary);
+    if(!mesh)
+    {
+      hash = Hash(name.c_str(), name.size(), hash);
+      continue;
+    }
+    const std::string data((std::istreambuf_iterator<char>(mesh)),
+                           std::istreambuf_iterator<char>());
+    hash = Hash(data.data(), data.size(), hash);
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+template <class T>
+G4int G4GDMLBinaryCache::IndexOf(const std::map<const T*, G4int>& index,
+                                 const T* p)
+{
+  auto pos = index.find(p);
+  return (pos != index.cend()) ? pos->second : -1;
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::Clear()
+{
+  fIsotopes.clear();
+  fElements.clear();
+  fMaterials.clear();
+  fOpticalSurfaces.clear();
+  fSolids.clear();
+  fVolumes.clear();
+  fPhysVolumes.clear();
+  fRegions.clear();
+  fUserLimits.clear();
+  fIsotopeIndex.clear();
+  fElementIndex.clear();
+  fMaterialIndex.clear();
+  fOpticalSurfaceIndex.clear();
+  fSolidIndex.clear();
+  fVolumeIndex.clear();
+  fPhysVolumeIndex.clear();
+  fUserLimitsIndex.clear();
+  fReadIsotopes.clear();
+  fReadElements.clear();
+  fReadMaterials.clear();
+  fReadOpticalSurfaces.clear();
+  fReadSolids.clear();
+  fReadVolumes.clear();
+  fReadPhysVolumes.clear();
+  fReadUserLimits.clear();
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::Write(const G4String& filename,
+                                const G4VPhysicalVolume* world,
+                                std::uint64_t sourceHash,
+                                const G4GDMLReaderData* readerData)
+{
+  Clear();
+
+  // Collect all objects in the tree; logical volumes first, then their
+  // daughters, so that physical volumes are grouped by mother volume
+  // in the order of placement
+  //
+  if(!CollectVolume(world->GetLogicalVolume()))
+  {
+    return false;
+  }
+  fPhysVolumeIndex[world] = 0;
+  fPhysVolumes.push_back(world);
+  for(auto lvol : fVolumes)
+  {
+    for(std::size_t i = 0; i < lvol->GetNoDaughters(); ++i)
+    {
+      const G4VPhysicalVolume* pvol = lvol->GetDaughter(i);
+      fPhysVolumeIndex[pvol] = (G4int)fPhysVolumes.size();
+      fPhysVolumes.push_back(pvol);
+    }
+  }
+  if(!CollectSurfaces() || !CollectRegions())
+  {
+    return false;
+  }
+
+  Output payload;
+  WriteMaterials(payload);
+  payload.PutIndex(fSolids.size());
+  for(auto solid : fSolids)
+  {
+    WriteSolid(payload, solid);
+  }
+  WriteVolumes(payload);
+  WriteSurfaces(payload);
+
+  // Estimates of volume and surface of solids computed so far, so that
+  // following jobs need not repeat the sampling
+  //
+  std::ostringstream estimates;
+  G4SolidPropertiesCache::GetInstance()->Store(estimates);
+  payload.PutString(estimates.str());
+
+  payload.Put<std::uint8_t>((readerData != nullptr) ? 1 : 0);
+  if(readerData != nullptr)
+  {
+    WriteReaderData(payload, *readerData);
+  }
+
+  const std::vector<char>& data = payload.Data();
+  Output header;
+  for(auto c : kMagic)
+  {
+    header.Put(c);
+  }
+  header.Put(kVersion);
+  header.Put(kByteOrder);
+  header.Put<std::uint64_t>(sourceHash);
+  header.Put<std::uint64_t>(data.size());
+  header.Put<std::uint64_t>(Hash(data.data(), data.size()));
+
+  // Write to a temporary file first, so that jobs started concurrently
+  // never see a partially written cache
+  //
+  const G4String tmpname = filename + ".tmp";
+  std::ofstream file(tmpname, std::ios::binary | std::ios::trunc);
+  file.write(header.Data().data(), (std::streamsize)header.Data().size());
+  file.write(data.data(), (std::streamsize)data.size());
+  file.close();
+#ifdef WIN32
+  std::remove(filename.c_str());
+#endif
+  if(!file || std::rename(tmpname.c_str(), filename.c_str()) != 0)
+  {
+    std::remove(tmpname.c_str());
+    G4String message = "Failed to write binary cache: " + filename;
+    G4Exception("G4GDMLBinaryCache::Write()", "WriteError", JustWarning,
+                message);
+    return false;
+  }
+
+  G4cout << "G4GDML: Binary cache written: " << filename << " ("
+         << fSolids.size() << " solids, " << fVolumes.size()
+         << " logical and " << fPhysVolumes.size()
+         << " physical volumes)" << G4endl;
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::CollectVolume(const G4LogicalVolume* lvol)
+{
+  if(fVolumeIndex.find(lvol) != fVolumeIndex.cend())
+  {
+    return true;
+  }
+  if(!CollectSolid(lvol->GetSolid()))
+  {
+    return false;
+  }
+  CollectMaterial(lvol->GetMaterial());
+  if(!CollectUserLimits(lvol->GetUserLimits()))
+  {
+    return false;
+  }
+  fVolumeIndex[lvol] = (G4int)fVolumes.size();
+  fVolumes.push_back(lvol);
+
+  for(std::size_t i = 0; i < lvol->GetNoDaughters(); ++i)
+  {
+    const G4VPhysicalVolume* pvol = lvol->GetDaughter(i);
+    const G4bool gdmlParameterised = typeid(*pvol) == typeid(G4PVParameterised)
+      && dynamic_cast<G4GDMLParameterisation*>(pvol->GetParameterisation())
+         != nullptr;
+    if(typeid(*pvol) != typeid(G4PVPlacement)
+       && typeid(*pvol) != typeid(G4PVReplica)
+       && typeid(*pvol) != typeid(G4PVDivision) && !gdmlParameterised)
+    {
+      G4String message = "Physical volume '" + pvol->GetName()
+                       + "' cannot be stored in a binary cache!";
+      G4Exception("G4GDMLBinaryCache::CollectVolume()", "InvalidSetup",
+                  JustWarning, message);
+      return false;
+    }
+    if(!CollectVolume(pvol->GetLogicalVolume()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::CollectSolid(const G4VSolid* solid)
+{
+  if(fSolidIndex.find(solid) != fSolidIndex.cend())
+  {
+    return true;
+  }
+
+  // Add constituents of composed solids before the solid itself
+  //
+  const G4String type = solid->GetEntityType();
+  G4bool supported = true;
+  if(type == "G4UnionSolid" || type == "G4SubtractionSolid"
+     || type == "G4IntersectionSolid")
+  {
+    auto boolean = static_cast<const G4BooleanSolid*>(solid);
+    supported = CollectSolid(boolean->GetConstituentSolid(0))
+             && CollectSolid(boolean->GetConstituentSolid(1));
+  }
+  else if(type == "G4DisplacedSolid")
+  {
+    supported = CollectSolid(
+      static_cast<const G4DisplacedSolid*>(solid)->GetConstituentMovedSolid());
+  }
+  else if(type == "G4ReflectedSolid")
+  {
+    supported = CollectSolid(
+      static_cast<const G4ReflectedSolid*>(solid)->GetConstituentMovedSolid());
+  }
+  else if(type == "G4ScaledSolid")
+  {
+    supported = CollectSolid(
+      static_cast<const G4ScaledSolid*>(solid)->GetUnscaledSolid());
+  }
+  else if(type == "G4MultiUnion")
+  {
+    auto munion = static_cast<const G4MultiUnion*>(solid);
+    for(G4int i = 0; i < munion->GetNumberOfSolids() && supported; ++i)
+    {
+      supported = CollectSolid(munion->GetSolid(i));
+    }
+  }
+  else if(type == "G4TessellatedSolid")
+  {
+    auto tess = static_cast<const G4TessellatedSolid*>(solid);
+    for(G4int i = 0; i < tess->GetNumberOfFacets() && supported; ++i)
+    {
+      const std::size_t n = tess->GetFacet(i)->GetNumberOfVertices();
+      supported = (n == 3 || n == 4);
+    }
+  }
+  else
+  {
+    static const std::vector<G4String> others = {
+      "G4Box", "G4Cons", "G4CutTubs", "G4Orb", "G4Para", "G4Sphere",
+      "G4Torus", "G4Trap", "G4Trd", "G4Tubs", "G4Ellipsoid",
+      "G4EllipticalCone", "G4EllipticalTube", "G4ExtrudedSolid",
+      "G4GenericPolycone", "G4GenericTrap", "G4Hype", "G4Paraboloid",
+      "G4Polycone", "G4Polyhedra", "G4Tet", "G4TwistedBox", "G4TwistedTrap",
+      "G4TwistedTrd", "G4TwistedTubs" };
+    supported = std::find(others.cbegin(), others.cend(), type)
+                != others.cend();
+  }
+  if(!supported)
+  {
+    G4String message = "Solid '" + solid->GetName() + "' of type " + type
+                     + " cannot be stored in a binary cache!";
+    G4Exception("G4GDMLBinaryCache::CollectSolid()", "InvalidSetup",
+                JustWarning, message);
+    return false;
+  }
+  fSolidIndex[solid] = (G4int)fSolids.size();
+  fSolids.push_back(solid);
+  return true;
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::CollectMaterial(const G4Material* material)
+{
+  if(fMaterialIndex.find(material) != fMaterialIndex.cend())
+  {
+    return;
+  }
+  for(std::size_t i = 0; i < material->GetNumberOfElements(); ++i)
+  {
+    const G4Element* element = material->GetElement((G4int)i);
+    if(fElementIndex.find(element) != fElementIndex.cend())
+    {
+      continue;
+    }
+    if(!element->GetNaturalAbundanceFlag())
+    {
+      for(std::size_t j = 0; j < element->GetNumberOfIsotopes(); ++j)
+      {
+        const G4Isotope* isotope = element->GetIsotope((G4int)j);
+        if(fIsotopeIndex.find(isotope) == fIsotopeIndex.cend())
+        {
+          fIsotopeIndex[isotope] = (G4int)fIsotopes.size();
+          fIsotopes.push_back(isotope);
+        }
+      }
+    }
+    fElementIndex[element] = (G4int)fElements.size();
+    fElements.push_back(element);
+  }
+  fMaterialIndex[material] = (G4int)fMaterials.size();
+  fMaterials.push_back(material);
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::CollectUserLimits(const G4UserLimits* limits)
+{
+  if(limits == nullptr
+     || fUserLimitsIndex.find(limits) != fUserLimitsIndex.cend())
+  {
+    return true;
+  }
+  if(typeid(*limits) != typeid(G4UserLimits))
+  {
+    G4String message = "User limits of type '" + limits->GetType()
+                     + "' cannot be stored in a binary cache!";
+    G4Exception("G4GDMLBinaryCache::CollectUserLimits()", "InvalidSetup",
+                JustWarning, message);
+    return false;
+  }
+  fUserLimitsIndex[limits] = (G4int)fUserLimits.size();
+  fUserLimits.push_back(limits);
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::CollectSurfaces()
+{
+  auto collect = [this](const G4LogicalSurface* surface)
+  {
+    auto optical =
+      dynamic_cast<const G4OpticalSurface*>(surface->GetSurfaceProperty());
+    if(optical == nullptr)
+    {
+      G4String message = "Surface '" + surface->GetName()
+                       + "' cannot be stored in a binary cache!";
+      G4Exception("G4GDMLBinaryCache::CollectSurfaces()", "InvalidSetup",
+                  JustWarning, message);
+      return false;
+    }
+    if(fOpticalSurfaceIndex.find(optical) == fOpticalSurfaceIndex.cend())
+    {
+      fOpticalSurfaceIndex[optical] = (G4int)fOpticalSurfaces.size();
+      fOpticalSurfaces.push_back(optical);
+    }
+    return true;
+  };
+
+  for(const auto& pos : *G4LogicalBorderSurface::GetSurfaceTable())
+  {
+    const G4LogicalBorderSurface* border = pos.second;
+    if(IndexOf(fPhysVolumeIndex, border->GetVolume1()) >= 0
+       && IndexOf(fPhysVolumeIndex, border->GetVolume2()) >= 0
+       && !collect(border))
+    {
+      return false;
+    }
+  }
+  for(auto skin : *G4LogicalSkinSurface::GetSurfaceTable())
+  {
+    if(IndexOf(fVolumeIndex, skin->GetLogicalVolume()) >= 0
+       && !collect(skin))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLBinaryCache::CollectRegions()
+{
+  // Regions having root volumes in the tree, apart from the default
+  // regions, which are created by the run manager
+  //
+  for(auto region : *G4RegionStore::GetInstance())
+  {
+    if(G4StrUtil::starts_with(region->GetName(), "DefaultRegionFor"))
+    {
+      continue;
+    }
+    auto pos = region->GetRootLogicalVolumeIterator();
+    for(std::size_t i = 0; i < region->GetNumberOfRootVolumes(); ++i, ++pos)
+    {
+      if(IndexOf<G4LogicalVolume>(fVolumeIndex, *pos) >= 0)
+      {
+        if(!CollectUserLimits(region->GetUserLimits()))
+        {
+          return false;
+        }
+        fRegions.push_back(region);
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteMaterials(Output& out) const
+{
+  out.PutIndex(fIsotopes.size());
+  for(auto isotope : fIsotopes)
+  {
+    out.PutString(isotope->GetName());
+    out.Put<std::int32_t>(isotope->GetZ());
+    out.Put<std::int32_t>(isotope->GetN());
+    out.Put(isotope->GetA());
+    out.Put<std::int32_t>(isotope->Getm());
+  }
+
+  out.PutIndex(fElements.size());
+  for(auto element : fElements)
+  {
+    out.PutString(element->GetName());
+    out.PutString(element->GetSymbol());
+    out.Put(element->GetZ());
+    out.Put(element->GetA());
+    const G4bool natural = element->GetNaturalAbundanceFlag();
+    out.Put<std::uint8_t>(natural ? 1 : 0);
+    if(!natural)
+    {
+      out.PutIndex(element->GetNumberOfIsotopes());
+      for(std::size_t j = 0; j < element->GetNumberOfIsotopes(); ++j)
+      {
+        out.PutIndex(fIsotopeIndex.at(element->GetIsotope((G4int)j)));
+        out.Put(element->GetRelativeAbundanceVector()[j]);
+      }
+    }
+  }
+
+  out.PutIndex(fMaterials.size());
+  for(auto material : fMaterials)
+  {
+    const std::size_t nElements = material->GetNumberOfElements();
+    const G4double* fractions = material->GetFractionVector();
+
+    // Components are stored by number of atoms only if this reproduces
+    // exactly the mass fractions of the material
+    //
+    const G4int* atoms = material->GetAtomsVector();
+    G4bool byAtoms = (atoms != nullptr && nElements > 1);
+    if(byAtoms)
+    {
+      G4double amol = 0.;
+      for(std::size_t i = 0; i < nElements; ++i)
+      {
+        amol += atoms[i] * material->GetElement((G4int)i)->GetA();
+      }
+      for(std::size_t i = 0; i < nElements && byAtoms; ++i)
+      {
+        const G4double w =
+          atoms[i] * material->GetElement((G4int)i)->GetA() / amol;
+        byAtoms = std::fabs(w - fractions[i]) <= 1.e-12;
+      }
+    }
+
+    out.PutString(material->GetName());
+    out.PutString(material->GetChemicalFormula());
+    out.Put(material->GetDensity());
+    out.Put<std::int32_t>(material->GetState());
+    out.Put(material->GetTemperature());
+    out.Put(material->GetPressure());
+    out.Put<std::uint8_t>(byAtoms ? 1 : 0);
+    out.PutIndex(nElements);
+    for(std::size_t i = 0; i < nElements; ++i)
+    {
+      out.PutIndex(fElementIndex.at(material->GetElement((G4int)i)));
+      if(byAtoms)
+      {
+        out.Put<std::int32_t>(atoms[i]);
+      }
+      else
+      {
+        out.Put(fractions[i]);
+      }
+    }
+    out.Put(material->GetIonisation()->GetMeanExcitationEnergy());
+    WriteProperties(out, material->GetMaterialPropertiesTable());
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteProperties(
+  Output& out, const G4MaterialPropertiesTable* table) const
+{
+  if(table == nullptr)
+  {
+    out.Put<std::uint8_t>(0);
+    return;
+  }
+  out.Put<std::uint8_t>(1);
+
+  const auto& names = table->GetMaterialPropertyNames();
+  const auto& properties = table->GetProperties();
+  std::size_t count = 0;
+  for(auto property : properties)
+  {
+    if(property != nullptr) { ++count; }
+  }
+  out.PutIndex(count);
+  for(std::size_t i = 0; i < properties.size(); ++i)
+  {
+    const G4MaterialPropertyVector* property = properties[i];
+    if(property == nullptr)
+    {
+      continue;
+    }
+    const std::size_t n = property->GetVectorLength();
+    std::vector<G4double> energies(n), values(n);
+    for(std::size_t j = 0; j < n; ++j)
+    {
+      energies[j] = property->Energy(j);
+      values[j] = (*property)[j];
+    }
+    out.PutString(names[i]);
+    out.Put<std::uint8_t>(property->GetSpline() ? 1 : 0);
+    out.PutDoubles(energies.data(), n);
+    out.PutDoubles(values.data(), n);
+  }
+
+  const auto& constNames = table->GetMaterialConstPropertyNames();
+  const auto& constProperties = table->GetConstProperties();
+  count = 0;
+  for(const auto& property : constProperties)
+  {
+    if(property.second) { ++count; }
+  }
+  out.PutIndex(count);
+  for(std::size_t i = 0; i < constProperties.size(); ++i)
+  {
+    if(constProperties[i].second)
+    {
+      out.PutString(constNames[i]);
+      out.Put(constProperties[i].first);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteSolid(Output& out, const G4VSolid* solid) const
+{
+  const G4String type = solid->GetEntityType();
+
+  if(type == "G4Box")
+  {
+    auto box = static_cast<const G4Box*>(solid);
+    out.Put<std::uint8_t>(kBox);
+    out.PutString(solid->GetName());
+    out.Put(box->GetXHalfLength());
+    out.Put(box->GetYHalfLength());
+    out.Put(box->GetZHalfLength());
+  }
+  else if(type == "G4Cons")
+  {
+    auto cons = static_cast<const G4Cons*>(solid);
+    out.Put<std::uint8_t>(kCons);
+    out.PutString(solid->GetName());
+    out.Put(cons->GetInnerRadiusMinusZ());
+    out.Put(cons->GetOuterRadiusMinusZ());
+    out.Put(cons->GetInnerRadiusPlusZ());
+    out.Put(cons->GetOuterRadiusPlusZ());
+    out.Put(cons->GetZHalfLength());
+    out.Put(cons->GetStartPhiAngle());
+    out.Put(cons->GetDeltaPhiAngle());
+  }
+  else if(type == "G4CutTubs")
+  {
+    auto tubs = static_cast<const G4CutTubs*>(solid);
+    out.Put<std::uint8_t>(kCutTubs);
+    out.PutString(solid->GetName());
+    out.Put(tubs->GetInnerRadius());
+    out.Put(tubs->GetOuterRadius());
+    out.Put(tubs->GetZHalfLength());
+    out.Put(tubs->GetStartPhiAngle());
+    out.Put(tubs->GetDeltaPhiAngle());
+    out.PutVector(tubs->GetLowNorm());
+    out.PutVector(tubs->GetHighNorm());
+  }
+  else if(type == "G4Orb")
+  {
+    out.Put<std::uint8_t>(kOrb);
+    out.PutString(solid->GetName());
+    out.Put(static_cast<const G4Orb*>(solid)->GetRadius());
+  }
+  else if(type == "G4Para")
+  {
+    auto para = static_cast<const G4Para*>(solid);
+    const G4ThreeVector axis = para->GetSymAxis();
+    out.Put<std::uint8_t>(kPara);
+    out.PutString(solid->GetName());
+    out.Put(para->GetXHalfLength());
+    out.Put(para->GetYHalfLength());
+    out.Put(para->GetZHalfLength());
+    out.Put(std::atan(para->GetTanAlpha()));
+    out.Put(axis.theta());
+    out.Put(axis.phi());
+  }
+  else if(type == "G4Sphere")
+  {
+    auto sphere = static_cast<const G4Sphere*>(solid);
+    out.Put<std::uint8_t>(kSphere);
+    out.PutString(solid->GetName());
+    out.Put(sphere->GetInnerRadius());
+    out.Put(sphere->GetOuterRadius());
+    out.Put(sphere->GetStartPhiAngle());
+    out.Put(sphere->GetDeltaPhiAngle());
+    out.Put(sphere->GetStartThetaAngle());
+    out.Put(sphere->GetDeltaThetaAngle());
+  }
+  else if(type == "G4Torus")
+  {
+    auto torus = static_cast<const G4Torus*>(solid);
+    out.Put<std::uint8_t>(kTorus);
+    out.PutString(solid->GetName());
+    out.Put(torus->GetRmin());
+    out.Put(torus->GetRmax());
+    out.Put(torus->GetRtor());
+    out.Put(torus->GetSPhi());
+    out.Put(torus->GetDPhi());
+  }
+  else if(type == "G4Trap")
+  {
+    auto trap = static_cast<const G4Trap*>(solid);
+    const G4ThreeVector axis = trap->GetSymAxis();
+    out.Put<std::uint8_t>(kTrap);
+    out.PutString(solid->GetName());
+    out.Put(trap->GetZHalfLength());
+    out.Put(axis.theta());
+    out.Put(axis.phi());
+    out.Put(trap->GetYHalfLength1());
+    out.Put(trap->GetXHalfLength1());
+    out.Put(trap->GetXHalfLength2());
+    out.Put(std::atan(trap->GetTanAlpha1()));
+    out.Put(trap->GetYHalfLength2());
+    out.Put(trap->GetXHalfLength3());
+    out.Put(trap->GetXHalfLength4());
+    out.Put(std::atan(trap->GetTanAlpha2()));
+  }
+  else if(type == "G4Trd")
+  {
+    auto trd = static_cast<const G4Trd*>(solid);
+    out.Put<std::uint8_t>(kTrd);
+    out.PutString(solid->GetName());
+    out.Put(trd->GetXHalfLength1());
+    out.Put(trd->GetXHalfLength2());
+    out.Put(trd->GetYHalfLength1());
+    out.Put(trd->GetYHalfLength2());
+    out.Put(trd->GetZHalfLength());
+  }
+  else if(type == "G4Tubs")
+  {
+    auto tubs = static_cast<const G4Tubs*>(solid);
+    out.Put<std::uint8_t>(kTubs);
+    out.PutString(solid->GetName());
+    out.Put(tubs->GetInnerRadius());
+    out.Put(tubs->GetOuterRadius());
+    out.Put(tubs->GetZHalfLength());
+    out.Put(tubs->GetStartPhiAngle());
+    out.Put(tubs->GetDeltaPhiAngle());
+  }
+  else if(type == "G4Ellipsoid")
+  {
+    auto ellipsoid = static_cast<const G4Ellipsoid*>(solid);
+    out.Put<std::uint8_t>(kEllipsoid);
+    out.PutString(solid->GetName());
+    out.Put(ellipsoid->GetSemiAxisMax(0));
+    out.Put(ellipsoid->GetSemiAxisMax(1));
+    out.Put(ellipsoid->GetSemiAxisMax(2));
+    out.Put(ellipsoid->GetZBottomCut());
+    out.Put(ellipsoid->GetZTopCut());
+  }
+  else if(type == "G4EllipticalCone")
+  {
+    auto elcone = static_cast<const G4EllipticalCone*>(solid);
+    out.Put<std::uint8_t>(kEllipticalCone);
+    out.PutString(solid->GetName());
+    out.Put(elcone->GetSemiAxisX());
+    out.Put(elcone->GetSemiAxisY());
+    out.Put(elcone->GetZMax());
+    out.Put(elcone->GetZTopCut());
+  }
+  else if(type == "G4EllipticalTube")
+  {
+    auto eltube = static_cast<const G4EllipticalTube*>(solid);
+    out.Put<std::uint8_t>(kEllipticalTube);
+    out.PutString(solid->GetName());
+    out.Put(eltube->GetDx());
+    out.Put(eltube->GetDy());
+    out.Put(eltube->GetDz());
+  }
+  else if(type == "G4ExtrudedSolid")
+  {
+    auto xtru = static_cast<const G4ExtrudedSolid*>(solid);
+    out.Put<std::uint8_t>(kExtruded);
+    out.PutString(solid->GetName());
+    out.PutIndex(xtru->GetNofVertices());
+    for(G4int i = 0; i < xtru->GetNofVertices(); ++i)
+    {
+      out.Put(xtru->GetVertex(i).x());
+      out.Put(xtru->GetVertex(i).y());
+    }
+    out.PutIndex(xtru->GetNofZSections());
+    for(G4int i = 0; i < xtru->GetNofZSections(); ++i)
+    {
+      const G4ExtrudedSolid::ZSection section = xtru->GetZSection(i);
+      out.Put(section.fZ);
+      out.Put(section.fOffset.x());
+      out.Put(section.fOffset.y());
+      out.Put(section.fScale);
+    }
+  }
+  else if(type == "G4GenericPolycone")
+  {
+    auto polycone = static_cast<const G4GenericPolycone*>(solid);
+    const G4int n = polycone->GetNumRZCorner();
+    std::vector<G4double> r(n), z(n);
+    for(G4int i = 0; i < n; ++i)
+    {
+      r[i] = polycone->GetCorner(i).r;
+      z[i] = polycone->GetCorner(i).z;
+    }
+    out.Put<std::uint8_t>(kGenericPolycone);
+    out.PutString(solid->GetName());
+    out.Put(polycone->GetStartPhi());
+    out.Put(polycone->GetEndPhi() - polycone->GetStartPhi());
+    out.PutDoubles(r.data(), n);
+    out.PutDoubles(z.data(), n);
+  }
+  else if(type == "G4GenericTrap")
+  {
+    auto gtrap = static_cast<const G4GenericTrap*>(solid);
+    out.Put<std::uint8_t>(kGenericTrap);
+    out.PutString(solid->GetName());
+    out.Put(gtrap->GetZHalfLength());
+    for(const auto& vertex : gtrap->GetVertices())
+    {
+      out.Put(vertex.x());
+      out.Put(vertex.y());
+    }
+  }
+  else if(type == "G4Hype")
+  {
+    auto hype = static_cast<const G4Hype*>(solid);
+    out.Put<std::uint8_t>(kHype);
+    out.PutString(solid->GetName());
+    out.Put(hype->GetInnerRadius());
+    out.Put(hype->GetOuterRadius());
+    out.Put(hype->GetInnerStereo());
+    out.Put(hype->GetOuterStereo());
+    out.Put(hype->GetZHalfLength());
+  }
+  else if(type == "G4Paraboloid")
+  {
+    auto paraboloid = static_cast<const G4Paraboloid*>(solid);
+    out.Put<std::uint8_t>(kParaboloid);
+    out.PutString(solid->GetName());
+    out.Put(paraboloid->GetZHalfLength());
+    out.Put(paraboloid->GetRadiusMinusZ());
+    out.Put(paraboloid->GetRadiusPlusZ());
+  }
+  else if(type == "G4Polycone")
+  {
+    const G4PolyconeHistorical* original =
+      static_cast<const G4Polycone*>(solid)->GetOriginalParameters();
+    out.Put<std::uint8_t>(kPolycone);
+    out.PutString(solid->GetName());
+    out.Put(original->Start_angle);
+    out.Put(original->Opening_angle);
+    out.PutDoubles(original->Z_values, original->Num_z_planes);
+    out.PutDoubles(original->Rmin, original->Num_z_planes);
+    out.PutDoubles(original->Rmax, original->Num_z_planes);
+  }
+  else if(type == "G4Polyhedra")
+  {
+    auto polyhedra = static_cast<const G4Polyhedra*>(solid);
+    if(!polyhedra->IsGeneric())
+    {
+      // The original radii are stored divided by the factor converting
+      // the distance to the sides into the distance to the corners
+      //
+      const G4PolyhedraHistorical* original =
+        polyhedra->GetOriginalParameters();
+      const G4int n = original->Num_z_planes;
+      const G4double convertRad =
+        std::cos(0.5 * original->Opening_angle / original->numSide);
+      std::vector<G4double> corners(polyhedra->GetNumRZCorner());
+      for(std::size_t i = 0; i < corners.size(); ++i)
+      {
+        corners[i] = polyhedra->GetCorner((G4int)i).r;
+      }
+      std::vector<G4double> rmin(n), rmax(n);
+      for(G4int i = 0; i < n; ++i)
+      {
+        rmin[i] = SideRadius(original->Rmin[i], convertRad, corners);
+        rmax[i] = SideRadius(original->Rmax[i], convertRad, corners);
+      }
+      out.Put<std::uint8_t>(kPolyhedra);
+      out.PutString(solid->GetName());
+      out.Put(original->Start_angle);
+      out.Put(original->Opening_angle);
+      out.Put<std::int32_t>(original->numSide);
+      out.PutDoubles(original->Z_values, n);
+      out.PutDoubles(rmin.data(), n);
+      out.PutDoubles(rmax.data(), n);
+    }
+    else
+    {
+      const G4int n = polyhedra->GetNumRZCorner();
+      std::vector<G4double> r(n), z(n);
+      for(G4int i = 0; i < n; ++i)
+      {
+        r[i] = polyhedra->GetCorner(i).r;
+        z[i] = polyhedra->GetCorner(i).z;
+      }
+      out.Put<std::uint8_t>(kGenericPolyhedra);
+      out.PutString(solid->GetName());
+      out.Put(polyhedra->GetStartPhi());
+      out.Put(polyhedra->GetEndPhi() - polyhedra->GetStartPhi());
+      out.Put<std::int32_t>(polyhedra->GetNumSide());
+      out.PutDoubles(r.data(), n);
+      out.PutDoubles(z.data(), n);
+    }
+  }
+  else if(type == "G4TessellatedSolid")
+  {
+    auto tess = static_cast<const G4TessellatedSolid*>(solid);
+    out.Put<std::uint8_t>(kTessellated);
+    out.PutString(solid->GetName());
+    out.PutIndex(tess->GetNumberOfFacets());
+    for(G4int i = 0; i < tess->GetNumberOfFacets(); ++i)
+    {
+      const G4VFacet* facet = tess->GetFacet(i);
+      out.Put<std::uint8_t>((std::uint8_t)facet->GetNumberOfVertices());
+      for(G4int j = 0; j < facet->GetNumberOfVertices(); ++j)
+      {
+        out.PutVector(facet->GetVertex(j));
+      }
+    }
+  }
+  else if(type == "G4Tet")
+  {
+    out.Put<std::uint8_t>(kTet);
+    out.PutString(solid->GetName());
+    for(const auto& vertex : static_cast<const G4Tet*>(solid)->GetVertices())
+    {
+      out.PutVector(vertex);
+    }
+  }
+  else if(type == "G4TwistedBox")
+  {
+    auto twisted = static_cast<const G4TwistedBox*>(solid);
+    out.Put<std::uint8_t>(kTwistedBox);
+    out.PutString(solid->GetName());
+    out.Put(twisted->GetPhiTwist());
+    out.Put(twisted->GetXHalfLength());
+    out.Put(twisted->GetYHalfLength());
+    out.Put(twisted->GetZHalfLength());
+  }
+  else if(type == "G4TwistedTrap")
+  {
+    auto twisted = static_cast<const G4TwistedTrap*>(solid);
+    out.Put<std::uint8_t>(kTwistedTrap);
+    out.PutString(solid->GetName());
+    out.Put(twisted->GetTwistAngle());
+    out.Put(twisted->GetDz());
+    out.Put(twisted->GetTheta());
+    out.Put(twisted->GetPhi());
+    out.Put(twisted->GetDy1());
+    out.Put(twisted->GetDx1());
+    out.Put(twisted->GetDx2());
+    out.Put(twisted->GetDy2());
+    out.Put(twisted->GetDx3());
+    out.Put(twisted->GetDx4());
+    out.Put(twisted->GetAlpha());
+  }
+  else if(type == "G4TwistedTrd")
+  {
+    auto twisted = static_cast<const G4TwistedTrd*>(solid);
+    out.Put<std::uint8_t>(kTwistedTrd);
+    out.PutString(solid->GetName());
+    out.Put(twisted->GetX1HalfLength());
+    out.Put(twisted->GetX2HalfLength());
+    out.Put(twisted->GetY1HalfLength());
+    out.Put(twisted->GetY2HalfLength());
+    out.Put(twisted->GetZHalfLength());
+    out.Put(twisted->GetPhiTwist());
+  }
+  else if(type == "G4TwistedTubs")
+  {
+    auto twisted = static_cast<const G4TwistedTubs*>(solid);
+    out.Put<std::uint8_t>(kTwistedTubs);
+    out.PutString(solid->GetName());
+    out.Put(twisted->GetPhiTwist());
+    out.Put(twisted->GetInnerRadius());
+    out.Put(twisted->GetOuterRadius());
+    out.Put(twisted->GetEndZ(0));
+    out.Put(twisted->GetEndZ(1));
+    out.Put(twisted->GetDPhi());
+  }
+  else if(type == "G4UnionSolid" || type == "G4SubtractionSolid"
+          || type == "G4IntersectionSolid")
+  {
+    auto boolean = static_cast<const G4BooleanSolid*>(solid);
+    out.Put<std::uint8_t>((type == "G4UnionSolid") ? kUnion
+                          : (type == "G4SubtractionSolid") ? kSubtraction
+                                                           : kIntersection);
+    out.PutString(solid->GetName());
+    out.PutIndex(fSolidIndex.at(boolean->GetConstituentSolid(0)));
+    out.PutIndex(fSolidIndex.at(boolean->GetConstituentSolid(1)));
+  }
+  else if(type == "G4DisplacedSolid")
+  {
+    auto displaced = static_cast<const G4DisplacedSolid*>(solid);
+    const G4AffineTransform transform = displaced->GetDirectTransform();
+    out.Put<std::uint8_t>(kDisplaced);
+    out.PutString(solid->GetName());
+    out.PutIndex(fSolidIndex.at(displaced->GetConstituentMovedSolid()));
+    out.PutRotation(transform.NetRotation());
+    out.PutVector(transform.NetTranslation());
+  }
+  else if(type == "G4ReflectedSolid")
+  {
+    auto reflected = static_cast<const G4ReflectedSolid*>(solid);
+    out.Put<std::uint8_t>(kReflected);
+    out.PutString(solid->GetName());
+    out.PutIndex(fSolidIndex.at(reflected->GetConstituentMovedSolid()));
+    out.PutTransform(reflected->GetDirectTransform3D());
+  }
+  else if(type == "G4ScaledSolid")
+  {
+    auto scaled = static_cast<const G4ScaledSolid*>(solid);
+    const G4Scale3D scale = scaled->GetScaleTransform();
+    out.Put<std::uint8_t>(kScaled);
+    out.PutString(solid->GetName());
+    out.PutIndex(fSolidIndex.at(scaled->GetUnscaledSolid()));
+    out.Put(scale.xx());
+    out.Put(scale.yy());
+    out.Put(scale.zz());
+  }
+  else if(type == "G4MultiUnion")
+  {
+    auto munion = static_cast<const G4MultiUnion*>(solid);
+    out.Put<std::uint8_t>(kMultiUnion);
+    out.PutString(solid->GetName());
+    out.PutIndex(munion->GetNumberOfSolids());
+    for(G4int i = 0; i < munion->GetNumberOfSolids(); ++i)
+    {
+      out.PutIndex(fSolidIndex.at(munion->GetSolid(i)));
+      out.PutTransform(munion->GetTransformation(i));
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteVolumes(Output& out) const
+{
+  const G4Track track;
+  out.PutIndex(fUserLimits.size());
+  for(auto limits : fUserLimits)
+  {
+    auto ulimits = const_cast<G4UserLimits*>(limits);
+    out.PutString(limits->GetType());
+    out.Put(ulimits->GetMaxAllowedStep(track));
+    out.Put(ulimits->GetUserMaxTrackLength(track));
+    out.Put(ulimits->GetUserMaxTime(track));
+    out.Put(ulimits->GetUserMinEkine(track));
+    out.Put(ulimits->GetUserMinRange(track));
+  }
+
+  out.PutIndex(fVolumes.size());
+  for(auto lvol : fVolumes)
+  {
+    out.PutString(lvol->GetName());
+    out.PutIndex(fSolidIndex.at(lvol->GetSolid()));
+    out.PutIndex(fMaterialIndex.at(lvol->GetMaterial()));
+    out.PutIndex(IndexOf<G4UserLimits>(fUserLimitsIndex,
+                                       lvol->GetUserLimits()));
+  }
+
+  // The world volume comes first and has no mother volume
+  //
+  out.PutIndex(fPhysVolumes.size());
+  for(auto pvol : fPhysVolumes)
+  {
+    const G4LogicalVolume* mother = pvol->GetMotherLogical();
+    if(typeid(*pvol) == typeid(G4PVReplica))
+    {
+      EAxis axis;
+      G4int nReplicas;
+      G4double width, offset;
+      G4bool consuming;
+      pvol->GetReplicationData(axis, nReplicas, width, offset, consuming);
+      out.Put<std::uint8_t>(kPVReplica);
+      out.PutString(pvol->GetName());
+      out.PutIndex(fVolumeIndex.at(pvol->GetLogicalVolume()));
+      out.PutIndex(fVolumeIndex.at(mother));
+      out.Put<std::int32_t>(axis);
+      out.Put<std::int32_t>(nReplicas);
+      out.Put(width);
+      out.Put(offset);
+    }
+    else if(typeid(*pvol) == typeid(G4PVDivision))
+    {
+      // Recreated from the parameters given by the user, the number of
+      // divisions or the width being otherwise computed
+      //
+      EAxis axis;
+      G4int nDivisions;
+      G4double width, offset;
+      G4bool consuming;
+      pvol->GetReplicationData(axis, nDivisions, width, offset, consuming);
+      auto division = static_cast<const G4VDivisionParameterisation*>(
+        pvol->GetParameterisation());
+      out.Put<std::uint8_t>(kPVDivision);
+      out.PutString(pvol->GetName());
+      out.PutIndex(fVolumeIndex.at(pvol->GetLogicalVolume()));
+      out.PutIndex(fVolumeIndex.at(mother));
+      out.Put<std::int32_t>(
+        static_cast<const G4PVDivision*>(pvol)->GetDivisionAxis());
+      out.Put<std::int32_t>(division->GetDivisionType());
+      out.Put<std::int32_t>(nDivisions);
+      out.Put(width);
+      out.Put(offset);
+    }
+    else if(typeid(*pvol) == typeid(G4PVParameterised))
+    {
+      auto param =
+        static_cast<G4GDMLParameterisation*>(pvol->GetParameterisation());
+      out.Put<std::uint8_t>(kPVParameterised);
+      out.PutString(pvol->GetName());
+      out.PutIndex(fVolumeIndex.at(pvol->GetLogicalVolume()));
+      out.PutIndex(fVolumeIndex.at(mother));
+      out.Put<std::int32_t>(pvol->GetMultiplicity());
+      out.PutIndex(param->GetSize());
+      for(G4int i = 0; i < param->GetSize(); ++i)
+      {
+        const auto& parameter = param->GetParameter(i);
+        out.Put<std::uint8_t>((parameter.pRot != nullptr) ? 1 : 0);
+        if(parameter.pRot != nullptr)
+        {
+          out.PutRotation(*parameter.pRot);
+        }
+        out.PutVector(parameter.position);
+        out.PutDoubles(parameter.dimension, std::size(parameter.dimension));
+      }
+    }
+    else
+    {
+      const G4RotationMatrix* rotation = pvol->GetRotation();
+      out.Put<std::uint8_t>(kPVPlacement);
+      out.PutString(pvol->GetName());
+      out.PutIndex(fVolumeIndex.at(pvol->GetLogicalVolume()));
+      out.PutIndex((mother != nullptr) ? fVolumeIndex.at(mother) : -1);
+      out.Put<std::int32_t>(pvol->GetCopyNo());
+      out.Put<std::uint8_t>((rotation != nullptr) ? 1 : 0);
+      if(rotation != nullptr)
+      {
+        out.PutRotation(*rotation);
+      }
+      out.PutVector(pvol->GetTranslation());
+    }
+  }
+
+  out.PutIndex(fRegions.size());
+  for(auto region : fRegions)
+  {
+    std::vector<std::size_t> roots;
+    auto pos = const_cast<G4Region*>(region)->GetRootLogicalVolumeIterator();
+    for(std::size_t i = 0; i < region->GetNumberOfRootVolumes(); ++i, ++pos)
+    {
+      const G4int index = IndexOf<G4LogicalVolume>(fVolumeIndex, *pos);
+      if(index >= 0) { roots.push_back(index); }
+    }
+    const G4ProductionCuts* cuts = region->GetProductionCuts();
+    out.PutString(region->GetName());
+    out.PutIndex(IndexOf<G4UserLimits>(fUserLimitsIndex,
+                                       region->GetUserLimits()));
+    out.Put<std::uint8_t>((cuts != nullptr) ? 1 : 0);
+    if(cuts != nullptr)
+    {
+      for(G4int i = 0; i < NumberOfG4CutIndex; ++i)
+      {
+        out.Put(cuts->GetProductionCut(i));
+      }
+    }
+    out.PutIndex(roots.size());
+    for(auto index : roots)
+    {
+      out.PutIndex(index);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteSurfaces(Output& out) const
+{
+  out.PutIndex(fOpticalSurfaces.size());
+  for(auto optical : fOpticalSurfaces)
+  {
+    out.PutString(optical->GetName());
+    out.Put<std::int32_t>(optical->GetModel());
+    out.Put<std::int32_t>(optical->GetFinish());
+    out.Put<std::int32_t>(optical->GetType());
+    out.Put(optical->GetSigmaAlpha());
+    out.Put(optical->GetPolish());
+    WriteProperties(out, optical->GetMaterialPropertiesTable());
+  }
+
+  std::vector<const G4LogicalBorderSurface*> borders;
+  std::vector<const G4LogicalSkinSurface*> skins;
+  for(const auto& pos : *G4LogicalBorderSurface::GetSurfaceTable())
+  {
+    if(IndexOf(fPhysVolumeIndex, pos.second->GetVolume1()) >= 0
+       && IndexOf(fPhysVolumeIndex, pos.second->GetVolume2()) >= 0)
+    {
+      borders.push_back(pos.second);
+    }
+  }
+  out.PutIndex(borders.size());
+  for(auto border : borders)
+  {
+    auto optical =
+      static_cast<const G4OpticalSurface*>(border->GetSurfaceProperty());
+    out.PutString(border->GetName());
+    out.PutIndex(fPhysVolumeIndex.at(border->GetVolume1()));
+    out.PutIndex(fPhysVolumeIndex.at(border->GetVolume2()));
+    out.PutIndex(fOpticalSurfaceIndex.at(optical));
+  }
+
+  for(auto skin : *G4LogicalSkinSurface::GetSurfaceTable())
+  {
+    if(IndexOf(fVolumeIndex, skin->GetLogicalVolume()) >= 0)
+    {
+      skins.push_back(skin);
+    }
+  }
+  out.PutIndex(skins.size());
+  for(auto skin : skins)
+  {
+    auto optical =
+      static_cast<const G4OpticalSurface*>(skin->GetSurfaceProperty());
+    out.PutString(skin->GetName());
+    out.PutIndex(fVolumeIndex.at(skin->GetLogicalVolume()));
+    out.PutIndex(fOpticalSurfaceIndex.at(optical));
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteReaderData(Output& out,
+                                        const G4GDMLReaderData& data) const
+{
+  for(auto values : { &data.constants, &data.variables, &data.quantities })
+  {
+    out.PutIndex(values->size());
+    for(const auto& value : *values)
+    {
+      out.PutString(value.first);
+      out.Put(value.second);
+    }
+  }
+  for(auto vectors : { &data.positions, &data.rotations, &data.scales })
+  {
+    out.PutIndex(vectors->size());
+    for(const auto& vector : *vectors)
+    {
+      out.PutString(vector.first);
+      out.PutVector(vector.second);
+    }
+  }
+  out.PutIndex(data.matrices.size());
+  for(const auto& matrix : data.matrices)
+  {
+    out.PutString(matrix.first);
+    out.PutIndex(matrix.second.first);
+    out.PutDoubles(matrix.second.second.data(), matrix.second.second.size());
+  }
+
+  // Auxiliary information of volumes not in the tree is dropped
+  //
+  std::vector<std::pair<G4int, const G4GDMLAuxListType*>> volumes;
+  for(const auto& aux : data.volumeAuxiliaries)
+  {
+    const G4int index = IndexOf<G4LogicalVolume>(fVolumeIndex, aux.first);
+    if(index >= 0) { volumes.emplace_back(index, &aux.second); }
+  }
+  out.PutIndex(volumes.size());
+  for(const auto& aux : volumes)
+  {
+    out.PutIndex(aux.first);
+    WriteAuxiliaries(out, *aux.second);
+  }
+  WriteAuxiliaries(out, data.auxiliaries);
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::WriteAuxiliaries(Output& out,
+                                         const G4GDMLAuxListType& list) const
+{
+  out.PutIndex(list.size());
+  for(const auto& aux : list)
+  {
+    out.PutString(aux.type);
+    out.PutString(aux.value);
+    out.PutString(aux.unit);
+    out.Put<std::uint8_t>((aux.auxList != nullptr) ? 1 : 0);
+    if(aux.auxList != nullptr)
+    {
+      WriteAuxiliaries(out, *aux.auxList);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+G4VPhysicalVolume* G4GDMLBinaryCache::Read(const G4String& filename,
+                                           std::uint64_t sourceHash,
+                                           G4GDMLReaderData* readerData)
+{
+  Clear();
+
+  const char* data = nullptr;
+  std::size_t size = 0;
+#ifndef WIN32
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return nullptr;
+  }
+  struct stat status;
+  void* map = MAP_FAILED;
+  if(::fstat(fd, &status) == 0 && status.st_size > 0)
+  {
+    size = (std::size_t)status.st_size;
+    map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd);
+  if(map == MAP_FAILED)
+  {
+    return nullptr;
+  }
+  data = static_cast<const char*>(map);
+#else
+  std::ifstream file(filename, std::ios::binary);
+  if(!file)
+  {
+    return nullptr;
+  }
+  std::vector<char> buffer((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+  data = buffer.data();
+  size = buffer.size();
+#endif
+
+  G4VPhysicalVolume* world =
+    Load(data, size, sourceHash, filename, readerData);
+
+#ifndef WIN32
+  ::munmap(map, size);
+#endif
+  return world;
+}
+
+// --------------------------------------------------------------------
+G4VPhysicalVolume* G4GDMLBinaryCache::Load(const char* data, std::size_t size,
+                                           std::uint64_t sourceHash,
+                                           const G4String& filename,
+                                           G4GDMLReaderData* readerData)
+{
+  // Validate the header and the payload before creating anything
+  //
+  G4String problem;
+  Input header(data, data + std::min(size, kHeaderSize));
+  char magic[sizeof(kMagic)] = { 0 };
+  header.GetBytes(magic, sizeof(magic));
+  const auto version = header.Get<std::uint32_t>();
+  const auto byteOrder = header.Get<std::uint32_t>();
+  const auto hash = header.Get<std::uint64_t>();
+  const auto payloadSize = header.Get<std::uint64_t>();
+  const auto payloadHash = header.Get<std::uint64_t>();
+  if(header.Failed() || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+  {
+    problem = "not a binary geometry cache";
+  }
+  else if(version != kVersion || byteOrder != kByteOrder)
+  {
+    problem = "written with an incompatible format";
+  }
+  else if(hash != sourceHash)
+  {
+    problem = "GDML source changed since the cache was written";
+  }
+  else if(payloadSize != size - kHeaderSize
+          || payloadHash != Hash(data + kHeaderSize, size - kHeaderSize))
+  {
+    problem = "file is damaged";
+  }
+  if(!problem.empty())
+  {
+    G4String message = "Binary cache " + filename + " ignored: " + problem;
+    G4Exception("G4GDMLBinaryCache::Read()", "InvalidRead", JustWarning,
+                message);
+    return nullptr;
+  }
+
+  Input in(data + kHeaderSize, data + size);
+  ReadMaterials(in);
+  const std::size_t nSolids = in.GetCount();
+  for(std::size_t i = 0; i < nSolids && !in.Failed(); ++i)
+  {
+    fReadSolids.push_back(ReadSolid(in));
+  }
+  ReadVolumes(in);
+  ReadSurfaces(in);
+  std::istringstream estimates(in.GetString());
+  G4GDMLReaderData definitions;
+  if(in.Get<std::uint8_t>() != 0)
+  {
+    ReadReaderData(in, definitions);
+  }
+  if(in.Failed() || !in.AtEnd() || fReadPhysVolumes.empty())
+  {
+    G4String message = "Inconsistent content in binary cache " + filename;
+    G4Exception("G4GDMLBinaryCache::Read()", "InvalidRead", FatalException,
+                message);
+    return nullptr;
+  }
+  G4SolidPropertiesCache::GetInstance()->Retrieve(estimates);
+  if(readerData != nullptr)
+  {
+    *readerData = std::move(definitions);
+  }
+
+  G4cout << "G4GDML: Binary cache read: " << filename << " ("
+         << fReadSolids.size() << " solids, " << fReadVolumes.size()
+         << " logical and " << fReadPhysVolumes.size()
+         << " physical volumes)" << G4endl;
+  return fReadPhysVolumes[0];
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::ReadMaterials(Input& in)
+{
+  const std::size_t nIsotopes = in.GetCount();
+  for(std::size_t i = 0; i < nIsotopes && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const auto z = in.Get<std::int32_t>();
+    const auto n = in.Get<std::int32_t>();
+    const G4double a = in.GetDouble();
+    const auto m = in.Get<std::int32_t>();
+    G4Isotope* isotope = G4Isotope::GetIsotope(name);
+    if(isotope == nullptr && !in.Failed())
+    {
+      isotope = new G4Isotope(name, z, n, a, m);
+    }
+    fReadIsotopes.push_back(isotope);
+  }
+
+  // Elements are shared with the NIST manager when they are its own,
+  // so that they are not duplicated by NIST materials built later
+  //
+  G4NistManager* nist = G4NistManager::Instance();
+  const std::size_t nElements = in.GetCount();
+  for(std::size_t i = 0; i < nElements && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4String symbol = in.GetString();
+    const G4double z = in.GetDouble();
+    const G4double a = in.GetDouble();
+    const G4bool natural = (in.Get<std::uint8_t>() != 0);
+    std::vector<std::pair<G4int, G4double>> isotopes;
+    if(!natural)
+    {
+      const std::size_t n = in.GetCount();
+      for(std::size_t j = 0; j < n && !in.Failed(); ++j)
+      {
+        const G4int index = in.GetIndex(fReadIsotopes.size());
+        isotopes.emplace_back(index, in.GetDouble());
+      }
+    }
+    if(in.Failed())
+    {
+      return;
+    }
+    G4Element* element = G4Element::GetElement(name, false);
+    if(element == nullptr && natural && name == symbol)
+    {
+      element = nist->FindOrBuildElement(symbol);
+    }
+    if(element == nullptr && natural)
+    {
+      element = new G4Element(name, symbol, z, a);
+    }
+    else if(element == nullptr)
+    {
+      element = new G4Element(name, symbol, (G4int)isotopes.size());
+      for(const auto& isotope : isotopes)
+      {
+        element->AddIsotope(fReadIsotopes[isotope.first], isotope.second);
+      }
+    }
+    fReadElements.push_back(element);
+  }
+
+  const std::size_t nMaterials = in.GetCount();
+  for(std::size_t i = 0; i < nMaterials && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4String formula = in.GetString();
+    const G4double density = in.GetDouble();
+    const auto state = (G4State)in.Get<std::int32_t>();
+    const G4double temperature = in.GetDouble();
+    const G4double pressure = in.GetDouble();
+    const G4bool byAtoms = (in.Get<std::uint8_t>() != 0);
+    const std::size_t n = in.GetCount();
+    std::vector<G4int> elements(n), atoms(n);
+    std::vector<G4double> fractions(n);
+    for(std::size_t j = 0; j < n && !in.Failed(); ++j)
+    {
+      elements[j] = in.GetIndex(fReadElements.size());
+      if(byAtoms)
+      {
+        atoms[j] = in.Get<std::int32_t>();
+      }
+      else
+      {
+        fractions[j] = in.GetDouble();
+      }
+    }
+    const G4double excitationEnergy = in.GetDouble();
+    G4MaterialPropertiesTable* properties = ReadProperties(in);
+    if(in.Failed())
+    {
+      delete properties;
+      return;
+    }
+
+    G4Material* material = G4Material::GetMaterial(name, false);
+    if(material == nullptr && G4StrUtil::starts_with(name, "G4_"))
+    {
+      material = nist->FindOrBuildMaterial(name);
+    }
+    if(material == nullptr)
+    {
+      material = new G4Material(name, density, (G4int)n, state,
+                                temperature, pressure);
+      for(std::size_t j = 0; j < n; ++j)
+      {
+        if(byAtoms)
+        {
+          material->AddElement(fReadElements[elements[j]], atoms[j]);
+        }
+        else
+        {
+          material->AddElement(fReadElements[elements[j]], fractions[j]);
+        }
+      }
+      if(!formula.empty())
+      {
+        material->SetChemicalFormula(formula);
+      }
+      if(excitationEnergy !=
+         material->GetIonisation()->GetMeanExcitationEnergy())
+      {
+        material->GetIonisation()->SetMeanExcitationEnergy(excitationEnergy);
+      }
+      if(properties != nullptr)
+      {
+        material->SetMaterialPropertiesTable(properties);
+        properties = nullptr;
+      }
+    }
+    delete properties;
+    fReadMaterials.push_back(material);
+  }
+}
+
+// --------------------------------------------------------------------
+G4MaterialPropertiesTable* G4GDMLBinaryCache::ReadProperties(Input& in) const
+{
+  if(in.Get<std::uint8_t>() == 0)
+  {
+    return nullptr;
+  }
+  auto table = new G4MaterialPropertiesTable();
+  const std::size_t nProperties = in.GetCount();
+  for(std::size_t i = 0; i < nProperties && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4bool spline = (in.Get<std::uint8_t>() != 0);
+    const std::vector<G4double> energies = in.GetDoubles();
+    const std::vector<G4double> values = in.GetDoubles();
+    if(!in.Failed() && energies.size() == values.size())
+    {
+      table->AddProperty(name,
+        new G4MaterialPropertyVector(energies, values, spline), true);
+    }
+  }
+  const std::size_t nConstProperties = in.GetCount();
+  for(std::size_t i = 0; i < nConstProperties && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    table->AddConstProperty(name, in.GetDouble(), true);
+  }
+  return table;
+}
+
+// --------------------------------------------------------------------
+G4VSolid* G4GDMLBinaryCache::ReadSolid(Input& in) const
+{
+  const auto code = in.Get<std::uint8_t>();
+  const G4String name = in.GetString();
+
+  // Parameters of all solids are read first, then the solid is created
+  // only if the whole record could be read
+  //
+  std::vector<G4double> p;
+  auto get = [&in, &p](std::size_t n)
+  {
+    for(std::size_t i = 0; i < n; ++i) { p.push_back(in.GetDouble()); }
+  };
+  auto solidAt = [&in, this]()
+  {
+    const G4int index = in.GetIndex(fReadSolids.size());
+    return (index >= 0) ? fReadSolids[index] : nullptr;
+  };
+
+  G4VSolid* solid = nullptr;
+  switch(code)
+  {
+    case kBox:
+      get(3);
+      if(in.Failed()) { break; }
+      solid = new G4Box(name, p[0], p[1], p[2]);
+      break;
+    case kCons:
+      get(7);
+      if(in.Failed()) { break; }
+      solid = new G4Cons(name, p[0], p[1], p[2], p[3], p[4], p[5], p[6]);
+      break;
+    case kCutTubs:
+    {
+      get(5);
+      const G4ThreeVector low = in.GetVector();
+      const G4ThreeVector high = in.GetVector();
+      if(in.Failed()) { break; }
+      solid = new G4CutTubs(name, p[0], p[1], p[2], p[3], p[4], low, high);
+      break;
+    }
+    case kOrb:
+      get(1);
+      if(in.Failed()) { break; }
+      solid = new G4Orb(name, p[0]);
+      break;
+    case kPara:
+      get(6);
+      if(in.Failed()) { break; }
+      solid = new G4Para(name, p[0], p[1], p[2], p[3], p[4], p[5]);
+      break;
+    case kSphere:
+      get(6);
+      if(in.Failed()) { break; }
+      solid = new G4Sphere(name, p[0], p[1], p[2], p[3], p[4], p[5]);
+      break;
+    case kTorus:
+      get(5);
+      if(in.Failed()) { break; }
+      solid = new G4Torus(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case kTrap:
+      get(11);
+      if(in.Failed()) { break; }
+      solid = new G4Trap(name, p[0], p[1], p[2], p[3], p[4], p[5], p[6],
+                         p[7], p[8], p[9], p[10]);
+      break;
+    case kTrd:
+      get(5);
+      if(in.Failed()) { break; }
+      solid = new G4Trd(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case kTubs:
+      get(5);
+      if(in.Failed()) { break; }
+      solid = new G4Tubs(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case kEllipsoid:
+      get(5);
+      if(in.Failed()) { break; }
+      solid = new G4Ellipsoid(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case kEllipticalCone:
+      get(4);
+      if(in.Failed()) { break; }
+      solid = new G4EllipticalCone(name, p[0], p[1], p[2], p[3]);
+      break;
+    case kEllipticalTube:
+      get(3);
+      if(in.Failed()) { break; }
+      solid = new G4EllipticalTube(name, p[0], p[1], p[2]);
+      break;
+    case kExtruded:
+    {
+      std::vector<G4TwoVector> polygon(in.GetCount(2 * sizeof(G4double)));
+      for(auto& vertex : polygon)
+      {
+        const G4double x = in.GetDouble();
+        vertex.set(x, in.GetDouble());
+      }
+      std::vector<G4ExtrudedSolid::ZSection> sections;
+      const std::size_t n = in.GetCount(4 * sizeof(G4double));
+      for(std::size_t i = 0; i < n; ++i)
+      {
+        const G4double z = in.GetDouble();
+        const G4double x0 = in.GetDouble();
+        const G4double y0 = in.GetDouble();
+        sections.emplace_back(z, G4TwoVector(x0, y0), in.GetDouble());
+      }
+      if(in.Failed()) { break; }
+      solid = new G4ExtrudedSolid(name, polygon, sections);
+      break;
+    }
+    case kGenericPolycone:
+    {
+      get(2);
+      const std::vector<G4double> r = in.GetDoubles();
+      const std::vector<G4double> z = in.GetDoubles();
+      if(in.Failed() || r.size() != z.size()) { break; }
+      solid = new G4GenericPolycone(name, p[0], p[1], (G4int)r.size(),
+                                    r.data(), z.data());
+      break;
+    }
+    case kGenericTrap:
+    {
+      get(1);
+      std::vector<G4TwoVector> vertices(8);
+      for(auto& vertex : vertices)
+      {
+        const G4double x = in.GetDouble();
+        vertex.set(x, in.GetDouble());
+      }
+      if(in.Failed()) { break; }
+      solid = new G4GenericTrap(name, p[0], vertices);
+      break;
+    }
+    case kHype:
+      get(5);
+      if(in.Failed()) { break; }
+      solid = new G4Hype(name, p[0], p[1], p[2], p[3], p[4]);
+      break;
+    case kParaboloid:
+      get(3);
+      if(in.Failed()) { break; }
+      solid = new G4Paraboloid(name, p[0], p[1], p[2]);
+      break;
+    case kPolycone:
+    {
+      get(2);
+      const std::vector<G4double> z = in.GetDoubles();
+      const std::vector<G4double> rmin = in.GetDoubles();
+      const std::vector<G4double> rmax = in.GetDoubles();
+      if(in.Failed() || z.size() != rmin.size() || z.size() != rmax.size())
+      {
+        break;
+      }
+      solid = new G4Polycone(name, p[0], p[1], (G4int)z.size(), z.data(),
+                             rmin.data(), rmax.data());
+      break;
+    }
+    case kPolyhedra:
+    {
+      get(2);
+      const auto numSide = in.Get<std::int32_t>();
+      const std::vector<G4double> z = in.GetDoubles();
+      const std::vector<G4double> rmin = in.GetDoubles();
+      const std::vector<G4double> rmax = in.GetDoubles();
+      if(in.Failed() || z.size() != rmin.size() || z.size() != rmax.size())
+      {
+        break;
+      }
+      solid = new G4Polyhedra(name, p[0], p[1], numSide, (G4int)z.size(),
+                              z.data(), rmin.data(), rmax.data());
+      break;
+    }
+    case kGenericPolyhedra:
+    {
+      get(2);
+      const auto numSide = in.Get<std::int32_t>();
+      const std::vector<G4double> r = in.GetDoubles();
+      const std::vector<G4double> z = in.GetDoubles();
+      if(in.Failed() || r.size() != z.size()) { break; }
+      solid = new G4Polyhedra(name, p[0], p[1], numSide, (G4int)r.size(),
+                              r.data(), z.data());
+      break;
+    }
+    case kTessellated:
+    {
+      const std::size_t nFacets = in.GetCount(1 + 3 * 3 * sizeof(G4double));
+      std::vector<G4VFacet*> facets;
+      facets.reserve(nFacets);
+      for(std::size_t i = 0; i < nFacets && !in.Failed(); ++i)
+      {
+        const auto nVertices = in.Get<std::uint8_t>();
+        G4ThreeVector v[4];
+        for(std::size_t j = 0; j < nVertices && j < 4; ++j)
+        {
+          v[j] = in.GetVector();
+        }
+        if(nVertices == 3)
+        {
+          facets.push_back(new G4TriangularFacet(v[0], v[1], v[2], ABSOLUTE));
+        }
+        else if(nVertices == 4)
+        {
+          facets.push_back(
+            new G4QuadrangularFacet(v[0], v[1], v[2], v[3], ABSOLUTE));
+        }
+        else
+        {
+          in.Fail();
+        }
+      }
+      if(in.Failed())
+      {
+        for(auto facet : facets) { delete facet; }
+        break;
+      }
+      auto tess = new G4TessellatedSolid(name);
+      for(auto facet : facets)
+      {
+        tess->AddFacet(facet);
+      }
+      tess->SetSolidClosed(true);
+      solid = tess;
+      break;
+    }
+    case kTet:
+    {
+      const G4ThreeVector v1 = in.GetVector();
+      const G4ThreeVector v2 = in.GetVector();
+      const G4ThreeVector v3 = in.GetVector();
+      const G4ThreeVector v4 = in.GetVector();
+      if(in.Failed()) { break; }
+      solid = new G4Tet(name, v1, v2, v3, v4);
+      break;
+    }
+    case kTwistedBox:
+      get(4);
+      if(in.Failed()) { break; }
+      solid = new G4TwistedBox(name, p[0], p[1], p[2], p[3]);
+      break;
+    case kTwistedTrap:
+      get(11);
+      if(in.Failed()) { break; }
+      solid = new G4TwistedTrap(name, p[0], p[1], p[2], p[3], p[4], p[5],
+                                p[6], p[7], p[8], p[9], p[10]);
+      break;
+    case kTwistedTrd:
+      get(6);
+      if(in.Failed()) { break; }
+      solid = new G4TwistedTrd(name, p[0], p[1], p[2], p[3], p[4], p[5]);
+      break;
+    case kTwistedTubs:
+      get(6);
+      if(in.Failed()) { break; }
+      solid = new G4TwistedTubs(name, p[0], p[1], p[2], p[3], p[4], p[5]);
+      break;
+    case kUnion:
+    case kSubtraction:
+    case kIntersection:
+    {
+      G4VSolid* first = solidAt();
+      G4VSolid* second = solidAt();
+      if(in.Failed()) { break; }
+      if(code == kUnion)
+      {
+        solid = new G4UnionSolid(name, first, second);
+      }
+      else if(code == kSubtraction)
+      {
+        solid = new G4SubtractionSolid(name, first, second);
+      }
+      else
+      {
+        solid = new G4IntersectionSolid(name, first, second);
+      }
+      break;
+    }
+    case kDisplaced:
+    {
+      G4VSolid* moved = solidAt();
+      const G4RotationMatrix rotation = in.GetRotation();
+      const G4ThreeVector translation = in.GetVector();
+      if(in.Failed()) { break; }
+      solid = new G4DisplacedSolid(name, moved,
+                                   G4AffineTransform(rotation, translation));
+      break;
+    }
+    case kReflected:
+    {
+      G4VSolid* moved = solidAt();
+      const G4Transform3D transform = in.GetTransform();
+      if(in.Failed()) { break; }
+      solid = new G4ReflectedSolid(name, moved, transform);
+      break;
+    }
+    case kScaled:
+    {
+      G4VSolid* unscaled = solidAt();
+      get(3);
+      if(in.Failed()) { break; }
+      solid = new G4ScaledSolid(name, unscaled, G4Scale3D(p[0], p[1], p[2]));
+      break;
+    }
+    case kMultiUnion:
+    {
+      const std::size_t n = in.GetCount();
+      auto munion = new G4MultiUnion(name);
+      for(std::size_t i = 0; i < n && !in.Failed(); ++i)
+      {
+        G4VSolid* node = solidAt();
+        const G4Transform3D transform = in.GetTransform();
+        if(!in.Failed()) { munion->AddNode(node, transform); }
+      }
+      munion->Voxelize();
+      solid = munion;
+      break;
+    }
+    default:
+      in.Fail();
+      break;
+  }
+  return solid;
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::ReadVolumes(Input& in)
+{
+  const std::size_t nUserLimits = in.GetCount();
+  for(std::size_t i = 0; i < nUserLimits && !in.Failed(); ++i)
+  {
+    const G4String type = in.GetString();
+    const G4double stepMax = in.GetDouble();
+    const G4double trackMax = in.GetDouble();
+    const G4double timeMax = in.GetDouble();
+    const G4double ekinMin = in.GetDouble();
+    const G4double rangeMin = in.GetDouble();
+    if(in.Failed())
+    {
+      return;
+    }
+    fReadUserLimits.push_back(new G4UserLimits(type, stepMax, trackMax,
+                                               timeMax, ekinMin, rangeMin));
+  }
+
+  const std::size_t nVolumes = in.GetCount();
+  for(std::size_t i = 0; i < nVolumes && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4int solid = in.GetIndex(fReadSolids.size());
+    const G4int material = in.GetIndex(fReadMaterials.size());
+    const G4int limits = in.GetIndex(fReadUserLimits.size(), true);
+    if(in.Failed())
+    {
+      return;
+    }
+    auto lvol = new G4LogicalVolume(fReadSolids[solid],
+                                    fReadMaterials[material], name);
+    if(limits >= 0)
+    {
+      lvol->SetUserLimits(fReadUserLimits[limits]);
+    }
+    fReadVolumes.push_back(lvol);
+  }
+
+  const std::size_t nPhysVolumes = in.GetCount();
+  for(std::size_t i = 0; i < nPhysVolumes && !in.Failed(); ++i)
+  {
+    const auto code = in.Get<std::uint8_t>();
+    const G4String name = in.GetString();
+    const G4int lvol = in.GetIndex(fReadVolumes.size());
+    const G4int mother = in.GetIndex(fReadVolumes.size(), i == 0);
+    G4VPhysicalVolume* pvol = nullptr;
+    if(code == kPVReplica)
+    {
+      const auto axis = (EAxis)in.Get<std::int32_t>();
+      const auto nReplicas = in.Get<std::int32_t>();
+      const G4double width = in.GetDouble();
+      const G4double offset = in.GetDouble();
+      if(in.Failed() || mother < 0)
+      {
+        return;
+      }
+      pvol = new G4PVReplica(name, fReadVolumes[lvol], fReadVolumes[mother],
+                             axis, nReplicas, width, offset);
+    }
+    else if(code == kPVDivision)
+    {
+      const auto axis = (EAxis)in.Get<std::int32_t>();
+      const auto type = (DivisionType)in.Get<std::int32_t>();
+      const auto nDivisions = in.Get<std::int32_t>();
+      const G4double width = in.GetDouble();
+      const G4double offset = in.GetDouble();
+      if(in.Failed() || mother < 0)
+      {
+        return;
+      }
+      if(type == DivNDIV)
+      {
+        pvol = new G4PVDivision(name, fReadVolumes[lvol], fReadVolumes[mother],
+                                axis, nDivisions, offset);
+      }
+      else if(type == DivWIDTH)
+      {
+        pvol = new G4PVDivision(name, fReadVolumes[lvol], fReadVolumes[mother],
+                                axis, width, offset);
+      }
+      else
+      {
+        pvol = new G4PVDivision(name, fReadVolumes[lvol], fReadVolumes[mother],
+                                axis, nDivisions, width, offset);
+      }
+    }
+    else if(code == kPVParameterised)
+    {
+      const auto nCopies = in.Get<std::int32_t>();
+      auto param = new G4GDMLParameterisation();
+      const std::size_t nParameters = in.GetCount();
+      for(std::size_t j = 0; j < nParameters && !in.Failed(); ++j)
+      {
+        G4GDMLParameterisation::PARAMETER parameter;
+        if(in.Get<std::uint8_t>() != 0)
+        {
+          parameter.pRot = new G4RotationMatrix(in.GetRotation());
+        }
+        parameter.position = in.GetVector();
+        const std::vector<G4double> dimension = in.GetDoubles();
+        if(dimension.size() != std::size(parameter.dimension))
+        {
+          in.Fail();
+        }
+        std::copy(dimension.cbegin(), dimension.cend(), parameter.dimension);
+        param->AddParameter(parameter);
+      }
+      if(in.Failed() || mother < 0)
+      {
+        return;
+      }
+      pvol = new G4PVParameterised(name, fReadVolumes[lvol],
+                                   fReadVolumes[mother], kUndefined, nCopies,
+                                   param, false);
+    }
+    else
+    {
+      const auto copyNo = in.Get<std::int32_t>();
+      G4RotationMatrix* rotation = nullptr;
+      if(in.Get<std::uint8_t>() != 0)
+      {
+        rotation = new G4RotationMatrix(in.GetRotation());
+      }
+      const G4ThreeVector translation = in.GetVector();
+      if(in.Failed() || code != kPVPlacement)
+      {
+        delete rotation;
+        return;
+      }
+      pvol = new G4PVPlacement(rotation, translation, fReadVolumes[lvol], name,
+                               (mother >= 0) ? fReadVolumes[mother] : nullptr,
+                               false, copyNo);
+    }
+    fReadPhysVolumes.push_back(pvol);
+  }
+
+  G4RegionStore* store = G4RegionStore::GetInstance();
+  const std::size_t nRegions = in.GetCount();
+  for(std::size_t i = 0; i < nRegions && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4int limits = in.GetIndex(fReadUserLimits.size(), true);
+    const G4bool hasCuts = (in.Get<std::uint8_t>() != 0);
+    std::vector<G4double> cuts;
+    if(hasCuts)
+    {
+      for(G4int j = 0; j < NumberOfG4CutIndex; ++j)
+      {
+        cuts.push_back(in.GetDouble());
+      }
+    }
+    std::vector<G4int> roots(in.GetCount(sizeof(std::int32_t)));
+    for(auto& root : roots)
+    {
+      root = in.GetIndex(fReadVolumes.size());
+    }
+    if(in.Failed())
+    {
+      return;
+    }
+    G4Region* region = store->GetRegion(name, false);
+    if(region == nullptr)
+    {
+      region = new G4Region(name);
+    }
+    if(hasCuts)
+    {
+      auto productionCuts = new G4ProductionCuts();
+      productionCuts->SetProductionCuts(cuts);
+      region->SetProductionCuts(productionCuts);
+    }
+    if(limits >= 0)
+    {
+      region->SetUserLimits(fReadUserLimits[limits]);
+    }
+    for(auto root : roots)
+    {
+      region->AddRootLogicalVolume(fReadVolumes[root]);
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::ReadSurfaces(Input& in)
+{
+  const std::size_t nOptical = in.GetCount();
+  for(std::size_t i = 0; i < nOptical && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const auto model = (G4OpticalSurfaceModel)in.Get<std::int32_t>();
+    const auto finish = (G4OpticalSurfaceFinish)in.Get<std::int32_t>();
+    const auto type = (G4SurfaceType)in.Get<std::int32_t>();
+    const G4double sigmaAlpha = in.GetDouble();
+    const G4double polish = in.GetDouble();
+    G4MaterialPropertiesTable* properties = ReadProperties(in);
+    if(in.Failed())
+    {
+      delete properties;
+      return;
+    }
+    auto optical = new G4OpticalSurface(name, model, finish, type);
+    optical->SetSigmaAlpha(sigmaAlpha);
+    optical->SetPolish(polish);
+    optical->SetMaterialPropertiesTable(properties);
+    fReadOpticalSurfaces.push_back(optical);
+  }
+
+  const std::size_t nBorders = in.GetCount();
+  for(std::size_t i = 0; i < nBorders && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4int pvol1 = in.GetIndex(fReadPhysVolumes.size());
+    const G4int pvol2 = in.GetIndex(fReadPhysVolumes.size());
+    const G4int optical = in.GetIndex(fReadOpticalSurfaces.size());
+    if(in.Failed())
+    {
+      return;
+    }
+    new G4LogicalBorderSurface(name, fReadPhysVolumes[pvol1],
+                               fReadPhysVolumes[pvol2],
+                               fReadOpticalSurfaces[optical]);
+  }
+
+  const std::size_t nSkins = in.GetCount();
+  for(std::size_t i = 0; i < nSkins && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const G4int lvol = in.GetIndex(fReadVolumes.size());
+    const G4int optical = in.GetIndex(fReadOpticalSurfaces.size());
+    if(in.Failed())
+    {
+      return;
+    }
+    new G4LogicalSkinSurface(name, fReadVolumes[lvol],
+                             fReadOpticalSurfaces[optical]);
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::ReadReaderData(Input& in, G4GDMLReaderData& data) const
+{
+  for(auto values : { &data.constants, &data.variables, &data.quantities })
+  {
+    const std::size_t n = in.GetCount();
+    for(std::size_t i = 0; i < n && !in.Failed(); ++i)
+    {
+      const G4String name = in.GetString();
+      (*values)[name] = in.GetDouble();
+    }
+  }
+  for(auto vectors : { &data.positions, &data.rotations, &data.scales })
+  {
+    const std::size_t n = in.GetCount();
+    for(std::size_t i = 0; i < n && !in.Failed(); ++i)
+    {
+      const G4String name = in.GetString();
+      (*vectors)[name] = in.GetVector();
+    }
+  }
+  const std::size_t nMatrices = in.GetCount();
+  for(std::size_t i = 0; i < nMatrices && !in.Failed(); ++i)
+  {
+    const G4String name = in.GetString();
+    const std::size_t columns = in.GetCount();
+    std::vector<G4double> values = in.GetDoubles();
+    if(columns == 0 || values.size() % columns != 0)
+    {
+      in.Fail();
+      return;
+    }
+    data.matrices[name] = std::make_pair(columns, std::move(values));
+  }
+
+  const std::size_t nVolumes = in.GetCount();
+  for(std::size_t i = 0; i < nVolumes && !in.Failed(); ++i)
+  {
+    const G4int lvol = in.GetIndex(fReadVolumes.size());
+    if(in.Failed())
+    {
+      return;
+    }
+    ReadAuxiliaries(in, data.volumeAuxiliaries[fReadVolumes[lvol]]);
+  }
+  ReadAuxiliaries(in, data.auxiliaries);
+}
+
+// --------------------------------------------------------------------
+void G4GDMLBinaryCache::ReadAuxiliaries(Input& in,
+                                        G4GDMLAuxListType& list) const
+{
+  const std::size_t n = in.GetCount();
+  for(std::size_t i = 0; i < n && !in.Failed(); ++i)
+  {
+    G4GDMLAuxStructType aux;
+    aux.type = in.GetString();
+    aux.value = in.GetString();
+    aux.unit = in.GetString();
+    aux.auxList = nullptr;
+    if(in.Get<std::uint8_t>() != 0)
+    {
+      aux.auxList = new G4GDMLAuxListType;
+      ReadAuxiliaries(in, *aux.auxList);
+    }
+    list.push_back(aux);
+  }
+}
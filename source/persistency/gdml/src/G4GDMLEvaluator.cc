@@ -310,6 +310,12 @@ G4double G4GDMLEvaluator::GetVariable(const G4String& name)
   return Evaluate(name);
 }
 
+// --------------------------------------------------------------------
+const std::vector<G4String>& G4GDMLEvaluator::GetVariableList() const
+{
+  return variableList;
+}
+
 // --------------------------------------------------------------------
 G4String G4GDMLEvaluator::ConvertToString(G4int ival)
 {
@@ -83,6 +83,15 @@ G4GDMLMessenger::G4GDMLMessenger(G4GDMLParser* myPars)
   StripCmd->AvailableForStates(G4State_Idle);
   StripCmd->SetToBeBroadcasted(false);
 
+  StreamCmd = new G4UIcmdWithABool("/persistency/gdml/streaming", this);
+  StreamCmd->SetGuidance("Enable/disable streaming read of GDML files:");
+  StreamCmd->SetGuidance("elements are imported as soon as parsed, without");
+  StreamCmd->SetGuidance("building the tree of the whole document first.");
+  StreamCmd->SetParameterName("streaming", true);
+  StreamCmd->SetDefaultValue(true);
+  StreamCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  StreamCmd->SetToBeBroadcasted(false);
+
   AppendCmd = new G4UIcmdWithABool("/persistency/gdml/add_pointers", this);
   AppendCmd->SetGuidance("Enable/disable appending of pointers to names");
   AppendCmd->SetGuidance("when writing a GDML file.");
@@ -91,6 +100,15 @@ G4GDMLMessenger::G4GDMLMessenger(G4GDMLParser* myPars)
   AppendCmd->AvailableForStates(G4State_Idle);
   AppendCmd->SetToBeBroadcasted(false);
 
+  MeshCmd = new G4UIcmdWithABool("/persistency/gdml/binary_meshes", this);
+  MeshCmd->SetGuidance("Enable/disable writing of tessellated and tetrahedral");
+  MeshCmd->SetGuidance("solids' vertices to a binary mesh file attached to");
+  MeshCmd->SetGuidance("the GDML file, instead of as GDML positions.");
+  MeshCmd->SetParameterName("binary_meshes", true);
+  MeshCmd->SetDefaultValue(true);
+  MeshCmd->AvailableForStates(G4State_Idle);
+  MeshCmd->SetToBeBroadcasted(false);
+
   RegionCmd = new G4UIcmdWithABool("/persistency/gdml/export_regions", this);
   RegionCmd->SetGuidance("Enable export of geometrical regions");
   RegionCmd->SetGuidance("for storing production cuts.");
@@ -138,7 +156,9 @@ G4GDMLMessenger::~G4GDMLMessenger()
   delete persistencyDir;
   delete gdmlDir;
   delete StripCmd;
+  delete StreamCmd;
   delete AppendCmd;
+  delete MeshCmd;
 }
 
 // --------------------------------------------------------------------
@@ -150,12 +170,24 @@ void G4GDMLMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
     myParser->SetStripFlag(mode);
   }
 
+  if(command == StreamCmd)
+  {
+    G4bool mode = StreamCmd->GetNewBoolValue(newValue);
+    myParser->SetStreamingRead(mode);
+  }
+
   if(command == AppendCmd)
   {
     pFlag = AppendCmd->GetNewBoolValue(newValue);
     myParser->SetAddPointerToName(pFlag);
   }
 
+  if(command == MeshCmd)
+  {
+    G4bool mode = MeshCmd->GetNewBoolValue(newValue);
+    myParser->SetBinaryMeshes(mode);
+  }
+
   if(command == ReaderSchema)
   {
     myParser->SetImportSchema(newValue);
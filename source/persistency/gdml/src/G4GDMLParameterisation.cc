@@ -44,6 +44,13 @@ void G4GDMLParameterisation::AddParameter(const PARAMETER& newParameter)
   parameterList.push_back(newParameter);
 }
 
+// --------------------------------------------------------------------
+const G4GDMLParameterisation::PARAMETER&
+G4GDMLParameterisation::GetParameter(G4int index) const
+{
+  return parameterList[index];
+}
+
 // --------------------------------------------------------------------
 void G4GDMLParameterisation::ComputeTransformation(
   const G4int index, G4VPhysicalVolume* physvol) const
@@ -37,6 +37,7 @@
 #include "G4ProductionCuts.hh"
 #include "G4ReflectionFactory.hh"
 #include "G4Track.hh"
+#include "G4VisAttributes.hh"
 
 // --------------------------------------------------------------------
 G4GDMLParser::G4GDMLParser()
@@ -90,6 +91,71 @@ G4GDMLParser::~G4GDMLParser()
   delete messenger;
 }
 
+// --------------------------------------------------------------------
+G4bool G4GDMLParser::ReadBinaryCache(const G4String& cachename,
+                                     const G4String& filename)
+{
+  if(!G4Threading::IsMasterThread())
+  {
+    return false;
+  }
+  G4GDMLBinaryCache cache;
+  G4GDMLReaderData data;
+  G4VPhysicalVolume* world =
+    cache.Read(cachename, G4GDMLBinaryCache::SourceHash(filename), &data);
+  if(world == nullptr)
+  {
+    return false;
+  }
+
+  // Definitions and auxiliary information, so that they are available
+  // as after reading the GDML file
+  //
+  reader->ImportReaderData(data);
+  world->GetLogicalVolume()->SetVisAttributes(G4VisAttributes::GetInvisible());
+  cachedWorld = world;
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4GDMLParser::WriteBinaryCache(const G4String& cachename,
+                                      const G4String& filename,
+                                      const G4VPhysicalVolume* pvol)
+{
+  if(!G4Threading::IsMasterThread())
+  {
+    return false;
+  }
+  if(pvol == nullptr)
+  {
+    pvol = GetWorldVolume();
+  }
+  const std::uint64_t hash = G4GDMLBinaryCache::SourceHash(filename);
+  if(pvol == nullptr || hash == 0)
+  {
+    G4String error_msg = "No geometry or GDML source to cache for file: "
+                       + filename;
+    G4Exception("G4GDMLParser::WriteBinaryCache()", "InvalidSetup",
+                JustWarning, error_msg);
+    return false;
+  }
+  G4GDMLReaderData data;
+  reader->ExportReaderData(data);
+  G4GDMLBinaryCache cache;
+  return cache.Write(cachename, pvol, hash, &data);
+}
+
+// --------------------------------------------------------------------
+void G4GDMLParser::ReadWithCache(const G4String& filename,
+                                 const G4String& cachename, G4bool validate)
+{
+  if(G4Threading::IsMasterThread() && !ReadBinaryCache(cachename, filename))
+  {
+    Read(filename, validate);
+    WriteBinaryCache(cachename, filename);
+  }
+}
+
 // --------------------------------------------------------------------
 void G4GDMLParser::ImportRegions()
 {
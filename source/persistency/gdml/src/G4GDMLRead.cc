@@ -41,6 +41,155 @@
 #include "G4EnvironmentUtils.hh"
 #include "G4Exception.hh"
 
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  // Content handler for the streaming read: elements of the document are
+  // rebuilt as small DOM fragments, each made of a section of the document
+  // holding a single one of its elements, which is handed to the reader
+  // and released as soon as complete. Sections read by user code, setup
+  // and extensions, are instead handed as a whole
+  //
+  class G4GDMLStreamHandler : public xercesc::DefaultHandler
+  {
+    public:
+
+      using SectionReader =
+        std::function<void(const xercesc::DOMElement* const)>;
+
+      G4GDMLStreamHandler(SectionReader reader)
+        : fReader(std::move(reader))
+      {}
+
+      ~G4GDMLStreamHandler() override
+      {
+        if(fFragment != nullptr) { fFragment->release(); }
+        if(fSectionDoc != nullptr) { fSectionDoc->release(); }
+      }
+
+      G4bool HasRoot() const { return fHasRoot; }
+
+      void startElement(const XMLCh* const, const XMLCh* const,
+                        const XMLCh* const qname,
+                        const xercesc::Attributes& attributes) override
+      {
+        ++fDepth;
+        if(fDepth == 1)  // The <gdml> element
+        {
+          fHasRoot = true;
+          return;
+        }
+        if(fDepth == 2)
+        {
+          // Keep a copy of the section element and of its attributes,
+          // to which elements are attached as they are read
+          //
+          fSectionDoc = xercesc::DOMImplementation::getImplementation()
+                          ->createDocument();
+          fSection = CreateElement(fSectionDoc, qname, attributes);
+          fSectionDoc->appendChild(fSection);
+          fSectionRead = false;
+          char* tag = xercesc::XMLString::transcode(qname);
+          fStreamed = (std::strcmp(tag, "setup") != 0
+                       && std::strcmp(tag, "userinfo") != 0
+                       && std::strcmp(tag, "extension") != 0);
+          xercesc::XMLString::release(&tag);
+          fCurrent = fStreamed ? nullptr : fSection;
+          return;
+        }
+        if(fCurrent == nullptr)
+        {
+          fFragment = xercesc::DOMImplementation::getImplementation()
+                        ->createDocument();
+          fCurrent = fFragment->importNode(fSection, false);
+          fFragment->appendChild(fCurrent);
+        }
+        xercesc::DOMDocument* doc = fCurrent->getOwnerDocument();
+        fCurrent = fCurrent->appendChild(CreateElement(doc, qname, attributes));
+      }
+
+      void endElement(const XMLCh* const, const XMLCh* const,
+                      const XMLCh* const) override
+      {
+        if(fDepth == 3 && fStreamed)
+        {
+          fReader(static_cast<xercesc::DOMElement*>(fCurrent->getParentNode()));
+          fFragment->release();
+          fFragment = nullptr;
+          fCurrent = nullptr;
+          fSectionRead = true;
+        }
+        else if(fDepth == 2)
+        {
+          if(!fStreamed || !fSectionRead)  // Also empty sections
+          {
+            fReader(fSection);
+          }
+          fSectionDoc->release();
+          fSectionDoc = nullptr;
+          fSection = nullptr;
+          fCurrent = nullptr;
+        }
+        else if(fDepth > 2)
+        {
+          fCurrent = fCurrent->getParentNode();
+        }
+        --fDepth;
+      }
+
+      void characters(const XMLCh* const chars,
+                      const XMLSize_t length) override
+      {
+        // Text is only meaningful inside the elements of sections
+        //
+        if(fDepth < 3 || fCurrent == nullptr)
+        {
+          return;
+        }
+        std::vector<XMLCh> text(chars, chars + length);
+        text.push_back(0);
+        fCurrent->appendChild(
+          fCurrent->getOwnerDocument()->createTextNode(text.data()));
+      }
+
+    private:
+
+      xercesc::DOMElement* CreateElement(xercesc::DOMDocument* doc,
+                                         const XMLCh* const qname,
+                                         const xercesc::Attributes& attributes)
+      {
+        xercesc::DOMElement* element = doc->createElement(qname);
+        for(XMLSize_t i = 0; i < attributes.getLength(); ++i)
+        {
+          element->setAttribute(attributes.getQName(i),
+                                attributes.getValue(i));
+        }
+        return element;
+      }
+
+    private:
+
+      SectionReader fReader;
+      xercesc::DOMDocument* fSectionDoc = nullptr;
+      xercesc::DOMDocument* fFragment = nullptr;
+      xercesc::DOMElement* fSection = nullptr;
+      xercesc::DOMNode* fCurrent = nullptr;
+      G4int fDepth = 0;
+      G4bool fHasRoot = false;
+      G4bool fStreamed = true;
+      G4bool fSectionRead = false;
+  };
+}
+
 // --------------------------------------------------------------------
 G4GDMLRead::G4GDMLRead()
 {
@@ -68,6 +217,12 @@ void G4GDMLRead::OverlapCheck(G4bool flag)
   check = flag;
 }
 
+// --------------------------------------------------------------------
+void G4GDMLRead::SetStreaming(G4bool flag)
+{
+  streaming = flag;
+}
+
 // --------------------------------------------------------------------
 G4String G4GDMLRead::GenerateName(const G4String& nameIn, G4bool strip)
 {
@@ -450,6 +605,41 @@ void G4GDMLRead::Read(const G4String& fileName, G4bool validation,
   inLoop   = 0;
   validate = validation;
 
+  // Modules are read while reading the file including them
+  //
+  const G4String includingFile = currentFile;
+  currentFile = fileName;
+
+  if(streaming)
+  {
+    StreamRead(fileName);
+  }
+  else
+  {
+    DocumentRead(fileName);
+  }
+
+  currentFile = includingFile;
+
+  if(isModule)
+  {
+#ifdef G4VERBOSE
+    G4cout << "G4GDML: Reading module '" << fileName << "' done!" << G4endl;
+#endif
+  }
+  else
+  {
+    G4cout << "G4GDML: Reading '" << fileName << "' done!" << G4endl;
+    if(strip)
+    {
+      StripNames();
+    }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLRead::DocumentRead(const G4String& fileName)
+{
   xercesc::ErrorHandler* handler   = new G4GDMLErrorHandler(!validate);
   xercesc::XercesDOMParser* parser = new xercesc::XercesDOMParser;
 
@@ -539,60 +729,122 @@ void G4GDMLRead::Read(const G4String& fileName, G4bool validation,
                   "No child found!");
       return;
     }
-    const G4String tag = Transcode(child->getTagName());
+    SectionRead(child);
+  }
 
-    if(tag == "define")
-    {
-      DefineRead(child);
-    }
-    else if(tag == "materials")
-    {
-      MaterialsRead(child);
-    }
-    else if(tag == "solids")
-    {
-      SolidsRead(child);
-    }
-    else if(tag == "setup")
-    {
-      SetupRead(child);
-    }
-    else if(tag == "structure")
-    {
-      StructureRead(child);
-    }
-    else if(tag == "userinfo")
-    {
-      UserinfoRead(child);
-    }
-    else if(tag == "extension")
-    {
-      ExtensionRead(child);
-    }
-    else
+  delete parser;
+  delete handler;
+}
+
+// --------------------------------------------------------------------
+void G4GDMLRead::StreamRead(const G4String& fileName)
+{
+  G4GDMLErrorHandler handler(!validate);
+  G4GDMLStreamHandler content(
+    [this](const xercesc::DOMElement* const section) { SectionRead(section); });
+  xercesc::SAX2XMLReader* parser = xercesc::XMLReaderFactory::createXMLReader();
+  XMLCh* schemaLocation = nullptr;
+
+  parser->setFeature(xercesc::XMLUni::fgSAX2CoreValidation, validate);
+  parser->setFeature(xercesc::XMLUni::fgXercesDynamic, false);
+  if(validate)
+  {
+    // Alternative schema path, as for the import of the whole document
+    //
+    if(auto schemaPath = G4GetEnv<G4String>("G4GDML_SCHEMA_FILE", schema); schemaPath != "")
     {
-      G4String error_msg = "Unknown tag in gdml: " + tag;
-      G4Exception("G4GDMLRead::Read()", "InvalidRead", FatalException,
-                  error_msg);
+      if(parser->loadGrammar(schemaPath.c_str(), xercesc::Grammar::SchemaGrammarType, true) != nullptr)
+      {
+        G4cout << "G4GDML: Loaded alternative schema URI: " << schemaPath << G4endl;
+      }
+      else
+      {
+        G4Exception("G4GDMLRead::Read()",
+                    "InvalidGDMLSchemaFile",
+                    FatalException,
+                    G4String("Failed to load/parse schema file '" + schemaPath + "'").c_str());
+      }
+      parser->setFeature(xercesc::XMLUni::fgXercesUseCachedGrammarInParse, true);
+      schemaLocation = xercesc::XMLString::transcode(schemaPath.c_str());
+      parser->setProperty(
+        xercesc::XMLUni::fgXercesSchemaExternalNoNameSpaceSchemaLocation,
+        schemaLocation);
     }
   }
+  parser->setFeature(xercesc::XMLUni::fgXercesSchemaFullChecking, validate);
+  parser->setFeature(xercesc::XMLUni::fgSAX2CoreNameSpaces, true);
+  parser->setFeature(xercesc::XMLUni::fgXercesSchema, validate);
+  parser->setContentHandler(&content);
+  parser->setErrorHandler(&handler);
+
+  try
+  {
+    parser->parse(fileName.c_str());
+  } catch(const xercesc::XMLException& e)
+  {
+    G4cout << "G4GDML: " << Transcode(e.getMessage()) << G4endl;
+  } catch(const xercesc::SAXException& e)
+  {
+    G4cout << "G4GDML: " << Transcode(e.getMessage()) << G4endl;
+  } catch(const xercesc::DOMException& e)
+  {
+    G4cout << "G4GDML: " << Transcode(e.getMessage()) << G4endl;
+  }
 
   delete parser;
-  delete handler;
+  xercesc::XMLString::release(&schemaLocation);
 
-  if(isModule)
+  if(!content.HasRoot())
   {
-#ifdef G4VERBOSE
-    G4cout << "G4GDML: Reading module '" << fileName << "' done!" << G4endl;
-#endif
+    std::ostringstream message;
+    message << "ERROR - Unable to open document or empty document: "
+            << fileName << G4endl
+            << "        Check Internet connection is ON in case of schema"
+            << G4endl
+            << "        validation enabled and location defined as URL in"
+            << G4endl << "        the GDML file being imported!";
+    G4Exception("G4GDMLRead::Read()", "InvalidRead", FatalException, message);
+  }
+}
+
+// --------------------------------------------------------------------
+void G4GDMLRead::SectionRead(const xercesc::DOMElement* const element)
+{
+  const G4String tag = Transcode(element->getTagName());
+
+  if(tag == "define")
+  {
+    DefineRead(element);
+  }
+  else if(tag == "materials")
+  {
+    MaterialsRead(element);
+  }
+  else if(tag == "solids")
+  {
+    SolidsRead(element);
+  }
+  else if(tag == "setup")
+  {
+    SetupRead(element);
+  }
+  else if(tag == "structure")
+  {
+    StructureRead(element);
+  }
+  else if(tag == "userinfo")
+  {
+    UserinfoRead(element);
+  }
+  else if(tag == "extension")
+  {
+    ExtensionRead(element);
   }
   else
   {
-    G4cout << "G4GDML: Reading '" << fileName << "' done!" << G4endl;
-    if(strip)
-    {
-      StripNames();
-    }
+    G4String error_msg = "Unknown tag in gdml: " + tag;
+    G4Exception("G4GDMLRead::Read()", "InvalidRead", FatalException,
+                error_msg);
   }
 }
 
@@ -206,6 +206,7 @@ void G4GDMLReadDefine::ConstantRead(
   }
 
   eval.DefineConstant(name, value);
+  constantMap[name] = value;
 }
 
 // --------------------------------------------------------------------
@@ -249,6 +250,7 @@ void G4GDMLReadDefine::ExpressionRead(
   const G4String expValue = Transcode(expElement->getTextContent());
   value                   = eval.Evaluate(expValue);
   eval.DefineConstant(name, value);
+  constantMap[name] = value;
 }
 
 // --------------------------------------------------------------------
@@ -67,6 +67,10 @@
 #include "G4UnitsTable.hh"
 #include "G4SurfaceProperty.hh"
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
 // --------------------------------------------------------------------
 G4GDMLReadSolids::G4GDMLReadSolids()
   : G4GDMLReadMaterials()
@@ -2056,6 +2060,10 @@ void G4GDMLReadSolids::TessellatedRead(
   const xercesc::DOMElement* const tessellatedElement)
 {
   G4String name;
+  G4String meshName;
+  G4String meshfile;
+  G4String meshoffset;
+  G4double lunit = 1.0;
 
   const xercesc::DOMNamedNodeMap* const attributes =
     tessellatedElement->getAttributes();
@@ -2085,11 +2093,54 @@ void G4GDMLReadSolids::TessellatedRead(
     if(attName == "name")
     {
       name = GenerateName(attValue);
+      meshName = attValue;
+    }
+    else if(attName == "lunit")
+    {
+      lunit = G4UnitDefinition::GetValueOf(attValue);
+      if(G4UnitDefinition::GetCategory(attValue) != "Length")
+      {
+        G4Exception("G4GDMLReadSolids::TessellatedRead()", "InvalidRead",
+                    FatalException, "Invalid unit for length!");
+      }
+    }
+    else if(attName == "meshfile")
+    {
+      meshfile = attValue;
+    }
+    else if(attName == "meshoffset")
+    {
+      meshoffset = attValue;
     }
   }
 
   G4TessellatedSolid* tessellated = new G4TessellatedSolid(name);
 
+  if(!meshfile.empty())  // Facets stored in a binary mesh file
+  {
+    std::vector<G4ThreeVector> vertices;
+    std::vector<G4int> facetSizes;
+    MeshRead(meshfile, meshoffset, meshName, vertices, facetSizes);
+
+    std::size_t k = 0;
+    for(auto size : facetSizes)
+    {
+      if(size == 3)
+      {
+        tessellated->AddFacet(new G4TriangularFacet(
+          vertices[k] * lunit, vertices[k + 1] * lunit,
+          vertices[k + 2] * lunit, ABSOLUTE));
+      }
+      else
+      {
+        tessellated->AddFacet(new G4QuadrangularFacet(
+          vertices[k] * lunit, vertices[k + 1] * lunit,
+          vertices[k + 2] * lunit, vertices[k + 3] * lunit, ABSOLUTE));
+      }
+      k += size;
+    }
+  }
+
   for(xercesc::DOMNode* iter = tessellatedElement->getFirstChild();
                         iter != nullptr; iter = iter->getNextSibling())
   {
@@ -2125,6 +2176,9 @@ void G4GDMLReadSolids::TessellatedRead(
 void G4GDMLReadSolids::TetRead(const xercesc::DOMElement* const tetElement)
 {
   G4String name;
+  G4String meshName;
+  G4String meshfile;
+  G4String meshoffset;
   G4ThreeVector vertex1;
   G4ThreeVector vertex2;
   G4ThreeVector vertex3;
@@ -2159,6 +2213,7 @@ void G4GDMLReadSolids::TetRead(const xercesc::DOMElement* const tetElement)
     if(attName == "name")
     {
       name = GenerateName(attValue);
+      meshName = attValue;
     }
     else if(attName == "lunit")
     {
@@ -2185,12 +2240,123 @@ void G4GDMLReadSolids::TetRead(const xercesc::DOMElement* const tetElement)
     {
       vertex4 = GetPosition(GenerateName(attValue));
     }
+    else if(attName == "meshfile")
+    {
+      meshfile = attValue;
+    }
+    else if(attName == "meshoffset")
+    {
+      meshoffset = attValue;
+    }
+  }
+
+  if(!meshfile.empty())  // Vertices stored in a binary mesh file
+  {
+    std::vector<G4ThreeVector> vertices;
+    std::vector<G4int> facetSizes;
+    MeshRead(meshfile, meshoffset, meshName, vertices, facetSizes);
+    if(vertices.size() != 4)
+    {
+      G4String error_msg = "Invalid mesh data for tetrahedron: " + name;
+      G4Exception("G4GDMLReadSolids::TetRead()", "ReadError", FatalException,
+                  error_msg);
+      return;
+    }
+    vertex1 = vertices[0];
+    vertex2 = vertices[1];
+    vertex3 = vertices[2];
+    vertex4 = vertices[3];
   }
 
+
   new G4Tet(name, vertex1 * lunit, vertex2 * lunit, vertex3 * lunit,
             vertex4 * lunit);
 }
 
+// --------------------------------------------------------------------
+void G4GDMLReadSolids::MeshRead(const G4String& meshfile,
+                                const G4String& meshoffset,
+                                const G4String& solidName,
+                                std::vector<G4ThreeVector>& vertices,
+                                std::vector<G4int>& facetSizes)
+{
+  // Mesh files are looked for in the directory of the GDML file
+  // referencing them
+  //
+  G4String path = meshfile;
+  const std::size_t dirEnd = currentFile.find_last_of("/\\");
+  if(dirEnd != G4String::npos && meshfile.find_first_of("/\\") != 0)
+  {
+    path = currentFile.substr(0, dirEnd + 1) + meshfile;
+  }
+
+  std::ifstream file(path, std::ios::binary);
+  char magic[8] = { 0 };
+  std::uint32_t version = 0, byteOrder = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&byteOrder), sizeof(byteOrder));
+  if(!file || std::memcmp(magic, "G4GDMLMS", sizeof(magic)) != 0
+     || version != 1 || byteOrder != 0x01020304)
+  {
+    G4String error_msg = "Unable to open or invalid mesh file: " + path;
+    G4Exception("G4GDMLReadSolids::MeshRead()", "ReadError", FatalException,
+                error_msg);
+    return;
+  }
+
+  // Record: name of the solid, number of facets, number of vertices
+  // of each facet, then coordinates of all vertices in mm
+  //
+  std::uint32_t nameSize = 0;
+  file.seekg((std::streamoff)std::stoull(meshoffset));
+  file.read(reinterpret_cast<char*>(&nameSize), sizeof(nameSize));
+  G4String name(file ? nameSize : 0, ' ');
+  file.read(&name[0], (std::streamsize)name.size());
+  if(!file || name != solidName)
+  {
+    G4String error_msg = "No mesh data for solid " + solidName
+                       + " in mesh file: " + path;
+    G4Exception("G4GDMLReadSolids::MeshRead()", "ReadError", FatalException,
+                error_msg);
+    return;
+  }
+
+  std::uint64_t nFacets = 0;
+  file.read(reinterpret_cast<char*>(&nFacets), sizeof(nFacets));
+  std::vector<std::uint8_t> sizes(file ? nFacets : 0);
+  file.read(reinterpret_cast<char*>(sizes.data()), (std::streamsize)nFacets);
+  std::size_t nVertices = 0;
+  for(auto size : sizes)
+  {
+    if(size != 3 && size != 4)
+    {
+      file.setstate(std::ios::failbit);
+      break;
+    }
+    nVertices += size;
+  }
+  std::vector<G4double> coordinates(file ? 3 * nVertices : 0);
+  file.read(reinterpret_cast<char*>(coordinates.data()),
+            (std::streamsize)(coordinates.size() * sizeof(G4double)));
+  if(!file)
+  {
+    G4String error_msg = "Invalid mesh data for solid " + solidName
+                       + " in mesh file: " + path;
+    G4Exception("G4GDMLReadSolids::MeshRead()", "ReadError", FatalException,
+                error_msg);
+    return;
+  }
+
+  facetSizes.assign(sizes.cbegin(), sizes.cend());
+  vertices.resize(nVertices);
+  for(std::size_t i = 0; i < nVertices; ++i)
+  {
+    vertices[i].set(coordinates[3 * i], coordinates[3 * i + 1],
+                    coordinates[3 * i + 2]);
+  }
+}
+
 // --------------------------------------------------------------------
 void G4GDMLReadSolids::TorusRead(const xercesc::DOMElement* const torusElement)
 {
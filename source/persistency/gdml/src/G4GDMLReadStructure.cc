@@ -29,6 +29,7 @@
 // --------------------------------------------------------------------
 
 #include "G4GDMLReadStructure.hh"
+#include "G4GDMLBinaryCache.hh"
 
 #include "G4UnitsTable.hh"
 #include "G4LogicalVolume.hh"
@@ -1165,3 +1166,70 @@ void G4GDMLReadStructure::Clear()
   setuptoPV.clear();
   auxMap.clear();
 }
+
+// --------------------------------------------------------------------
+void G4GDMLReadStructure::ExportReaderData(G4GDMLReaderData& data)
+{
+  data.constants = constantMap;
+  for(const auto& name : eval.GetVariableList())
+  {
+    data.variables[name] = eval.GetVariable(name);
+  }
+  data.quantities = quantityMap;
+  data.positions = positionMap;
+  data.rotations = rotationMap;
+  data.scales = scaleMap;
+  for(const auto& matrix : matrixMap)
+  {
+    const G4GDMLMatrix& m = matrix.second;
+    std::vector<G4double> values;
+    for(std::size_t i = 0; i < m.GetRows(); ++i)
+    {
+      for(std::size_t j = 0; j < m.GetCols(); ++j)
+      {
+        values.push_back(m.Get(i, j));
+      }
+    }
+    data.matrices[matrix.first] = std::make_pair(m.GetCols(), values);
+  }
+  data.volumeAuxiliaries = auxMap;
+  data.auxiliaries = auxGlobalList;
+}
+
+// --------------------------------------------------------------------
+void G4GDMLReadStructure::ImportReaderData(const G4GDMLReaderData& data)
+{
+  for(const auto& constant : data.constants)
+  {
+    eval.DefineConstant(constant.first, constant.second);
+    constantMap[constant.first] = constant.second;
+  }
+  for(const auto& variable : data.variables)
+  {
+    eval.DefineVariable(variable.first, variable.second);
+  }
+  for(const auto& quantity : data.quantities)
+  {
+    eval.DefineConstant(quantity.first, quantity.second);
+    quantityMap[quantity.first] = quantity.second;
+  }
+  positionMap.insert(data.positions.cbegin(), data.positions.cend());
+  rotationMap.insert(data.rotations.cbegin(), data.rotations.cend());
+  scaleMap.insert(data.scales.cbegin(), data.scales.cend());
+  for(const auto& matrix : data.matrices)
+  {
+    const std::size_t cols = matrix.second.first;
+    const std::vector<G4double>& values = matrix.second.second;
+    eval.DefineMatrix(matrix.first, (G4int)cols, values);
+    G4GDMLMatrix m(values.size() / cols, cols);
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+      m.Set(i / cols, i % cols, values[i]);
+    }
+    matrixMap[matrix.first] = m;
+  }
+  auxMap.insert(data.volumeAuxiliaries.cbegin(),
+                data.volumeAuxiliaries.cend());
+  auxGlobalList.insert(auxGlobalList.end(), data.auxiliaries.cbegin(),
+                       data.auxiliaries.cend());
+}
@@ -90,6 +90,12 @@ void G4GDMLWrite::ExtensionWrite(xercesc::DOMElement*)
   // Empty implementation. To be overwritten by user for specific extensions
 }
 
+// --------------------------------------------------------------------
+void G4GDMLWrite::BinaryDataWrite()
+{
+  // Empty implementation. Overwritten by writers attaching binary data
+}
+
 // --------------------------------------------------------------------
 void G4GDMLWrite::AddAuxInfo(G4GDMLAuxListType* auxInfoList,
                              xercesc::DOMElement* element)
@@ -207,6 +213,7 @@ G4Transform3D G4GDMLWrite::Write(const G4String& fname,
 {
   SchemaLocation   = setSchemaLocation;
   addPointerToName = refs;
+  outputFileName   = fname;
 #ifdef G4VERBOSE
   if(depth == 0)
   {
@@ -274,6 +281,7 @@ G4Transform3D G4GDMLWrite::Write(const G4String& fname,
   G4Transform3D R = TraverseVolumeTree(logvol, depth);
 
   SurfacesWrite();
+  BinaryDataWrite();
   xercesc::XMLFormatTarget* myFormTarget =
     new xercesc::LocalFileFormatTarget(fname.c_str());
 
@@ -67,6 +67,24 @@
 #include "G4SurfaceProperty.hh"
 #include "G4MaterialPropertiesTable.hh"
 
+G4bool G4GDMLWriteSolids::binaryMeshes = false;
+
+namespace
+{
+  // Header of binary mesh files: magic word, format version and
+  // byte order mark
+  //
+  const char kMeshMagic[8] = { 'G', '4', 'G', 'D', 'M', 'L', 'M', 'S' };
+  const std::uint32_t kMeshVersion = 1;
+  const std::uint32_t kMeshByteOrder = 0x01020304;
+
+  template <typename T>
+  void MeshPut(std::ofstream& out, T value)
+  {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
 // --------------------------------------------------------------------
 G4GDMLWriteSolids::G4GDMLWriteSolids()
   : G4GDMLWriteMaterials()
@@ -666,6 +684,29 @@ void G4GDMLWriteSolids::TessellatedWrite(
   tessellatedElement->setAttributeNode(NewAttribute("lunit", "mm"));
   solElement->appendChild(tessellatedElement);
 
+  if(binaryMeshes)
+  {
+    std::vector<G4ThreeVector> vertices;
+    std::vector<G4int> facetSizes;
+    for(G4int i = 0; i < tessellated->GetNumberOfFacets(); ++i)
+    {
+      const G4VFacet* facet = tessellated->GetFacet(i);
+      const G4int NumVertexPerFacet = facet->GetNumberOfVertices();
+      if(NumVertexPerFacet != 3 && NumVertexPerFacet != 4)
+      {
+        G4Exception("G4GDMLWriteSolids::TessellatedWrite()", "InvalidSetup",
+                    FatalException, "Facet should contain 3 or 4 vertices!");
+      }
+      for(G4int j = 0; j < NumVertexPerFacet; ++j)
+      {
+        vertices.push_back(facet->GetVertex(j));
+      }
+      facetSizes.push_back(NumVertexPerFacet);
+    }
+    MeshWrite(tessellatedElement, name, vertices, facetSizes);
+    return;
+  }
+
   std::map<G4ThreeVector, G4String, G4ThreeVectorCompare> vertexMap;
 
   const std::size_t NumFacets = tessellated->GetNumberOfFacets();
@@ -750,6 +791,14 @@ void G4GDMLWriteSolids::TetWrite(xercesc::DOMElement* solElement,
 
   xercesc::DOMElement* tetElement = NewElement("tet");
   tetElement->setAttributeNode(NewAttribute("name", name));
+
+  if(binaryMeshes)
+  {
+    tetElement->setAttributeNode(NewAttribute("lunit", "mm"));
+    solElement->appendChild(tetElement);
+    MeshWrite(tetElement, name, vertexList, { 4 });
+    return;
+  }
   tetElement->setAttributeNode(NewAttribute("vertex1", solid_name + "_v1"));
   tetElement->setAttributeNode(NewAttribute("vertex2", solid_name + "_v2"));
   tetElement->setAttributeNode(NewAttribute("vertex3", solid_name + "_v3"));
@@ -763,6 +812,78 @@ void G4GDMLWriteSolids::TetWrite(xercesc::DOMElement* solElement,
   AddPosition(solid_name + "_v4", vertexList[3]);
 }
 
+// --------------------------------------------------------------------
+void G4GDMLWriteSolids::MeshWrite(xercesc::DOMElement* element,
+                                  const G4String& name,
+                                  const std::vector<G4ThreeVector>& vertices,
+                                  const std::vector<G4int>& facetSizes)
+{
+  const G4String meshName = outputFileName + ".mesh";
+
+  if(!meshFile.is_open())
+  {
+    if(!overwriteOutputFile && FileExists(meshName))
+    {
+      G4String ErrorMessage = "File '" + meshName + "' already exists!";
+      G4Exception("G4GDMLWriteSolids::MeshWrite()", "InvalidSetup",
+                  FatalException, ErrorMessage);
+    }
+    meshFile.open(meshName, std::ios::binary | std::ios::trunc);
+    meshFile.write(kMeshMagic, sizeof(kMeshMagic));
+    MeshPut(meshFile, kMeshVersion);
+    MeshPut(meshFile, kMeshByteOrder);
+    meshOffset = sizeof(kMeshMagic) + 2 * sizeof(std::uint32_t);
+  }
+
+  // The mesh file is referenced without path, being looked for in
+  // the same directory as the GDML file
+  //
+  const G4String meshRef = meshName.substr(meshName.find_last_of("/\\") + 1);
+  element->setAttributeNode(NewAttribute("meshfile", meshRef));
+  element->setAttributeNode(
+    NewAttribute("meshoffset", std::to_string(meshOffset)));
+
+  // Record: name of the solid, number of facets, number of vertices
+  // of each facet, then coordinates of all vertices in mm
+  //
+  MeshPut(meshFile, (std::uint32_t)name.size());
+  meshFile.write(name.c_str(), (std::streamsize)name.size());
+  MeshPut(meshFile, (std::uint64_t)facetSizes.size());
+  for(auto size : facetSizes)
+  {
+    MeshPut(meshFile, (std::uint8_t)size);
+  }
+  for(const auto& vertex : vertices)
+  {
+    MeshPut(meshFile, vertex.x() / mm);
+    MeshPut(meshFile, vertex.y() / mm);
+    MeshPut(meshFile, vertex.z() / mm);
+  }
+  meshOffset += sizeof(std::uint32_t) + name.size() + sizeof(std::uint64_t)
+              + facetSizes.size() + 3 * sizeof(G4double) * vertices.size();
+}
+
+// --------------------------------------------------------------------
+void G4GDMLWriteSolids::BinaryDataWrite()
+{
+  if(!meshFile.is_open())
+  {
+    return;
+  }
+  meshFile.close();
+  if(!meshFile)
+  {
+    G4String ErrorMessage = "Failed to write mesh file for '"
+                          + outputFileName + "'!";
+    G4Exception("G4GDMLWriteSolids::BinaryDataWrite()", "WriteError",
+                FatalException, ErrorMessage);
+  }
+#ifdef G4VERBOSE
+  G4cout << "G4GDML: Written mesh data '" << outputFileName << ".mesh' ("
+         << meshOffset << " bytes)" << G4endl;
+#endif
+}
+
 // --------------------------------------------------------------------
 void G4GDMLWriteSolids::TorusWrite(xercesc::DOMElement* solElement,
                                    const G4Torus* const torus)
@@ -1140,6 +1261,12 @@ void G4GDMLWriteSolids::SolidsWrite(xercesc::DOMElement* gdmlElement)
   solidList.clear();
 }
 
+// --------------------------------------------------------------------
+void G4GDMLWriteSolids::SetBinaryMeshes(G4bool flag)
+{
+  binaryMeshes = flag;
+}
+
 // --------------------------------------------------------------------
 void G4GDMLWriteSolids::AddSolid(const G4VSolid* const solidPtr)
 {
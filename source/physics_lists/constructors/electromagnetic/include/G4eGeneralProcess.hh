@@ -0,0 +1,238 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class header file
+//
+//
+// File name:     G4eGeneralProcess
+//
+// Creation date: 19.10.2026
+//
+// Class Description:
+//
+// It is the e+- super process combining ionisation, bremsstrahlung,
+// annihilation of positrons and optionally lepto-nuclear interaction.
+// The total cross section is tabulated per couple together with the
+// cumulative probabilities of sub-processes, so only one interaction
+// length is sampled per step. The integral approach is applied to the
+// total cross section using the envelope of the total over the energy
+// interval defined by the lambda factor, sub-processes are selected at
+// the interaction point. The continuous energy loss is provided by the
+// ionisation sub-process; multiple scattering, also inside the
+// G4TransportationWithMsc, is not affected.
+// The process is disabled by default and is used by G4EmStandardPhysics
+// only if enabled with G4EmParameters::SetElectronGeneralProcessActive()
+// or the UI command /process/em/UseElectronGeneralProcess.
+
+// -------------------------------------------------------------------
+//
+
+#ifndef G4eGeneralProcess_h
+#define G4eGeneralProcess_h 1
+
+#include "G4VEmProcess.hh"
+#include "globals.hh"
+#include "G4EmDataHandler.hh"
+
+class G4Step;
+class G4Track;
+class G4ParticleDefinition;
+class G4VParticleChange;
+class G4VEnergyLossProcess;
+class G4HadronicProcess;
+class G4MaterialCutsCouple;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+class G4eGeneralProcess : public G4VEmProcess
+{
+public:
+
+  explicit G4eGeneralProcess(const G4ParticleDefinition* part);
+
+  ~G4eGeneralProcess() override;
+
+  G4bool IsApplicable(const G4ParticleDefinition&) override;
+
+  void AddEnergyLossProcess(G4VEnergyLossProcess*);
+
+  void AddEmProcess(G4VEmProcess*);
+
+  void AddHadProcess(G4HadronicProcess*);
+
+  void ProcessDescription(std::ostream& outFile) const override;
+
+protected:
+
+  void InitialiseProcess(const G4ParticleDefinition*) override;
+
+public:
+
+  // Initialise for build of tables
+  void PreparePhysicsTable(const G4ParticleDefinition&) override;
+
+  // Build physics table during initialisation
+  void BuildPhysicsTable(const G4ParticleDefinition&) override;
+
+  // Sub-processes of the worker get their master sub-processes
+  void SetMasterProcess(G4VProcess* masterP) override;
+
+  // Called before tracking of each new G4Track
+  void StartTracking(G4Track*) override;
+
+  // continuous energy loss of the ionisation sub-process
+  G4double AlongStepGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4double previousStepSize,
+                             G4double currentMinimumStep,
+                             G4double& proposedSafety,
+                             G4GPILSelection* selection) override;
+
+  G4VParticleChange* AlongStepDoIt(const G4Track&, const G4Step&) override;
+
+  // implementation of virtual method, specific for G4eGeneralProcess
+  G4double PostStepGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4double   previousStepSize,
+                             G4ForceCondition* condition) override;
+
+  // implementation of virtual method, specific for G4eGeneralProcess
+  G4VParticleChange* PostStepDoIt(const G4Track&, const G4Step&) override;
+
+  // annihilation of positron at rest
+  G4double AtRestGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4ForceCondition* condition) override;
+
+  G4VParticleChange* AtRestDoIt(const G4Track&, const G4Step&) override;
+
+  // Store PhysicsTable of sub-processes in a file.
+  // Return false in case of failure at I/O
+  G4bool StorePhysicsTable(const G4ParticleDefinition*,
+                           const G4String& directory,
+                           G4bool ascii = false) override;
+
+  // Retrieve PhysicsTable of sub-processes from a file,
+  // tables of the general process are recomputed
+  G4bool RetrievePhysicsTable(const G4ParticleDefinition*,
+                              const G4String& directory,
+                              G4bool ascii) override;
+
+  // Return sub-process limiting current step
+  const G4VProcess* GetCreatorProcess() const override;
+  inline const G4VProcess* GetSelectedProcess() const;
+
+  G4VEmProcess* GetEmProcess(const G4String& name) override;
+
+  G4bool HasSubProcess(const G4VProcess*) const override;
+
+  G4VProcess* GetSubProcess(const G4String& name) const override;
+
+  inline G4VEnergyLossProcess* GetIonisation() const;
+
+  inline G4HadronicProcess* GetLeptoNuclear() const;
+
+  // hide copy constructor and assignment operator
+  G4eGeneralProcess(G4eGeneralProcess &) = delete;
+  G4eGeneralProcess & operator=
+  (const G4eGeneralProcess &right) = delete;
+
+protected:
+
+  inline G4double GetProbability(std::size_t idxt);
+
+  inline void SelectedProcess(const G4Step& step, G4VProcess* ptr);
+
+  void SelectHadProcess(const G4Track&, const G4Step&, G4HadronicProcess*);
+
+private:
+
+  G4VEnergyLossProcess*        theIonisation = nullptr;
+  G4VEnergyLossProcess*        theBremsstrahlung = nullptr;
+  G4VEmProcess*                theAnnihilation = nullptr;
+  G4HadronicProcess*           theLeptoNuclear = nullptr;
+  G4VProcess*                  selectedProc = nullptr;
+
+  // tables are owned by the master process and shared by workers:
+  // total cross section, its envelope for the integral approach,
+  // cumulative probabilities of ionisation, of ionisation and
+  // bremsstrahlung, and of ionisation, bremsstrahlung and annihilation
+  G4EmDataHandler*             theHandler = nullptr;
+  static const std::size_t     nTables = 5;
+  G4bool                       theT[nTables] =
+    {true, true, true, false, false};
+
+  G4double                     factor = 1.0;
+  G4double                     lambdaFactor = 0.8;
+  G4double                     preStepLogE = 1.0;
+  G4double                     fEnergy = 0.0;
+  G4double                     fLogEnergy = 0.0;
+  G4bool                       integral = true;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4double G4eGeneralProcess::GetProbability(std::size_t idxt)
+{
+  return theHandler->GetVector(idxt, basedCoupleIndex)
+    ->LogVectorValue(fEnergy, fLogEnergy);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline void
+G4eGeneralProcess::SelectedProcess(const G4Step& step, G4VProcess* ptr)
+{
+  selectedProc = ptr;
+  step.GetPostStepPoint()->SetProcessDefinedStep(ptr);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline const G4VProcess* G4eGeneralProcess::GetSelectedProcess() const
+{
+  return selectedProc;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4VEnergyLossProcess* G4eGeneralProcess::GetIonisation() const
+{
+  return theIonisation;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4HadronicProcess* G4eGeneralProcess::GetLeptoNuclear() const
+{
+  return theLeptoNuclear;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#endif
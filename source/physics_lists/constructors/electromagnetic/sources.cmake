@@ -38,6 +38,7 @@ geant4_add_module(G4phys_ctor_em
     G4EmStandardPhysics_option3.hh
     G4EmStandardPhysics_option4.hh
     G4GammaGeneralProcess.hh
+    G4eGeneralProcess.hh
     G4OpticalPhysics.hh
     G4ChemDissociationChannels.hh
     G4ChemDissociationChannels_option1.hh
@@ -77,6 +78,7 @@ geant4_add_module(G4phys_ctor_em
     G4EmStandardPhysics_option3.cc
     G4EmStandardPhysics_option4.cc
     G4GammaGeneralProcess.cc
+    G4eGeneralProcess.cc
     G4OpticalPhysics.cc
     G4ChemDissociationChannels.cc
     G4ChemDissociationChannels_option1.cc)
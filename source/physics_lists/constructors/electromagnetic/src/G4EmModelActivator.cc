@@ -774,6 +774,9 @@ G4EmModelActivator::FindOrAddProcess(const G4ParticleDefinition* part,
     if(part->GetPDGEncoding() == 22 && 
        ptr->GetProcessSubType() == fGammaGeneralProcess) {
       proc = (static_cast<G4GammaGeneralProcess*>(ptr))->GetEmProcess(name);
+    } else if(ptr->GetProcessSubType() == fElectronGeneralProcess ||
+              ptr->GetProcessSubType() == fPositronGeneralProcess) {
+      proc = (static_cast<G4VEmProcess*>(ptr))->GetEmProcess(name);
     } else if(ptr->GetProcessName() == name) {
       proc = dynamic_cast<G4VEmProcess*>(ptr);
     }
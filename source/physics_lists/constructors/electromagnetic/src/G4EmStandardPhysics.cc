@@ -74,6 +74,7 @@
 #include "G4BuilderType.hh"
 #include "G4EmModelActivator.hh"
 #include "G4GammaGeneralProcess.hh"
+#include "G4eGeneralProcess.hh"
 
 // factory
 #include "G4PhysicsConstructorFactory.hh"
@@ -189,8 +190,17 @@ void G4EmStandardPhysics::ConstructProcess()
   ssm->SetLowEnergyLimit(highEnergyLimit);
   ssm->SetActivationLowEnergyLimit(highEnergyLimit);
 
-  ph->RegisterProcess(new G4eIonisation(), particle);
-  ph->RegisterProcess(new G4eBremsstrahlung(), particle);
+  if(param->ElectronGeneralProcessActive()) {
+    G4eGeneralProcess* ep = new G4eGeneralProcess(particle);
+    ep->AddEnergyLossProcess(new G4eIonisation());
+    ep->AddEnergyLossProcess(new G4eBremsstrahlung());
+    G4LossTableManager::Instance()->SetElectronGeneralProcess(ep);
+    ph->RegisterProcess(ep, particle);
+
+  } else {
+    ph->RegisterProcess(new G4eIonisation(), particle);
+    ph->RegisterProcess(new G4eBremsstrahlung(), particle);
+  }
   ph->RegisterProcess(ss, particle);
 
   // e+
@@ -209,9 +219,19 @@ void G4EmStandardPhysics::ConstructProcess()
   ssm->SetLowEnergyLimit(highEnergyLimit);
   ssm->SetActivationLowEnergyLimit(highEnergyLimit);
 
-  ph->RegisterProcess(new G4eIonisation(), particle);
-  ph->RegisterProcess(new G4eBremsstrahlung(), particle);
-  ph->RegisterProcess(new G4eplusAnnihilation(), particle);
+  if(param->ElectronGeneralProcessActive()) {
+    G4eGeneralProcess* ep = new G4eGeneralProcess(particle);
+    ep->AddEnergyLossProcess(new G4eIonisation());
+    ep->AddEnergyLossProcess(new G4eBremsstrahlung());
+    ep->AddEmProcess(new G4eplusAnnihilation());
+    G4LossTableManager::Instance()->SetPositronGeneralProcess(ep);
+    ph->RegisterProcess(ep, particle);
+
+  } else {
+    ph->RegisterProcess(new G4eIonisation(), particle);
+    ph->RegisterProcess(new G4eBremsstrahlung(), particle);
+    ph->RegisterProcess(new G4eplusAnnihilation(), particle);
+  }
   ph->RegisterProcess(ss, particle);
 
   // generic ion
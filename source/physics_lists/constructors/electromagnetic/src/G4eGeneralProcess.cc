@@ -0,0 +1,638 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class file
+//
+//
+// File name:     G4eGeneralProcess
+//
+// Creation date: 19.10.2026
+//
+// Class Description: see the header file.
+//
+
+// -------------------------------------------------------------------
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+
+#include "G4eGeneralProcess.hh"
+#include "G4VEnergyLossProcess.hh"
+#include "G4HadronicProcess.hh"
+#include "G4CrossSectionDataStore.hh"
+#include "G4LossTableManager.hh"
+#include "G4LossTableBuilder.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4DynamicParticle.hh"
+#include "G4PhysicsTable.hh"
+#include "G4PhysicsLogVector.hh"
+#include "G4PhysicsTableHelper.hh"
+#include "G4VParticleChange.hh"
+#include "G4EmParameters.hh"
+#include "G4EmProcessSubType.hh"
+#include "G4Material.hh"
+#include "G4MaterialCutsCouple.hh"
+
+#include "G4Log.hh"
+#include <iostream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4eGeneralProcess::G4eGeneralProcess(const G4ParticleDefinition* part):
+  G4VEmProcess((part->GetPDGCharge() > 0.0)
+               ? "PositronGeneralProc" : "ElectronGeneralProc",
+               fElectromagnetic)
+{
+  SetVerboseLevel(1);
+  SetParticle(part);
+  if(part->GetPDGCharge() > 0.0) {
+    SetProcessSubType(fPositronGeneralProcess);
+    enableAtRestDoIt = true;
+  } else {
+    SetProcessSubType(fElectronGeneralProcess);
+  }
+  enableAlongStepDoIt = true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4eGeneralProcess::~G4eGeneralProcess()
+{
+  if(isTheMaster) {
+    delete theHandler;
+    theHandler = nullptr;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool G4eGeneralProcess::IsApplicable(const G4ParticleDefinition& part)
+{
+  return (&part == Particle());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::AddEnergyLossProcess(G4VEnergyLossProcess* ptr)
+{
+  if(nullptr == ptr) { return; }
+  G4int stype = ptr->GetProcessSubType();
+  if(stype == fIonisation)          { theIonisation = ptr; }
+  else if(stype == fBremsstrahlung) { theBremsstrahlung = ptr; }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::AddEmProcess(G4VEmProcess* ptr)
+{
+  if(nullptr == ptr) { return; }
+  if(ptr->GetProcessSubType() == fAnnihilation) { theAnnihilation = ptr; }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::AddHadProcess(G4HadronicProcess* ptr)
+{
+  theLeptoNuclear = ptr;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::PreparePhysicsTable(const G4ParticleDefinition& part)
+{
+  SetParticle(&part);
+  preStepLambda = 0.0;
+  preStepKinEnergy = 0.0;
+  currentCouple = nullptr;
+
+  G4EmParameters* param = G4EmParameters::Instance();
+  G4LossTableManager* man = G4LossTableManager::Instance();
+
+  isTheMaster = man->IsMaster();
+  if(isTheMaster) { SetVerboseLevel(param->Verbose()); }
+  else { SetVerboseLevel(param->WorkerVerbose()); }
+
+  G4LossTableBuilder* bld = man->GetTableBuilder();
+  baseMat = bld->GetBaseMaterialFlag();
+  integral = param->Integral();
+  lambdaFactor = param->LambdaFactor();
+
+  if(1 < verboseLevel) {
+    G4cout << "G4eGeneralProcess::PreparePhysicsTable() for "
+           << GetProcessName()
+           << " and particle " << part.GetParticleName()
+           << " isMaster: " << isTheMaster << G4endl;
+  }
+
+  // ionisation and bremsstrahlung must be always defined
+  if(nullptr == theIonisation || nullptr == theBremsstrahlung) {
+    G4ExceptionDescription ed;
+    ed << "### G4eGeneralProcess is initialized incorrectly"
+       << "\n Ionisation: " << theIonisation
+       << "\n Bremsstrahlung: " << theBremsstrahlung;
+    G4Exception("G4eGeneralProcess","em0004",
+                FatalException, ed,"");
+  }
+
+  theIonisation->PreparePhysicsTable(part);
+  theBremsstrahlung->PreparePhysicsTable(part);
+  if(nullptr != theAnnihilation) { theAnnihilation->PreparePhysicsTable(part); }
+  if(nullptr != theLeptoNuclear) { theLeptoNuclear->PreparePhysicsTable(part); }
+
+  // the integral approach is applied to the total cross section
+  theIonisation->SetCrossSectionType(fEmNoIntegral);
+  theBremsstrahlung->SetCrossSectionType(fEmNoIntegral);
+  if(nullptr != theAnnihilation) {
+    theAnnihilation->SetCrossSectionType(fEmNoIntegral);
+  }
+  theT[3] = (nullptr != theAnnihilation || nullptr != theLeptoNuclear);
+  theT[4] = (nullptr != theAnnihilation && nullptr != theLeptoNuclear);
+
+  InitialiseProcess(&part);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::InitialiseProcess(const G4ParticleDefinition*)
+{
+  if(isTheMaster) {
+
+    // tables are created and its size is defined only once
+    if(nullptr == theHandler) {
+      theHandler = new G4EmDataHandler(nTables);
+    }
+    G4EmParameters* param = G4EmParameters::Instance();
+    G4LossTableBuilder* bld = G4LossTableManager::Instance()->GetTableBuilder();
+
+    const G4ProductionCutsTable* theCoupleTable=
+      G4ProductionCutsTable::GetProductionCutsTable();
+    std::size_t numOfCouples = theCoupleTable->GetTableSize();
+
+    // all tables use linear interpolation, so that the envelope built
+    // from the values at the nodes bounds the total cross section; the
+    // number of bins is doubled to keep the accuracy of a spline
+    G4double mine = param->MinKinEnergy();
+    G4double maxe = param->MaxKinEnergy();
+    G4int nbin = std::max(5, 2*param->NumberOfBinsPerDecade()
+                          *G4lrint(std::log10(maxe/mine)));
+
+    G4PhysicsVector* vec = nullptr;
+    G4PhysicsLogVector aVector(mine, maxe, nbin, false);
+
+    for(std::size_t i=0; i<nTables; ++i) {
+      if(!theT[i]) { continue; }
+      G4PhysicsTable* table = theHandler->MakeTable(i);
+      for(std::size_t j=0; j<numOfCouples; ++j) {
+        vec = (*table)[j];
+        if (bld->GetFlag(j) && nullptr == vec) {
+          vec = new G4PhysicsVector(aVector);
+          G4PhysicsTableHelper::SetPhysicsVector(table, j, vec);
+        }
+      }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::BuildPhysicsTable(const G4ParticleDefinition& part)
+{
+  if(1 < verboseLevel) {
+    G4cout << "### G4eGeneralProcess::BuildPhysicsTable() for "
+           << GetProcessName()
+           << " and particle " << part.GetParticleName()
+           << G4endl;
+  }
+  if(!isTheMaster) {
+    auto master = static_cast<const G4eGeneralProcess*>(GetMasterProcess());
+    theHandler = master->theHandler;
+    baseMat = master->UseBaseMaterial();
+  }
+  theIonisation->BuildPhysicsTable(part);
+  theBremsstrahlung->BuildPhysicsTable(part);
+  if(nullptr != theAnnihilation) { theAnnihilation->BuildPhysicsTable(part); }
+  if(nullptr != theLeptoNuclear) { theLeptoNuclear->BuildPhysicsTable(part); }
+
+  if(isTheMaster) {
+    const G4ProductionCutsTable* theCoupleTable=
+      G4ProductionCutsTable::GetProductionCutsTable();
+    G4int numOfCouples = (G4int)theCoupleTable->GetTableSize();
+
+    G4LossTableBuilder* bld = G4LossTableManager::Instance()->GetTableBuilder();
+    const std::vector<G4PhysicsTable*>& tables = theHandler->GetTables();
+
+    G4CrossSectionDataStore* xs = (nullptr != theLeptoNuclear)
+      ? theLeptoNuclear->GetCrossSectionDataStore() : nullptr;
+    G4DynamicParticle* dynParticle =
+      new G4DynamicParticle(&part, G4ThreeVector(1,0,0), 1.0);
+
+    G4double sigI(0.), sigB(0.), sigA(0.), sigN(0.);
+
+    for(G4int i=0; i<numOfCouples; ++i) {
+
+      if (bld->GetFlag(i)) {
+        G4int idx = (!baseMat) ? i : DensityIndex(i);
+        const G4MaterialCutsCouple* couple =
+          theCoupleTable->GetMaterialCutsCouple(i);
+        const G4Material* material = couple->GetMaterial();
+
+        // total cross section and cumulative probabilities
+        G4PhysicsVector* tot = (*(tables[0]))[idx];
+        std::size_t nn = tot->GetVectorLength();
+        for(std::size_t j=0; j<nn; ++j) {
+          G4double e = tot->Energy(j);
+          G4double loge = G4Log(e);
+          sigI = theIonisation->GetLambda(e, couple, loge);
+          sigB = theBremsstrahlung->GetLambda(e, couple, loge);
+          sigA = (nullptr != theAnnihilation) ?
+            theAnnihilation->GetLambda(e, couple, loge) : 0.0;
+          sigN = 0.0;
+          if(nullptr != xs) {
+            dynParticle->SetKineticEnergy(e);
+            sigN = xs->ComputeCrossSection(dynParticle, material);
+          }
+          G4double sum = sigI + sigB + sigA + sigN;
+          if(1 < verboseLevel) {
+            G4cout << j << ". E= " << e << " xs= " << sum
+                   << " ioni= " << sigI << " brem= " << sigB
+                   << " annih= " << sigA << " LN= " << sigN << G4endl;
+          }
+          tot->PutValue(j, sum);
+          G4double norm = (sum > 0.0) ? 1.0/sum : 0.0;
+          (*(tables[2]))[idx]->PutValue(j, (sum > 0.0) ? sigI*norm : 1.0);
+          if(theT[3]) {
+            (*(tables[3]))[idx]->PutValue(j, (sum > 0.0)
+                                          ? (sigI + sigB)*norm : 1.0);
+          }
+          if(theT[4]) {
+            (*(tables[4]))[idx]->PutValue(j, (sum > 0.0)
+                                          ? (sigI + sigB + sigA)*norm : 1.0);
+          }
+        }
+
+        // envelope of the total cross section: the value at a node is
+        // the maximum of the linearly interpolated total over the energy
+        // interval from lambdaFactor times the previous node to the next
+        // node, reached at its lower edge or at a node; in any bin both
+        // edges, and so the interpolated envelope, bound the total over
+        // the interval from lambdaFactor*E to E
+        G4PhysicsVector* env = (*(tables[1]))[idx];
+        for(std::size_t j=0; j<nn; ++j) {
+          std::size_t j1 = (j > 0) ? j - 1 : 0;
+          std::size_t j2 = std::min(j + 1, nn - 1);
+          G4double emin = tot->Energy(j1)*lambdaFactor;
+          G4double xmax = std::max(tot->Value(emin), (*tot)[j2]);
+          for(std::size_t k=j2; k>0; --k) {
+            if(tot->Energy(k - 1) < emin) { break; }
+            xmax = std::max(xmax, (*tot)[k - 1]);
+          }
+          env->PutValue(j, xmax);
+        }
+      }
+    }
+    delete dynParticle;
+  }
+
+  if(1 < verboseLevel) {
+    G4cout << "### G4eGeneralProcess::BuildPhysicsTable() done for "
+           << GetProcessName()
+           << " and particle " << part.GetParticleName()
+           << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::SetMasterProcess(G4VProcess* masterP)
+{
+  G4VProcess::SetMasterProcess(masterP);
+  auto master = static_cast<G4eGeneralProcess*>(masterP);
+  if(nullptr != theIonisation) {
+    theIonisation->SetMasterProcess(master->theIonisation);
+  }
+  if(nullptr != theBremsstrahlung) {
+    theBremsstrahlung->SetMasterProcess(master->theBremsstrahlung);
+  }
+  if(nullptr != theAnnihilation) {
+    theAnnihilation->SetMasterProcess(master->theAnnihilation);
+  }
+  if(nullptr != theLeptoNuclear) {
+    theLeptoNuclear->SetMasterProcess(master->theLeptoNuclear);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::StartTracking(G4Track* track)
+{
+  theNumberOfInteractionLengthLeft = -1.0;
+  selectedProc = nullptr;
+  theIonisation->StartTracking(track);
+  theBremsstrahlung->StartTracking(track);
+  if(nullptr != theAnnihilation) { theAnnihilation->StartTracking(track); }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4eGeneralProcess::AlongStepGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4double previousStepSize,
+                             G4double currentMinimumStep,
+                             G4double& proposedSafety,
+                             G4GPILSelection* selection)
+{
+  return theIonisation->AlongStepGetPhysicalInteractionLength(
+    track, previousStepSize, currentMinimumStep, proposedSafety, selection);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VParticleChange* G4eGeneralProcess::AlongStepDoIt(const G4Track& track,
+                                                    const G4Step& step)
+{
+  selectedProc = theIonisation;
+  return theIonisation->AlongStepDoIt(track, step);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4eGeneralProcess::PostStepGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4double   previousStepSize,
+                             G4ForceCondition* condition)
+{
+  *condition = NotForced;
+  G4double x = DBL_MAX;
+
+  // the pre-step state of ionisation is needed for the energy loss
+  theIonisation->PreStepSetup(track);
+
+  G4double energy = track.GetKineticEnergy();
+  const G4MaterialCutsCouple* couple = track.GetMaterialCutsCouple();
+
+  // compute mean free path
+  G4bool recompute = false;
+  if(couple != currentCouple) {
+    currentCouple = couple;
+    basedCoupleIndex = currentCoupleIndex = couple->GetIndex();
+    currentMaterial = couple->GetMaterial();
+    factor = 1.0;
+    if(baseMat) {
+      basedCoupleIndex = DensityIndex((G4int)currentCoupleIndex);
+      factor = DensityFactor((G4int)currentCoupleIndex);
+    }
+    recompute = true;
+  }
+  if(energy != preStepKinEnergy) {
+    preStepKinEnergy = energy;
+    preStepLogE = track.GetDynamicParticle()->GetLogKineticEnergy();
+    recompute = true;
+  }
+  if(recompute) {
+    // the envelope of the total cross section is used
+    // for the integral approach
+    std::size_t idxt = (integral) ? 1 : 0;
+    preStepLambda = factor*theHandler->GetVector(idxt, basedCoupleIndex)
+      ->LogVectorValue(preStepKinEnergy, preStepLogE);
+
+    // zero cross section
+    if(preStepLambda <= 0.0) {
+      theNumberOfInteractionLengthLeft = -1.0;
+      currentInteractionLength = DBL_MAX;
+    }
+  }
+
+  // non-zero cross section
+  if(preStepLambda > 0.0) {
+
+    if (theNumberOfInteractionLengthLeft < 0.0) {
+
+      // beggining of tracking (or just after DoIt of this process)
+      theNumberOfInteractionLengthLeft =  -G4Log( G4UniformRand() );
+      theInitialNumberOfInteractionLength = theNumberOfInteractionLengthLeft;
+
+    } else if(currentInteractionLength < DBL_MAX) {
+
+      theNumberOfInteractionLengthLeft -=
+        previousStepSize/currentInteractionLength;
+      theNumberOfInteractionLengthLeft =
+        std::max(theNumberOfInteractionLengthLeft, 0.0);
+    }
+
+    // new mean free path and step limit for the next step
+    currentInteractionLength = 1.0/preStepLambda;
+    x = theNumberOfInteractionLengthLeft * currentInteractionLength;
+  }
+  return x;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VParticleChange* G4eGeneralProcess::PostStepDoIt(const G4Track& track,
+                                                   const G4Step& step)
+{
+  // In all cases clear number of interaction lengths
+  theNumberOfInteractionLengthLeft = -1.0;
+  selectedProc = nullptr;
+
+  // integral approach: the interaction is accepted with the ratio
+  // of the total cross section at the post-step point to its envelope,
+  // sub-processes are selected at the post-step point
+  if(integral) {
+    fEnergy = track.GetKineticEnergy();
+    fLogEnergy = track.GetDynamicParticle()->GetLogKineticEnergy();
+    G4double lx = factor*theHandler->GetVector(0, basedCoupleIndex)
+      ->LogVectorValue(fEnergy, fLogEnergy);
+    if(preStepLambda*G4UniformRand() >= lx) {
+      fParticleChange.InitializeForPostStep(track);
+      return &fParticleChange;
+    }
+  } else {
+    fEnergy = preStepKinEnergy;
+    fLogEnergy = preStepLogE;
+  }
+
+  G4double q = G4UniformRand();
+  if(q <= GetProbability(2)) {
+    SelectedProcess(step, theIonisation);
+
+  } else if(!theT[3] || q <= GetProbability(3)) {
+    theBremsstrahlung->PreStepSetup(track);
+    SelectedProcess(step, theBremsstrahlung);
+
+  } else if(nullptr != theAnnihilation &&
+            (!theT[4] || q <= GetProbability(4))) {
+    theAnnihilation->CurrentSetup(currentCouple, fEnergy);
+    SelectedProcess(step, theAnnihilation);
+
+  } else if(nullptr != theLeptoNuclear) {
+    SelectHadProcess(track, step, theLeptoNuclear);
+  }
+
+  // sample secondaries
+  if(nullptr != selectedProc) {
+    return selectedProc->PostStepDoIt(track, step);
+  }
+  // no interaction - exception case
+  fParticleChange.InitializeForPostStep(track);
+  return &fParticleChange;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::SelectHadProcess(const G4Track& track,
+            const G4Step& step, G4HadronicProcess* proc)
+{
+  SelectedProcess(step, proc);
+  proc->GetCrossSectionDataStore()->ComputeCrossSection(track.GetDynamicParticle(),
+                                                        currentMaterial);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4eGeneralProcess::AtRestGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4ForceCondition* condition)
+{
+  return (nullptr != theAnnihilation)
+    ? theAnnihilation->AtRestGetPhysicalInteractionLength(track, condition)
+    : G4VEmProcess::AtRestGetPhysicalInteractionLength(track, condition);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VParticleChange* G4eGeneralProcess::AtRestDoIt(const G4Track& track,
+                                                 const G4Step& step)
+{
+  if(nullptr == theAnnihilation) {
+    return G4VEmProcess::AtRestDoIt(track, step);
+  }
+  SelectedProcess(step, theAnnihilation);
+  return theAnnihilation->AtRestDoIt(track, step);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool G4eGeneralProcess::StorePhysicsTable(const G4ParticleDefinition* part,
+                                            const G4String& directory,
+                                            G4bool ascii)
+{
+  G4bool yes = true;
+  if(!isTheMaster) { return yes; }
+  if(!theIonisation->StorePhysicsTable(part, directory, ascii))
+    { yes = false; }
+  if(!theBremsstrahlung->StorePhysicsTable(part, directory, ascii))
+    { yes = false; }
+  if(nullptr != theAnnihilation &&
+     !theAnnihilation->StorePhysicsTable(part, directory, ascii))
+    { yes = false; }
+  return yes;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool
+G4eGeneralProcess::RetrievePhysicsTable(const G4ParticleDefinition* part,
+                                        const G4String& directory,
+                                        G4bool ascii)
+{
+  if(1 < verboseLevel) {
+    G4cout << "G4eGeneralProcess::RetrievePhysicsTable() for "
+           << part->GetParticleName() << " and process "
+           << GetProcessName() << G4endl;
+  }
+  G4bool yes = true;
+  if(!theIonisation->RetrievePhysicsTable(part, directory, ascii))
+    { yes = false; }
+  if(!theBremsstrahlung->RetrievePhysicsTable(part, directory, ascii))
+    { yes = false; }
+  if(nullptr != theAnnihilation &&
+     !theAnnihilation->RetrievePhysicsTable(part, directory, ascii))
+    { yes = false; }
+  return yes;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4eGeneralProcess::ProcessDescription(std::ostream& out) const
+{
+  theIonisation->ProcessDescription(out);
+  theBremsstrahlung->ProcessDescription(out);
+  if(theAnnihilation) { theAnnihilation->ProcessDescription(out); }
+  if(theLeptoNuclear) { theLeptoNuclear->ProcessDescription(out); }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VEmProcess* G4eGeneralProcess::GetEmProcess(const G4String& name)
+{
+  return (nullptr != theAnnihilation &&
+          name == theAnnihilation->GetProcessName()) ? theAnnihilation : nullptr;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool G4eGeneralProcess::HasSubProcess(const G4VProcess* ptr) const
+{
+  return (nullptr != ptr &&
+          (ptr == theIonisation || ptr == theBremsstrahlung ||
+           ptr == theAnnihilation || ptr == theLeptoNuclear));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VProcess* G4eGeneralProcess::GetSubProcess(const G4String& name) const
+{
+  G4VProcess* proc = nullptr;
+  if(nullptr != theIonisation && name == theIonisation->GetProcessName()) {
+    proc = theIonisation;
+  } else if(nullptr != theBremsstrahlung &&
+            name == theBremsstrahlung->GetProcessName()) {
+    proc = theBremsstrahlung;
+  } else if(nullptr != theAnnihilation &&
+            name == theAnnihilation->GetProcessName()) {
+    proc = theAnnihilation;
+  } else if(nullptr != theLeptoNuclear &&
+            name == theLeptoNuclear->GetProcessName()) {
+    proc = theLeptoNuclear;
+  }
+  return proc;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+const G4VProcess* G4eGeneralProcess::GetCreatorProcess() const
+{
+  return (nullptr != selectedProc) ? selectedProc : this;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -121,6 +121,7 @@
 #include "G4ANuElNucleusNcModel.hh"
 
 #include "G4GammaGeneralProcess.hh"
+#include "G4eGeneralProcess.hh"
 #include "G4LossTableManager.hh"
 #include "G4PhotoNuclearCrossSection.hh"
 #include "G4GammaNuclearXS.hh"
@@ -531,16 +532,16 @@ void G4EmExtraPhysics::ConstructGammaElectroNuclear()
     enuc->RegisterMe(eModel);
     pnuc->RegisterMe(eModel);
 
-    G4GammaGeneralProcess* eproc = 
-      (G4GammaGeneralProcess*)emManager->GetElectronGeneralProcess();
+    auto eproc = 
+      static_cast<G4eGeneralProcess*>(emManager->GetElectronGeneralProcess());
     if(eproc != nullptr) {
       eproc->AddHadProcess(enuc);
     } else {
       ph->RegisterProcess(enuc, G4Electron::Electron());
     }
   
-    G4GammaGeneralProcess* pproc = 
-      (G4GammaGeneralProcess*)emManager->GetPositronGeneralProcess();
+    auto pproc = 
+      static_cast<G4eGeneralProcess*>(emManager->GetPositronGeneralProcess());
     if(pproc != nullptr) {
       pproc->AddHadProcess(pnuc);
     } else {
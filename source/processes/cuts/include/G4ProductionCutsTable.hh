@@ -69,6 +69,12 @@ class G4ProductionCutsTable
     void UpdateCoupleTable(G4VPhysicalVolume* currentWorld);
       // Triggers an update of the table of G4ProductionCuts objects
 
+    void UpdateCoupleTable(G4VPhysicalVolume* currentWorld,
+                           const std::vector<G4Region*>& regions);
+      // Triggers an incremental update of the table, for changes of the
+      // geometry confined to the given regions: only the couples of these
+      // regions are registered again, the other regions are left as they are
+
     void SetEnergyRange(G4double lowedge, G4double highedge);
       // Sets the limits of energy cuts for all particles
 
@@ -184,6 +190,13 @@ class G4ProductionCutsTable
 
   private:
 
+    void CreateConverters();
+    void UpdateRegionCouples(G4Region* aRegion);
+    void UpdateCutValues();
+      // Steps of UpdateCoupleTable(): creation of the range to energy
+      // converters at first use, registration of the couples of a region,
+      // and computation of the cut values of new or modified couples
+
     void ScanAndSetCouple(G4LogicalVolume* aLV,
                           G4MaterialCutsCouple* aCouple,
                           G4Region* aRegion);
@@ -116,6 +116,67 @@ G4ProductionCutsTable::~G4ProductionCutsTable()
 
 // --------------------------------------------------------------------
 void G4ProductionCutsTable::UpdateCoupleTable(G4VPhysicalVolume* /*currWorld*/)
+{
+  CreateConverters();
+
+  // Reset "used" flags of all couples
+  for(auto CoupleItr=coupleTable.cbegin();
+           CoupleItr!=coupleTable.cend(); ++CoupleItr) 
+  {
+    (*CoupleItr)->SetUseFlag(false); 
+  }
+
+  // Update Material-Cut-Couple
+  for(auto rItr=fG4RegionStore->cbegin(); rItr!=fG4RegionStore->cend(); ++rItr)
+  {
+    UpdateRegionCouples(*rItr);
+  }
+
+  UpdateCutValues();
+}
+
+// --------------------------------------------------------------------
+void G4ProductionCutsTable::
+UpdateCoupleTable(G4VPhysicalVolume* /*currWorld*/,
+                  const std::vector<G4Region*>& regions)
+{
+  CreateConverters();
+
+  // Reset "used" flags of all couples, then set them again for the
+  // couples still registered to the regions left unchanged, so that
+  // couples no longer used by the modified regions are flagged as such
+  for(auto CoupleItr=coupleTable.cbegin();
+           CoupleItr!=coupleTable.cend(); ++CoupleItr) 
+  {
+    (*CoupleItr)->SetUseFlag(false); 
+  }
+  for(auto rItr=fG4RegionStore->cbegin(); rItr!=fG4RegionStore->cend(); ++rItr)
+  {
+    G4Region* aRegion = *rItr;
+    if( std::find(regions.cbegin(), regions.cend(), aRegion) != regions.cend()
+     || !(aRegion->IsInMassGeometry() || aRegion->IsInParallelGeometry()) )
+    {
+      continue;
+    }
+    auto mItr = aRegion->GetMaterialIterator();
+    std::size_t nMaterial = aRegion->GetNumberOfMaterials();
+    for(std::size_t iMate=0; iMate<nMaterial; ++iMate, ++mItr)
+    {
+      G4MaterialCutsCouple* aCouple = aRegion->FindCouple(*mItr);
+      if(aCouple != nullptr) { aCouple->SetUseFlag(); }
+    }
+  }
+
+  for(auto region : regions)
+  {
+    UpdateRegionCouples(region);
+  }
+
+  UpdateCutValues();
+}
+
+// --------------------------------------------------------------------
+void G4ProductionCutsTable::CreateConverters()
 {
   if(firstUse)
   {
@@ -141,78 +202,74 @@ void G4ProductionCutsTable::UpdateCoupleTable(G4VPhysicalVolume* /*currWorld*/)
     }
     firstUse = false;
   }
+}
 
-  // Reset "used" flags of all couples
-  for(auto CoupleItr=coupleTable.cbegin();
-           CoupleItr!=coupleTable.cend(); ++CoupleItr) 
-  {
-    (*CoupleItr)->SetUseFlag(false); 
-  }
+// --------------------------------------------------------------------
+void G4ProductionCutsTable::UpdateRegionCouples(G4Region* aRegion)
+{
+  // Material scan is to be done only for the regions appear in the 
+  // current tracking world.
+  //    if(aRegion->GetWorldPhysical()!=currentWorld) return;
 
-  // Update Material-Cut-Couple
-  for(auto rItr=fG4RegionStore->cbegin(); rItr!=fG4RegionStore->cend(); ++rItr)
+  if( aRegion->IsInMassGeometry() || aRegion->IsInParallelGeometry() )
   {
-    // Material scan is to be done only for the regions appear in the 
-    // current tracking world.
-    //    if((*rItr)->GetWorldPhysical()!=currentWorld) continue;
+    G4ProductionCuts* fProductionCut = aRegion->GetProductionCuts();
+    auto mItr = aRegion->GetMaterialIterator();
+    std::size_t nMaterial = aRegion->GetNumberOfMaterials();
+    aRegion->ClearMap();
 
-    if( (*rItr)->IsInMassGeometry() || (*rItr)->IsInParallelGeometry() )
+    for(std::size_t iMate=0; iMate<nMaterial; ++iMate)
     {
-      G4ProductionCuts* fProductionCut = (*rItr)->GetProductionCuts();
-      auto mItr = (*rItr)->GetMaterialIterator();
-      std::size_t nMaterial = (*rItr)->GetNumberOfMaterials();
-      (*rItr)->ClearMap();
-
-      for(std::size_t iMate=0; iMate<nMaterial; ++iMate)
+      //check if this material cut couple has already been made
+      G4bool coupleAlreadyDefined = false;
+      G4MaterialCutsCouple* aCouple;
+      for(auto cItr=coupleTable.cbegin(); cItr!=coupleTable.cend(); ++cItr)
       {
-        //check if this material cut couple has already been made
-        G4bool coupleAlreadyDefined = false;
-        G4MaterialCutsCouple* aCouple;
-        for(auto cItr=coupleTable.cbegin(); cItr!=coupleTable.cend(); ++cItr)
-        {
-          if( (*cItr)->GetMaterial()==(*mItr)
-           && (*cItr)->GetProductionCuts()==fProductionCut)
-          { 
-            coupleAlreadyDefined = true;
-            aCouple = *cItr;
-            break;
-          }
-        }
-      
-        // If this combination is new, cleate and register a couple
-        if(!coupleAlreadyDefined)
-        {
-          aCouple = new G4MaterialCutsCouple((*mItr),fProductionCut);
-          coupleTable.push_back(aCouple);
-          aCouple->SetIndex(G4int(coupleTable.size()-1));
+        if( (*cItr)->GetMaterial()==(*mItr)
+         && (*cItr)->GetProductionCuts()==fProductionCut)
+        { 
+          coupleAlreadyDefined = true;
+          aCouple = *cItr;
+          break;
         }
+      }
+    
+      // If this combination is new, cleate and register a couple
+      if(!coupleAlreadyDefined)
+      {
+        aCouple = new G4MaterialCutsCouple((*mItr),fProductionCut);
+        coupleTable.push_back(aCouple);
+        aCouple->SetIndex(G4int(coupleTable.size()-1));
+      }
 
-        // Register this couple to the region
-        (*rItr)->RegisterMaterialCouplePair((*mItr),aCouple);
+      // Register this couple to the region
+      aRegion->RegisterMaterialCouplePair((*mItr),aCouple);
 
-        // Set the couple to the proper logical volumes in that region
-        aCouple->SetUseFlag();
+      // Set the couple to the proper logical volumes in that region
+      aCouple->SetUseFlag();
 
-        auto rootLVItr = (*rItr)->GetRootLogicalVolumeIterator();
-        std::size_t nRootLV = (*rItr)->GetNumberOfRootVolumes();
-        for(std::size_t iLV=0; iLV<nRootLV; ++iLV)
-        {
-          // Set the couple to the proper logical volumes in that region
-          G4LogicalVolume* aLV = *rootLVItr;
-          G4Region* aR = *rItr;
-
-          ScanAndSetCouple(aLV,aCouple,aR);
+      auto rootLVItr = aRegion->GetRootLogicalVolumeIterator();
+      std::size_t nRootLV = aRegion->GetNumberOfRootVolumes();
+      for(std::size_t iLV=0; iLV<nRootLV; ++iLV)
+      {
+        // Set the couple to the proper logical volumes in that region
+        G4LogicalVolume* aLV = *rootLVItr;
 
-          // Proceed to the next root logical volume in this region
-          ++rootLVItr;
-        }
+        ScanAndSetCouple(aLV,aCouple,aRegion);
 
-        // Proceed to next material in this region
-        ++mItr;
+        // Proceed to the next root logical volume in this region
+        ++rootLVItr;
       }
+
+      // Proceed to next material in this region
+      ++mItr;
     }
   }
+}
 
+// --------------------------------------------------------------------
+void G4ProductionCutsTable::UpdateCutValues()
+{
   // Check if sizes of Range/Energy cuts tables are equal to the size of
   // the couple table. If new couples are made during the previous procedure,
   // nCouple becomes larger then nTable
@@ -79,6 +79,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <atomic>
 
 class G4Material;
 class G4Element;
@@ -109,6 +110,8 @@ private:
 
   void ReadCompressedFile(std::string fname, std::istringstream &iss);
 
+  // Data of the given material, not used in the geometry at initialisation,
+  // are computed at the first use of this material (thread safe).
   void InitMCDataMaterial(const G4Material*);
   //
   // dat structures
@@ -132,6 +135,7 @@ private:
     DataPerEkin  **fDataPerEkin;    // per kinetic energy data structure for each kinetic energy value
   };
   //
+  DataPerMaterial* ComputeMCDataMaterial(const G4Material*);
   void AllocateDataPerMaterial(DataPerMaterial*);
   void DeAllocateDataPerMaterial(DataPerMaterial*);
   void ClearMCDataPerElement();
@@ -178,7 +182,8 @@ private:
   static const std::string   gElemSymbols[];
   //
   std::vector<DataPerMaterial*>  fMCDataPerElement;   // size will be gMaxZet+1; won't be null only at used Z indices
-  std::vector<DataPerMaterial*>  fMCDataPerMaterial;  // size will #materials; won't be null only at used mat. indices
+  // data of a material are published only once complete, so workers may read them without locking
+  std::vector<std::atomic<DataPerMaterial*>>  fMCDataPerMaterial;  // size will #materials; won't be null only at used mat. indices
 };
 
 #endif // G4GSMottCorrection_h
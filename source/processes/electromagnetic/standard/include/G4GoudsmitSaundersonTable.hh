@@ -139,6 +139,9 @@ public:
   void     InitSCPCorrection();
 
 private:
+  // loads the angular distributions of one s/lambda_el value of grid 'igrid'
+  void LoadMSCDataFile(G4int igrid, G4int il);
+
   // initialisation of material dependent Moliere's MSC parameters
   void InitMoliereMSCParams();
 
@@ -46,7 +46,9 @@
 // This class is extracted from G4PAIModel in order to provide sharing
 // of these data between threads.
 //
-// Internal data tables are computed for proton. 
+// Internal data tables are computed for proton. Tables of different
+// couples are independent; if the tasking run manager provides a thread
+// pool, they are built in parallel on the master thread.
 
 // -------------------------------------------------------------------
 //
@@ -62,6 +64,7 @@
 class G4PhysicsLogVector;
 class G4PhysicsTable;
 class G4MaterialCutsCouple;
+class G4Material;
 class G4PAIModel;
 
 class G4PAIModelData 
@@ -75,6 +78,10 @@ public:
 
   void Initialise(const G4MaterialCutsCouple*, G4PAIModel*);
 
+  // initialise data for a list of new couples in one go
+  void Initialise(const std::vector<const G4MaterialCutsCouple*>&,
+                  G4PAIModel*);
+
   G4double DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const;
 
@@ -99,15 +106,16 @@ private:
   G4double GetEnergyTransfer(G4int coupleIndex, size_t iPlace, 
 			     G4double position) const;
 
+  void BuildCoupleData(std::size_t idx, const G4Material*,
+                       const std::vector<G4double>& transferMax);
+
   G4int                fTotBin;
+  G4int                fVerbose;
   G4double             fLowestKineticEnergy;
   G4double             fHighestKineticEnergy;
 
   G4PhysicsLogVector*  fParticleEnergyVector;
 
-  G4PAIySection        fPAIySection;
-  G4SandiaTable        fSandia;
-
   std::vector<G4PhysicsTable*>      fPAIxscBank;
   std::vector<G4PhysicsTable*>      fPAIdEdxBank;
   std::vector<G4PhysicsLogVector*>  fdEdxTable;
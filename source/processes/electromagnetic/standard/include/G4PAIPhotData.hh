@@ -44,7 +44,9 @@
 // This class is extracted from G4PAIPhot in order to provide sharing
 // of these data between threads.
 //
-// Internal data tables are computed for proton. 
+// Internal data tables are computed for proton. Tables of different
+// couples are independent; if the tasking run manager provides a thread
+// pool, they are built in parallel on the master thread.
 //
 // -------------------------------------------------------------------
 //
@@ -73,6 +75,10 @@ public:
 
   void Initialise(const G4MaterialCutsCouple*, G4double cut, G4PAIPhotModel*);
 
+  // initialise data for a list of new couples and their cuts in one go
+  void Initialise(const std::vector<const G4MaterialCutsCouple*>&,
+                  const std::vector<G4double>& cuts, G4PAIPhotModel*);
+
   G4double DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const;
 
@@ -111,15 +117,15 @@ private:
   G4double GetEnergyPlasmonTransfer(G4int coupleIndex, size_t iPlace, 
 			     G4double position) const;
 
+  void BuildCoupleData(std::size_t idx, const G4MaterialCutsCouple*,
+                       G4double cut, const std::vector<G4double>& transferMax);
+
   G4int                fTotBin;
   G4double             fLowestKineticEnergy;
   G4double             fHighestKineticEnergy;
 
   G4PhysicsLogVector*  fParticleEnergyVector;
 
-  G4PAIxSection        fPAIxSection;
-  G4SandiaTable        fSandia;
-
   std::vector<G4PhysicsTable*>      fPAIxscBank;
   std::vector<G4PhysicsTable*>      fPAIphotonBank;
   std::vector<G4PhysicsTable*>      fPAIplasmonBank;
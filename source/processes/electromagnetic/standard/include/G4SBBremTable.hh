@@ -46,6 +46,11 @@
 // Seltzer-Berger model for e-/e+ bremsstrahlung photon emission model. Note,
 // that one object from this class can handle both e- and e+ cases (containes
 // e+ correction in the SampleEnergyTransfer method only).
+// Only the bookkeeping of the gamma cuts and of the electron energy range is
+// done at initialisation: the sampling tables of an element are read from the
+// data file when photon energy is sampled for this element for the first time
+// (thread safe), so elements that are never hit cost nothing. One object may
+// be shared by all worker threads.
 //
 // ----------------------------------------------------------------------------
 
@@ -55,6 +60,7 @@
 #include "globals.hh"
 #include "G4String.hh"
 
+#include <atomic>
 #include <vector>
 
 // forward declar
@@ -92,6 +98,7 @@ private:
 
   void  LoadSTGrid();
 
+  // loads sampling tables of Z at the first use, thread safe
   void  LoadSamplingTables(G4int iz);
 
   void  ReadCompressedFile(const G4String &fname, std::istringstream &iss);
@@ -116,11 +123,12 @@ private:
   // Sampling-Tables for a given Z:
   // describes all tables (i.e. for all e- energies) for a given element (Z)
   struct SamplingTablePerZ {
-    SamplingTablePerZ() : fNumGammaCuts(0), fMinElEnergyIndx(-1), fMaxElEnergyIndx(-1) {}
+    SamplingTablePerZ() : fNumGammaCuts(0), fMinElEnergyIndx(-1), fMaxElEnergyIndx(-1), fIsLoaded(false) {}
     size_t                fNumGammaCuts;     // number of gamma-cut for this
     G4int                 fMinElEnergyIndx;  // max(i) such E_i <= E for all E
     G4int                 fMaxElEnergyIndx;  // min(i) such E_i >= E for all E
     std::vector<STable*>  fTablesPerEnergy;  // as many table as e-ekin grid point
+    std::atomic<G4bool>   fIsLoaded;         // tables are loaded from file
     //the different gamma-cut values that are defined for this element(Z) and ln
     std::vector<G4double> fGammaECuts;
     std::vector<G4double> fLogGammaECuts;
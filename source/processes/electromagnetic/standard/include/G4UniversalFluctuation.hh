@@ -50,6 +50,8 @@
 #include "G4VEmFluctuationModel.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4Poisson.hh"
+#include "G4Exp.hh"
+#include "G4Log.hh"
 #include <CLHEP/Random/RandomEngine.h>
 
 class G4UniversalFluctuation : public G4VEmFluctuationModel
@@ -97,6 +99,21 @@ protected:
                           const G4double eav, const G4double esig2, 
                           G4double& eloss); 
 
+  // sum of energies of nnb ionisation collisions sampled as w3/(1-w*u)
+  inline G4double SampleIonisation(CLHEP::HepRandomEngine* rndm,
+                                   const G4int nnb, const G4double w3,
+                                   const G4double w);
+
+  // uniform random numbers are taken from a block filled at once;
+  // the block is refilled at each step, so the random sequence
+  // of a step does not depend on the previous steps
+  inline void FillRandomBlock(CLHEP::HepRandomEngine* rndm, const G4int n);
+
+  inline G4double Flat(CLHEP::HepRandomEngine* rndm);
+
+  inline G4long SamplePoisson(CLHEP::HepRandomEngine* rndm,
+                              const G4double mean);
+
   // particle properties
   G4double particleMass = 0.0;
   G4double m_Inv_particleMass = DBL_MAX;
@@ -119,8 +136,13 @@ protected:
   G4double meanLoss = 0.0;
 
   const G4ParticleDefinition* particle = nullptr;
+
+  // block of uniform random numbers
   G4double* rndmarray = nullptr;
-  G4int sizearray = 30;
+  G4int sizearray = 32;
+  G4int nrndm = 0;
+  G4int irndm = 0;
+  G4int nblock = 8;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -135,8 +157,8 @@ G4UniversalFluctuation::AddExcitation(CLHEP::HepRandomEngine* rndm,
     eav  += ax*ex;
     esig2 += ax*ex*ex;
   } else {
-    const G4int p = (G4int)G4Poisson(ax);
-    if(p > 0) { eloss += ((p + 1) - 2.*rndm->flat())*ex; }
+    const G4int p = (G4int)SamplePoisson(rndm, ax);
+    if(p > 0) { eloss += ((p + 1) - 2.*Flat(rndm))*ex; }
   }
 }
 
@@ -150,10 +172,22 @@ G4UniversalFluctuation::SampleGauss(CLHEP::HepRandomEngine* rndm,
   G4double x = eav;
   const G4double sig = std::sqrt(esig2);
   if(eav < 0.25*sig) {
-    x += (2.*rndm->flat() - 1.)*eav;
+    x += (2.*Flat(rndm) - 1.)*eav;
   } else {
-    do { 
-      x = G4RandGauss::shoot(rndm, eav, sig);
+    // Box-Muller method, both numbers of the pair are used
+    G4double y = 0.0;
+    G4bool hasy = false;
+    do {
+      if(hasy) {
+        x = eav + sig*y;
+        hasy = false;
+      } else {
+        const G4double r = std::sqrt(-2.*G4Log(Flat(rndm)));
+        const G4double phi = CLHEP::twopi*Flat(rndm);
+        x = eav + sig*r*std::cos(phi);
+        y = r*std::sin(phi);
+        hasy = true;
+      }
     } while (x < 0.0 || x > 2*eav);
     // Loop checking, 23-Feb-2016, Vladimir Ivanchenko
   }
@@ -162,5 +196,79 @@ G4UniversalFluctuation::SampleGauss(CLHEP::HepRandomEngine* rndm,
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+inline G4double
+G4UniversalFluctuation::SampleIonisation(CLHEP::HepRandomEngine* rndm,
+                                         const G4int nnb, const G4double w3,
+                                         const G4double w)
+{
+  if(nnb > nrndm - irndm) { FillRandomBlock(rndm, nnb); }
+  const G4double* u = rndmarray + irndm;
+  irndm += nnb;
+
+  // independent partial sums allow vectorisation of the loop
+  G4double sum[4] = {0.0, 0.0, 0.0, 0.0};
+  const G4int n4 = nnb - nnb%4;
+  for (G4int k=0; k<n4; k+=4) {
+    sum[0] += 1./(1.-w*u[k]);
+    sum[1] += 1./(1.-w*u[k+1]);
+    sum[2] += 1./(1.-w*u[k+2]);
+    sum[3] += 1./(1.-w*u[k+3]);
+  }
+  for (G4int k=n4; k<nnb; ++k) { sum[0] += 1./(1.-w*u[k]); }
+  return w3*((sum[0] + sum[1]) + (sum[2] + sum[3]));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline void 
+G4UniversalFluctuation::FillRandomBlock(CLHEP::HepRandomEngine* rndm,
+                                        const G4int n)
+{
+  if(n > sizearray) {
+    sizearray = n;
+    delete [] rndmarray;
+    rndmarray = new G4double[n];
+  }
+  rndm->flatArray(n, rndmarray);
+  nrndm = n;
+  irndm = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline G4double G4UniversalFluctuation::Flat(CLHEP::HepRandomEngine* rndm)
+{
+  if(irndm >= nrndm) { FillRandomBlock(rndm, nblock); }
+  return rndmarray[irndm++];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline G4long 
+G4UniversalFluctuation::SamplePoisson(CLHEP::HepRandomEngine* rndm,
+                                      const G4double mean)
+{
+  // same algorithm as G4Poisson with numbers taken from the block
+  G4long number = 0;
+  if(mean <= 16.) {
+    const G4double position = Flat(rndm);
+    G4double poissonValue = G4Exp(-mean);
+    G4double poissonSum = poissonValue;
+    while(poissonSum <= position) {
+      ++number;
+      poissonValue *= mean/number;
+      poissonSum += poissonValue;
+    }
+    return number;
+  }
+  const G4double t = std::sqrt(-2.*G4Log(Flat(rndm)))*
+    std::cos(CLHEP::twopi*Flat(rndm));
+  const G4double value = mean + t*std::sqrt(mean) + 0.5;
+  if(value < 0.) { return 0; }
+  return (value >= 2.e+9) ? G4long(2.e+9) : G4long(value);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 #endif
 
@@ -45,6 +45,17 @@
 //
 // Implementation of the model of multiple scattering based on
 // H.W.Lewis Phys Rev 78 (1950) 526 and L.Urban model
+//
+// In the tabulated mode, the width theta0/sqrt(tau) and the tail
+// parameter of the angular distribution of e+- are tabulated per
+// material on a grid of log(E) and log(tau), 8 nodes per decade each,
+// and interpolated bilinearly; other parameters of the distribution
+// are computed from them, so <cos(theta)> = exp(-tau) is kept as in the
+// analytic sampling. The Kolmogorov distance between tabulated and
+// analytic distributions of cos(theta) is below 1% for theta0 > 1e-4 rad.
+// Steps with significant energy loss, extremely small steps and cells
+// of the grid where the model falls back to its simple distribution
+// are sampled analytically.
 
 // -------------------------------------------------------------------
 //
@@ -104,6 +115,8 @@ public:
 
   inline void SetPositronCorrection(const G4bool val);
 
+  inline void SetTabulatedSampling(const G4bool val);
+
   //  hide assignment operator
   G4UrbanMscModel & operator=(const  G4UrbanMscModel &right) = delete;
   G4UrbanMscModel(const  G4UrbanMscModel&) = delete;
@@ -118,6 +131,14 @@ private:
 
   void InitialiseModelCache();
 
+  void BuildAngularTables();
+
+  G4bool SampleTabulatedCosTheta(G4double tau, G4double& cth);
+
+  G4double SampleMixedCosTheta(G4double x, G4double xsi, G4double c,
+                               G4double ea, G4double eaa, G4double d,
+                               G4double prob, G4double qprob);
+
   inline void SetParticle(const G4ParticleDefinition*);
 
   inline G4double Randomizetlimit();
@@ -188,6 +209,17 @@ private:
   };
   static std::vector<mscData*> msc;
 
+  // nodes of the tables of angular distribution for e+- per material,
+  // pairs of theta0/sqrt(tau) and tail parameter; the tail parameter
+  // is negative if the node cannot be used
+  struct mscAngTable {
+    G4double logEmin, invLogEstep;
+    G4double logTaumin, invLogTaustep;
+    G4int nE, nTau;
+    std::vector<G4double> data;
+  };
+  static std::vector<mscAngTable*> angTable;
+
   // index of G4MaterialCutsCouple
   G4int idx = 0;
 
@@ -198,6 +230,8 @@ private:
   G4bool dispAlg96 = true;
   G4bool fPosiCorrection = true;
   G4bool isFirstInstance = false;
+  G4bool fTabSampling = false;
+  G4bool isTableOwner = false;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -278,5 +312,12 @@ inline void G4UrbanMscModel::SetPositronCorrection(const G4bool val)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+inline void G4UrbanMscModel::SetTabulatedSampling(const G4bool val)
+{
+  fTabSampling = val;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 #endif
 
@@ -120,6 +120,10 @@ public:
   //  - nothing happens if it has already been initialised for that Z.
   void InitialiseForZ(std::size_t iz);
 
+  // initialise for a list of atomic numbers: data of the different Z are
+  // loaded in parallel if a thread pool is available (master only)
+  void InitialiseForZ(const std::vector<G4int>& zets);
+
   // Computes the elastic, first and second cross sections for the given kinetic
   // energy and target atom.
   // Cross sections are zero ff ekin is below/above the kinetic energy grid
@@ -54,12 +54,18 @@
 #include "G4ElementVector.hh"
 #include "G4Element.hh"
 #include "G4EmParameters.hh"
+#include "G4AutoLock.hh"
+#include "G4TaskDispatcher.hh"
 
 #include <iostream>
 #include <fstream>
 #include <cmath>
 #include <algorithm>
 
+namespace
+{
+  G4Mutex theGSMottMutex = G4MUTEX_INITIALIZER;
+}
 
 const std::string G4GSMottCorrection::gElemSymbols[] = {"H","He","Li","Be","B" ,
  "C" ,"N" ,"O" ,"F" ,"Ne","Na","Mg","Al","Si","P" , "S","Cl","Ar","K" ,"Ca","Sc",
@@ -106,12 +112,18 @@ void G4GSMottCorrection::GetMottCorrectionFactors(G4double logekin, G4double bet
     remRfaction  -= ekinIndxLow;
   } // the defaults otherwise i.e. use the lowest energy values when ekin is smaller than the minum ekin
   //
-  DataPerEkin *perEkinLow  = fMCDataPerMaterial[matindx]->fDataPerEkin[ekinIndxLow];
+  // data of this material are initialised at the first use if not done yet
+  DataPerMaterial *perMat  = fMCDataPerMaterial[matindx].load(std::memory_order_acquire);
+  if (!perMat) {
+    InitMCDataMaterial((*G4Material::GetMaterialTable())[matindx]);
+    perMat = fMCDataPerMaterial[matindx].load(std::memory_order_acquire);
+  }
+  DataPerEkin *perEkinLow  = perMat->fDataPerEkin[ekinIndxLow];
   mcToScr      = perEkinLow->fMCScreening;
   mcToQ1       = perEkinLow->fMCFirstMoment;
   mcToG2PerG1  = perEkinLow->fMCSecondMoment;
   if (remRfaction>0.) {
-    DataPerEkin *perEkinHigh = fMCDataPerMaterial[matindx]->fDataPerEkin[ekinIndxLow+1];
+    DataPerEkin *perEkinHigh = perMat->fDataPerEkin[ekinIndxLow+1];
     mcToScr      += remRfaction*(perEkinHigh->fMCScreening    - perEkinLow->fMCScreening);
     mcToQ1       += remRfaction*(perEkinHigh->fMCFirstMoment  - perEkinLow->fMCFirstMoment);
     mcToG2PerG1  += remRfaction*(perEkinHigh->fMCSecondMoment - perEkinLow->fMCSecondMoment);
@@ -169,8 +181,14 @@ double G4GSMottCorrection::GetMottRejectionValue(G4double logekin, G4double beta
     deltindx = deltIndxLow;
   }
   //
-  // get the corresponding distribution
-  DataPerDelta *perDelta  = fMCDataPerMaterial[matindx]->fDataPerEkin[ekindx]->fDataPerDelta[deltindx];
+  // get the corresponding distribution (data of this material are initialised
+  // at the first use if not done yet)
+  DataPerMaterial *perMat = fMCDataPerMaterial[matindx].load(std::memory_order_acquire);
+  if (!perMat) {
+    InitMCDataMaterial((*G4Material::GetMaterialTable())[matindx]);
+    perMat = fMCDataPerMaterial[matindx].load(std::memory_order_acquire);
+  }
+  DataPerDelta *perDelta  = perMat->fDataPerEkin[ekindx]->fDataPerDelta[deltindx];
   //
   // determine lower index of the angular bin
   G4double ang         = std::sqrt(0.5*(1.-cost)); // sin(0.5\theta) in [0,1]
@@ -190,9 +208,10 @@ double G4GSMottCorrection::GetMottRejectionValue(G4double logekin, G4double beta
 void G4GSMottCorrection::Initialise() {
   // load Mott-correction data for each elements that belongs to materials that are used in the detector
   InitMCDataPerElement();
-  // clrea Mott-correction data per material
+  // clear Mott-correction data per material
   ClearMCDataPerMaterial();
   // initialise Mott-correction data for the materials that are used in the detector
+  // (data of other materials are initialised at their first use)
   InitMCDataPerMaterials();
 }
 
@@ -206,6 +225,8 @@ void G4GSMottCorrection::InitMCDataPerElement() {
   // corresponding data has not been loaded yet
   G4ProductionCutsTable *thePCTable = G4ProductionCutsTable::GetProductionCutsTable();
   G4int numMatCuts = (G4int)thePCTable->GetTableSize();
+  std::vector<const G4Element*> elemsToLoad;
+  std::vector<G4bool> isToLoad(gMaxZet+1, false);
   for (G4int imc=0; imc<numMatCuts; ++imc) {
     const G4MaterialCutsCouple *matCut = thePCTable->GetMaterialCutsCouple(imc);
     if (!matCut->IsUsed()) {
@@ -221,33 +242,52 @@ void G4GSMottCorrection::InitMCDataPerElement() {
       if (izet>gMaxZet) {
         izet = gMaxZet;
       }
-      if (!fMCDataPerElement[izet]) {
-        LoadMCDataElement(elem);
+      if (!fMCDataPerElement[izet] && !isToLoad[izet]) {
+        isToLoad[izet] = true;
+        elemsToLoad.push_back(elem);
       }
     }
   }
+  // data files of the elements are read in parallel if a thread pool is
+  // available: each element fills its own slot of the container
+  G4TaskDispatcher::Execute((G4int)elemsToLoad.size(), [&](G4int i) {
+    LoadMCDataElement(elemsToLoad[i]);
+  });
 }
 
 
 void G4GSMottCorrection::InitMCDataPerMaterials() {
-  // prepare size of the container
+  // prepare size of the container (atomics cannot be moved, so the container
+  // is replaced by a new one of the required size)
   std::size_t numMaterials = G4Material::GetNumberOfMaterials();
   if (fMCDataPerMaterial.size()!=numMaterials) {
-    fMCDataPerMaterial.resize(numMaterials);
+    std::vector<std::atomic<DataPerMaterial*>> dataPerMaterial(numMaterials);
+    for (auto& data : dataPerMaterial) {
+      data.store(nullptr, std::memory_order_relaxed);
+    }
+    fMCDataPerMaterial.swap(dataPerMaterial);
   }
   // init. Mott-correction data for the Materials that are used in the geometry
   G4ProductionCutsTable *thePCTable = G4ProductionCutsTable::GetProductionCutsTable();
   G4int numMatCuts = (G4int)thePCTable->GetTableSize();
+  std::vector<const G4Material*> matsToInit;
+  std::vector<G4bool> isToInit(numMaterials, false);
   for (G4int imc=0; imc<numMatCuts; ++imc) {
     const G4MaterialCutsCouple *matCut = thePCTable->GetMaterialCutsCouple(imc);
     if (!matCut->IsUsed()) {
       continue;
     }
     const G4Material *mat = matCut->GetMaterial();
-    if (!fMCDataPerMaterial[mat->GetIndex()]) {
-      InitMCDataMaterial(mat);
+    if (!fMCDataPerMaterial[mat->GetIndex()].load(std::memory_order_relaxed) && !isToInit[mat->GetIndex()]) {
+      isToInit[mat->GetIndex()] = true;
+      matsToInit.push_back(mat);
     }
   }
+  // materials are independent: each fills its own slot of the container
+  G4TaskDispatcher::Execute((G4int)matsToInit.size(), [&](G4int i) {
+    const G4Material *mat = matsToInit[i];
+    fMCDataPerMaterial[mat->GetIndex()].store(ComputeMCDataMaterial(mat), std::memory_order_release);
+  });
 }
 
 
@@ -260,7 +300,6 @@ void G4GSMottCorrection::LoadMCDataElement(const G4Element *elem) {
   }
   auto perElem = new DataPerMaterial();
   AllocateDataPerMaterial(perElem);
-  fMCDataPerElement[izet]  = perElem;
   //
   // load data from file
   std::string path = G4EmParameters::Instance()->GetDirLEDATA();
@@ -293,6 +332,7 @@ void G4GSMottCorrection::LoadMCDataElement(const G4Element *elem) {
       infile >> perDelta->fSD;
     }
   }
+  fMCDataPerElement[izet]  = perElem;
 }
 
 // uncompress one data file into the input string stream
@@ -340,7 +380,30 @@ void G4GSMottCorrection::ReadCompressedFile(std::string fname, std::istringstrea
 }
 
 
+// it's called at the first use of the material, possibly by several threads
 void G4GSMottCorrection::InitMCDataMaterial(const G4Material *mat) {
+  G4AutoLock l(&theGSMottMutex);
+  // may be initialised by another thread in the meantime
+  if (fMCDataPerMaterial[mat->GetIndex()].load(std::memory_order_acquire)) {
+    return;
+  }
+  // load data of the elements if not yet done
+  const G4ElementVector* elemVect = mat->GetElementVector();
+  const G4int            numElems = (G4int)mat->GetNumberOfElements();
+  for (G4int ielem=0; ielem<numElems; ++ielem) {
+    const G4Element *elem = (*elemVect)[ielem];
+    if (!fMCDataPerElement[std::min(elem->GetZasInt(),gMaxZet)]) {
+      LoadMCDataElement(elem);
+    }
+  }
+  // data are complete when published and may be used by all threads
+  fMCDataPerMaterial[mat->GetIndex()].store(ComputeMCDataMaterial(mat), std::memory_order_release);
+}
+
+
+// data of the elements of the material must be loaded
+G4GSMottCorrection::DataPerMaterial*
+G4GSMottCorrection::ComputeMCDataMaterial(const G4Material *mat) {
   constexpr G4double const1   = 7821.6;      // [cm2/g]
   constexpr G4double const2   = 0.1569;      // [cm2 MeV2 / g]
   constexpr G4double finstrc2 = 5.325135453E-5; // fine-structure const. square
@@ -350,7 +413,6 @@ void G4GSMottCorrection::InitMCDataMaterial(const G4Material *mat) {
   // allocate memory
   auto perMat = new DataPerMaterial();
   AllocateDataPerMaterial(perMat);
-  fMCDataPerMaterial[mat->GetIndex()] = perMat;
   //
   const G4ElementVector* elemVect           = mat->GetElementVector();
   const G4int            numElems           = (G4int)mat->GetNumberOfElements();
@@ -494,6 +556,7 @@ void G4GSMottCorrection::InitMCDataMaterial(const G4Material *mat) {
       }
     }
   }
+  return perMat;
 }
 
 
@@ -538,9 +601,10 @@ void G4GSMottCorrection::ClearMCDataPerElement() {
 
 void G4GSMottCorrection::ClearMCDataPerMaterial() {
   for (std::size_t i=0; i<fMCDataPerMaterial.size(); ++i) {
-    if (fMCDataPerMaterial[i]) {
-      DeAllocateDataPerMaterial(fMCDataPerMaterial[i]);
-      delete fMCDataPerMaterial[i];
+    DataPerMaterial *perMat = fMCDataPerMaterial[i].load(std::memory_order_relaxed);
+    if (perMat) {
+      DeAllocateDataPerMaterial(perMat);
+      delete perMat;
     }
   }
   fMCDataPerMaterial.clear();
@@ -88,6 +88,7 @@
 #include "G4MaterialCutsCouple.hh"
 #include "G4ProductionCutsTable.hh"
 #include "G4EmParameters.hh"
+#include "G4TaskDispatcher.hh"
 
 #include "G4String.hh"
 
@@ -437,8 +438,18 @@ G4GoudsmitSaundersonTable::GSMSCAngularDtr* G4GoudsmitSaundersonTable::GetGSAngu
 
 void G4GoudsmitSaundersonTable::LoadMSCData() {
   gGSMSCAngularDistributions1.resize(gLAMBNUM*gQNUM1,nullptr);
-  const G4String str1 = G4EmParameters::Instance()->GetDirLEDATA() + "/msc_GS/GSGrid_1/gsDistr_";
-  for (G4int il=0; il<gLAMBNUM; ++il) {
+  gGSMSCAngularDistributions2.resize(gLAMBNUM*gQNUM2,nullptr);
+  // one file per s/lambda_el value and grid: files are read in parallel if a
+  // thread pool is available, each filling its own slots of the containers
+  G4TaskDispatcher::Execute(2*gLAMBNUM, [this](G4int i) {
+    LoadMSCDataFile(i/gLAMBNUM, i%gLAMBNUM);
+  });
+}
+
+
+void G4GoudsmitSaundersonTable::LoadMSCDataFile(G4int igrid, G4int il) {
+  if (igrid==0) {
+    const G4String str1 = G4EmParameters::Instance()->GetDirLEDATA() + "/msc_GS/GSGrid_1/gsDistr_";
     G4String fname = str1 + std::to_string(il);
     std::ifstream infile(fname,std::ios::in);
     if (!infile.is_open()) {
@@ -463,43 +474,41 @@ void G4GoudsmitSaundersonTable::LoadMSCData() {
       gGSMSCAngularDistributions1[il*gQNUM1+iq] = gsd;
     }
     infile.close();
+    return;
   }
   //
   // second grid
-  gGSMSCAngularDistributions2.resize(gLAMBNUM*gQNUM2,nullptr);
   const G4String str2 = G4EmParameters::Instance()->GetDirLEDATA() + "/msc_GS/GSGrid_2/gsDistr_";
-  for (G4int il=0; il<gLAMBNUM; ++il) {
-    G4String fname = str2 + std::to_string(il);
-    std::ifstream infile(fname,std::ios::in);
-    if (!infile.is_open()) {
-      G4String msgc = "Cannot open file: " + fname;
-      G4Exception("G4GoudsmitSaundersonTable::LoadMSCData()","em0006",
-	 	  FatalException, msgc.c_str());
-      return;
-    }
-    for (G4int iq=0; iq<gQNUM2; ++iq) {
-      G4int numData;
-      infile >> numData;
-      if (numData>1) {
-        auto gsd = new GSMSCAngularDtr();
-        gsd->fNumData = numData;
-        gsd->fUValues = new G4double[gsd->fNumData]();
-        gsd->fParamA  = new G4double[gsd->fNumData]();
-        gsd->fParamB  = new G4double[gsd->fNumData]();
-        double ddummy;
-        infile >> ddummy; infile >> ddummy;
-        for (G4int i=0; i<gsd->fNumData; ++i) {
-          infile >> gsd->fUValues[i];
-          infile >> gsd->fParamA[i];
-          infile >> gsd->fParamB[i];
-        }
-        gGSMSCAngularDistributions2[il*gQNUM2+iq] = gsd;
-      } else {
-        gGSMSCAngularDistributions2[il*gQNUM2+iq] = nullptr;
+  G4String fname = str2 + std::to_string(il);
+  std::ifstream infile(fname,std::ios::in);
+  if (!infile.is_open()) {
+    G4String msgc = "Cannot open file: " + fname;
+    G4Exception("G4GoudsmitSaundersonTable::LoadMSCData()","em0006",
+	 	FatalException, msgc.c_str());
+    return;
+  }
+  for (G4int iq=0; iq<gQNUM2; ++iq) {
+    G4int numData;
+    infile >> numData;
+    if (numData>1) {
+      auto gsd = new GSMSCAngularDtr();
+      gsd->fNumData = numData;
+      gsd->fUValues = new G4double[gsd->fNumData]();
+      gsd->fParamA  = new G4double[gsd->fNumData]();
+      gsd->fParamB  = new G4double[gsd->fNumData]();
+      double ddummy;
+      infile >> ddummy; infile >> ddummy;
+      for (G4int i=0; i<gsd->fNumData; ++i) {
+        infile >> gsd->fUValues[i];
+        infile >> gsd->fParamA[i];
+        infile >> gsd->fParamB[i];
       }
+      gGSMSCAngularDistributions2[il*gQNUM2+iq] = gsd;
+    } else {
+      gGSMSCAngularDistributions2[il*gQNUM2+iq] = nullptr;
     }
-    infile.close();
   }
+  infile.close();
 }
 
 // samples cost in single scattering based on Screened-Rutherford DCS
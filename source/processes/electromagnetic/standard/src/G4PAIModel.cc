@@ -171,11 +171,12 @@ void G4PAIModel::Initialise(const G4ParticleDefinition* p,
 	  // G4cout << "   isNew: " << isnew << "  " << cutCouple << G4endl;
 	  if(isnew) { 
 	    fMaterialCutsCoupleVector.push_back(cutCouple); 
-	    fModelData->Initialise(cutCouple, this);
 	  }
 	}
       }
     }
+    // tables of all couples are built together
+    fModelData->Initialise(fMaterialCutsCoupleVector, this);
     InitialiseElementSelectors(p, cuts);
   }
 }
@@ -47,21 +47,23 @@
 #include "G4PhysicsTable.hh"
 #include "G4MaterialCutsCouple.hh"
 #include "G4SandiaTable.hh"
+#include "G4TaskDispatcher.hh"
 #include "Randomize.hh"
 #include "G4Poisson.hh"
 
+#include <memory>
+
 ////////////////////////////////////////////////////////////////////////
 
 using namespace std;
 
 G4PAIModelData::G4PAIModelData(G4double tmin, G4double tmax, G4int ver)
+  : fVerbose(ver)
 { 
   const G4int nPerDecade = 10; 
   const G4double lowestTkin = 50*keV;
   const G4double highestTkin = 10*TeV;
 
-  fPAIySection.SetVerbose(ver);
-
   fLowestKineticEnergy  = std::max(tmin, lowestTkin);
   fHighestKineticEnergy = tmax;
   if(tmax < 10*fLowestKineticEnergy) { 
@@ -110,8 +112,47 @@ G4PAIModelData::~G4PAIModelData()
 void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
                                 G4PAIModel* model)
 {
-  const G4Material* mat = couple->GetMaterial();     
-  fSandia.Initialize(const_cast<G4Material*>(mat));
+  std::vector<const G4MaterialCutsCouple*> couples(1, couple);
+  Initialise(couples, model);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::Initialise(
+     const std::vector<const G4MaterialCutsCouple*>& couples,
+     G4PAIModel* model)
+{
+  // the model is not thread safe, so maximal energy transfers
+  // are computed before tables are built
+  std::vector<G4double> transferMax(fTotBin+1);
+  for (G4int i = 0; i <= fTotBin; ++i) {
+    transferMax[i] = model->ComputeMaxEnergy(fParticleEnergyVector->Energy(i));
+  }
+
+  // each couple fills its own slot of the banks, so the result does
+  // not depend on the order in which the tables are built
+  std::size_t n0 = fPAIxscBank.size();
+  std::size_t n = couples.size();
+  fPAIxscBank.resize(n0 + n, nullptr);
+  fPAIdEdxBank.resize(n0 + n, nullptr);
+  fdEdxTable.resize(n0 + n, nullptr);
+
+  G4TaskDispatcher::Execute((G4int)n, [&](G4int i) {
+    BuildCoupleData(n0 + i, couples[i]->GetMaterial(), transferMax);
+  });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::BuildCoupleData(std::size_t idx, const G4Material* mat,
+                                     const std::vector<G4double>& transferMax)
+{
+  // working objects are local, as tables of several couples
+  // may be built at the same time
+  G4SandiaTable sandia;
+  sandia.Initialize(mat);
+  auto ySection = std::make_unique<G4PAIySection>();
+  ySection->SetVerbose(fVerbose);
 
   auto PAItransferTable = new G4PhysicsTable(fTotBin+1);
   auto PAIdEdxTable = new G4PhysicsTable(fTotBin+1);
@@ -120,29 +161,29 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
 			   fHighestKineticEnergy,
 			   fTotBin);
   // low energy Sandia interval
-  G4double Tmin = fSandia.GetSandiaMatTablePAI(0,0); 
+  G4double Tmin = sandia.GetSandiaMatTablePAI(0,0); 
 
   // energy safety
-  static const G4double deltaLow = 100.*eV; 
+  const G4double deltaLow = 100.*eV; 
 
   for (G4int i = 0; i <= fTotBin; ++i) {
 
     G4double kinEnergy = fParticleEnergyVector->Energy(i);
-    G4double Tmax = model->ComputeMaxEnergy(kinEnergy);
+    G4double Tmax = transferMax[i];
     G4double tau = kinEnergy/proton_mass_c2;
     G4double bg2 = tau*( tau + 2. );
 
     if (Tmax < Tmin + deltaLow ) { Tmax = Tmin + deltaLow; }
 
-    fPAIySection.Initialize(mat, Tmax, bg2, &fSandia);
+    ySection->Initialize(mat, Tmax, bg2, &sandia);
     
     //G4cout << i << ". TransferMax(keV)= "<< Tmax/keV  
     //	   << "  E(MeV)= " << kinEnergy/MeV << G4endl;
     
-    G4int n = fPAIySection.GetSplineSize();
+    G4int n = ySection->GetSplineSize();
     G4int kmin = 0;
     for(G4int k = 0; k < n; ++k) {
-      if(fPAIySection.GetIntegralPAIySection(k+1) <= 0.0) { 
+      if(ySection->GetIntegralPAIySection(k+1) <= 0.0) { 
 	kmin = k;
       } else {
 	break;
@@ -157,32 +198,32 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
     G4double tr = 0.0;
     for(G4int k = kmin; k < n; ++k)
     {
-      G4double t  = fPAIySection.GetSplineEnergy(k+1);
-      tr = fPAIySection.GetIntegralPAIySection(k+1);
+      G4double t  = ySection->GetSplineEnergy(k+1);
+      tr = ySection->GetIntegralPAIySection(k+1);
       //if(tr >= tr0) { tr0 = tr; }
       //else { G4cout << "G4PAIModelData::Initialise Warning: Ekin(MeV)= "
       //		    << t/MeV << " IntegralTransfer= " << tr 
       //		    << " < " << tr0 << G4endl; }
       transferVector->PutValue(k, t, t*tr);
-      dEdxVector->PutValue(k, t, fPAIySection.GetIntegralPAIdEdx(k+1));
+      dEdxVector->PutValue(k, t, ySection->GetIntegralPAIdEdx(k+1));
     }
     //G4cout << "TransferVector:" << G4endl;
     //G4cout << *transferVector << G4endl;
     //G4cout << "DEDXVector:" << G4endl;
     //G4cout << *dEdxVector << G4endl;
 
-    G4double ionloss = std::max(fPAIySection.GetMeanEnergyLoss(), 0.0);//  total <dE/dx>
+    G4double ionloss = std::max(ySection->GetMeanEnergyLoss(), 0.0);//  total <dE/dx>
     dEdxMeanVector->PutValue(i,ionloss);
 
     PAItransferTable->insertAt(i,transferVector);
     PAIdEdxTable->insertAt(i,dEdxVector);
 
   } // end of Tkin loop`
-  fPAIxscBank.push_back(PAItransferTable);
-  fPAIdEdxBank.push_back(PAIdEdxTable);
+  fPAIxscBank[idx] = PAItransferTable;
+  fPAIdEdxBank[idx] = PAIdEdxTable;
   //G4cout << "dEdxMeanVector: " << G4endl;
   //G4cout << *dEdxMeanVector << G4endl;
-  fdEdxTable.push_back(dEdxMeanVector);
+  fdEdxTable[idx] = dEdxMeanVector;
 }
 
 //////////////////////////////////////////////////////////////////////////////
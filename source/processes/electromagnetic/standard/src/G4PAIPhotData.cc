@@ -48,9 +48,12 @@
 #include "G4MaterialCutsCouple.hh"
 #include "G4ProductionCutsTable.hh"
 #include "G4SandiaTable.hh"
+#include "G4TaskDispatcher.hh"
 #include "Randomize.hh"
 #include "G4Poisson.hh"
 
+#include <memory>
+
 ////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -61,7 +64,7 @@ G4PAIPhotData::G4PAIPhotData(G4double tmin, G4double tmax, G4int ver)
   const G4double lowestTkin  = 50*keV;
   const G4double highestTkin = 10*TeV;
 
-  // fPAIxSection.SetVerbose(ver);
+  // xSection->SetVerbose(ver);
 
   fLowestKineticEnergy  = std::max(tmin, lowestTkin);
   fHighestKineticEnergy = tmax;
@@ -125,6 +128,50 @@ G4PAIPhotData::~G4PAIPhotData()
 
 void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
                                 G4double cut, G4PAIPhotModel* model)
+{
+  std::vector<const G4MaterialCutsCouple*> couples(1, couple);
+  std::vector<G4double> cuts(1, cut);
+  Initialise(couples, cuts, model);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIPhotData::Initialise(
+     const std::vector<const G4MaterialCutsCouple*>& couples,
+     const std::vector<G4double>& cuts, G4PAIPhotModel* model)
+{
+  // the model is not thread safe, so maximal energy transfers
+  // are computed before tables are built
+  std::vector<G4double> transferMax(fTotBin+1);
+  for (G4int i = 0; i <= fTotBin; ++i) {
+    transferMax[i] = model->ComputeMaxEnergy(fParticleEnergyVector->Energy(i));
+  }
+
+  // each couple fills its own slot of the banks, so the result does
+  // not depend on the order in which the tables are built
+  std::size_t n0 = fPAIxscBank.size();
+  std::size_t n = couples.size();
+  fPAIxscBank.resize(n0 + n, nullptr);
+  fPAIphotonBank.resize(n0 + n, nullptr);
+  fPAIplasmonBank.resize(n0 + n, nullptr);
+  fPAIdEdxBank.resize(n0 + n, nullptr);
+  fdEdxTable.resize(n0 + n, nullptr);
+  fdNdxCutTable.resize(n0 + n, nullptr);
+  fdNdxCutPhotonTable.resize(n0 + n, nullptr);
+  fdNdxCutPlasmonTable.resize(n0 + n, nullptr);
+  fdEdxCutTable.resize(n0 + n, nullptr);
+
+  G4TaskDispatcher::Execute((G4int)n, [&](G4int i) {
+    BuildCoupleData(n0 + i, couples[i], cuts[i], transferMax);
+  });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIPhotData::BuildCoupleData(std::size_t idx,
+                                    const G4MaterialCutsCouple* couple,
+                                    G4double cut,
+                                    const std::vector<G4double>& transferMax)
 {
   G4ProductionCutsTable* theCoupleTable=
         G4ProductionCutsTable::GetProductionCutsTable();
@@ -166,8 +213,12 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 			   fHighestKineticEnergy,
 			   fTotBin);
 
+  // working objects are local, as tables of several couples
+  // may be built at the same time
   const G4Material* mat = couple->GetMaterial();     
-  fSandia.Initialize(const_cast<G4Material*>(mat));
+  G4SandiaTable sandia;
+  sandia.Initialize(mat);
+  auto xSection = std::make_unique<G4PAIxSection>();
 
   auto PAItransferTable = new G4PhysicsTable(fTotBin+1);
   auto PAIphotonTable = new G4PhysicsTable(fTotBin+1);
@@ -180,7 +231,7 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 			   fTotBin);
 
   // low energy Sandia interval
-  G4double Tmin = fSandia.GetSandiaMatTablePAI(0,0); 
+  G4double Tmin = sandia.GetSandiaMatTablePAI(0,0); 
 
   // energy safety
   const G4double deltaLow = 100.*eV; 
@@ -188,18 +239,18 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
   for (G4int i = 0; i <= fTotBin; ++i) 
   {
     G4double kinEnergy = fParticleEnergyVector->Energy(i);
-    G4double Tmax = model->ComputeMaxEnergy(kinEnergy);
+    G4double Tmax = transferMax[i];
     G4double tau = kinEnergy/proton_mass_c2;
     G4double bg2 = tau*( tau + 2. );
 
     if ( Tmax < Tmin + deltaLow ) Tmax = Tmin + deltaLow; 
 
-    fPAIxSection.Initialize( mat, Tmax, bg2, &fSandia);
+    xSection->Initialize( mat, Tmax, bg2, &sandia);
 
     //G4cout << i << ". TransferMax(keV)= "<< Tmax/keV << "  cut(keV)= " 
     //	   << cut/keV << "  E(MeV)= " << kinEnergy/MeV << G4endl;
 
-    G4int n = fPAIxSection.GetSplineSize();
+    G4int n = xSection->GetSplineSize();
 
     auto transferVector = new G4PhysicsFreeVector(n);
     auto photonVector   = new G4PhysicsFreeVector(n);
@@ -209,20 +260,20 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 
     for( G4int k = 0; k < n; k++ )
     {
-      G4double t = fPAIxSection.GetSplineEnergy(k+1);
+      G4double t = xSection->GetSplineEnergy(k+1);
 
       transferVector->PutValue(k , t, 
-                               t*fPAIxSection.GetIntegralPAIxSection(k+1));
+                               t*xSection->GetIntegralPAIxSection(k+1));
       photonVector->PutValue(k , t, 
-                               t*fPAIxSection.GetIntegralCerenkov(k+1));
+                               t*xSection->GetIntegralCerenkov(k+1));
       plasmonVector->PutValue(k , t, 
-                               t*fPAIxSection.GetIntegralPlasmon(k+1));
+                               t*xSection->GetIntegralPlasmon(k+1));
 
-      dEdxVector->PutValue(k, t, fPAIxSection.GetIntegralPAIdEdx(k+1));
+      dEdxVector->PutValue(k, t, xSection->GetIntegralPAIdEdx(k+1));
     }
     // G4cout << *transferVector << G4endl;
 
-    G4double ionloss = std::max(fPAIxSection.GetMeanEnergyLoss(), 0.0);//  total <dE/dx>
+    G4double ionloss = std::max(xSection->GetMeanEnergyLoss(), 0.0);//  total <dE/dx>
     dEdxMeanVector->PutValue(i,ionloss);
 
     G4double dNdxCut = transferVector->Value(deltaCutInKineticEnergyNow)/deltaCutInKineticEnergyNow;
@@ -249,18 +300,18 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 
   } // end of Tkin loop
 
-  fPAIxscBank.push_back(PAItransferTable);
-  fPAIphotonBank.push_back(PAIphotonTable);
-  fPAIplasmonBank.push_back(PAIplasmonTable);
+  fPAIxscBank[idx] = PAItransferTable;
+  fPAIphotonBank[idx] = PAIphotonTable;
+  fPAIplasmonBank[idx] = PAIplasmonTable;
 
-  fPAIdEdxBank.push_back(PAIdEdxTable);
-  fdEdxTable.push_back(dEdxMeanVector);
+  fPAIdEdxBank[idx] = PAIdEdxTable;
+  fdEdxTable[idx] = dEdxMeanVector;
 
-  fdNdxCutTable.push_back(dNdxCutVector);
-  fdNdxCutPhotonTable.push_back(dNdxCutPhotonVector);
-  fdNdxCutPlasmonTable.push_back(dNdxCutPlasmonVector);
+  fdNdxCutTable[idx] = dNdxCutVector;
+  fdNdxCutPhotonTable[idx] = dNdxCutPhotonVector;
+  fdNdxCutPlasmonTable[idx] = dNdxCutPlasmonVector;
 
-  fdEdxCutTable.push_back(dEdxCutVector);
+  fdEdxCutTable[idx] = dEdxCutVector;
 }
 
 //////////////////////////////////////////////////////////////////////////////
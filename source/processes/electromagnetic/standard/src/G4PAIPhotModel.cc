@@ -124,6 +124,7 @@ void G4PAIPhotModel::Initialise(const G4ParticleDefinition* p,
 				 ->GetRegion("DefaultRegionForTheWorld", false));
       numRegions = 1;
     }
+    std::vector<G4double> deltaCutInKinEnergy;
 
     for( size_t iReg = 0; iReg < numRegions; ++iReg ) 
     {
@@ -162,12 +163,14 @@ void G4PAIPhotModel::Initialise(const G4ParticleDefinition* p,
 	  // initialise data banks
 	  if(isnew) {
 	    fMaterialCutsCoupleVector.push_back(cutCouple);
-	    G4double deltaCutInKinEnergy = cuts[cutCouple->GetIndex()];
-	    fModelData->Initialise(cutCouple, deltaCutInKinEnergy, this);
+	    deltaCutInKinEnergy.push_back(cuts[cutCouple->GetIndex()]);
 	  }
 	}
       }
     }
+    // tables of all couples are built together
+    fModelData->Initialise(fMaterialCutsCoupleVector, deltaCutInKinEnergy,
+                           this);
     InitialiseElementSelectors(p, cuts);
   }
 }
@@ -48,6 +48,7 @@
 #include "G4MaterialCutsCouple.hh"
 #include "Randomize.hh"
 #include "G4EmParameters.hh"
+#include "G4AutoLock.hh"
 
 #include "G4String.hh"
 
@@ -61,6 +62,11 @@
 #include <sstream>
 #include <algorithm>
 
+namespace
+{
+  G4Mutex theSBTableMutex = G4MUTEX_INITIALIZER;
+}
+
 G4SBBremTable::G4SBBremTable()
  : fMaxZet(-1), fNumElEnergy(-1), fNumKappa(-1), fUsedLowEenergy(-1.),
    fUsedHighEenergy(-1.), fLogMinElEnergy(-1.), fILDeltaElEnergy(-1.)
@@ -97,6 +103,10 @@ double G4SBBremTable::SampleEnergyTransfer(const G4double eekin,
   // if (eekin<=gcut) return kappa;
   const G4double lElEnergy     = leekin;
   const SamplingTablePerZ* stZ = fSBSamplingTables[izet];
+  // sampling tables of this Z are loaded at the first use
+  if (!stZ->fIsLoaded) {
+    LoadSamplingTables(izet);
+  }
   // get the gamma cut of this Z that corresponds to the current mat-cuts
   const std::size_t gamCutIndx = stZ->fMatCutIndxToGamCutIndx[matCutIndx];
   // gcut was not found: should never happen (only in verbose mode)
@@ -261,78 +271,67 @@ void G4SBBremTable::InitSamplingTables() {
   for (G4int iz=1; iz<fMaxZet+1; ++iz) {
     SamplingTablePerZ* stZ = fSBSamplingTables[iz];
     if (!stZ) continue;
-    // Load-in sampling table data:
-    LoadSamplingTables(iz);
-    // init data
-    for (G4int iee=0; iee<fNumElEnergy; ++iee) {
-      if (!stZ->fTablesPerEnergy[iee])
-        continue;
-      const G4double elEnergy = fElEnergyVect[iee];
-      // 1 indicates that gamma production is not possible at this e- energy
-      stZ->fTablesPerEnergy[iee]->fCumCutValues.resize(stZ->fNumGammaCuts,1.);
-      // sort gamma cuts and other members accordingly
-      for (std::size_t i=0; i<stZ->fNumGammaCuts-1; ++i) {
-        for (std::size_t j=i+1; j<stZ->fNumGammaCuts; ++j) {
-          if (stZ->fGammaECuts[j]<stZ->fGammaECuts[i]) {
-            G4double dum0                   = stZ->fGammaECuts[i];
-            G4double dum1                   = stZ->fLogGammaECuts[i];
-            std::vector<std::size_t>   dumv = stZ->fGamCutIndxToMatCutIndx[i];
-            stZ->fGammaECuts[i]             = stZ->fGammaECuts[j];
-            stZ->fLogGammaECuts[i]          = stZ->fLogGammaECuts[j];
-            stZ->fGamCutIndxToMatCutIndx[i] = stZ->fGamCutIndxToMatCutIndx[j];
-            stZ->fGammaECuts[j]             = dum0;
-            stZ->fLogGammaECuts[j]          = dum1;
-            stZ->fGamCutIndxToMatCutIndx[j] = dumv;
-          }
-        }
-      }
-      // set couple indices to store the corresponding gamma cut index
-      stZ->fMatCutIndxToGamCutIndx.resize(numMatCuts,-1);
-      for (std::size_t i=0; i<stZ->fGamCutIndxToMatCutIndx.size(); ++i) {
-        for (std::size_t j=0; j<stZ->fGamCutIndxToMatCutIndx[i].size(); ++j) {
-          stZ->fMatCutIndxToGamCutIndx[stZ->fGamCutIndxToMatCutIndx[i][j]] = i;
+    // sort gamma cuts and other members accordingly
+    for (std::size_t i=0; i<stZ->fNumGammaCuts-1; ++i) {
+      for (std::size_t j=i+1; j<stZ->fNumGammaCuts; ++j) {
+        if (stZ->fGammaECuts[j]<stZ->fGammaECuts[i]) {
+          G4double dum0                   = stZ->fGammaECuts[i];
+          G4double dum1                   = stZ->fLogGammaECuts[i];
+          std::vector<std::size_t>   dumv = stZ->fGamCutIndxToMatCutIndx[i];
+          stZ->fGammaECuts[i]             = stZ->fGammaECuts[j];
+          stZ->fLogGammaECuts[i]          = stZ->fLogGammaECuts[j];
+          stZ->fGamCutIndxToMatCutIndx[i] = stZ->fGamCutIndxToMatCutIndx[j];
+          stZ->fGammaECuts[j]             = dum0;
+          stZ->fLogGammaECuts[j]          = dum1;
+          stZ->fGamCutIndxToMatCutIndx[j] = dumv;
         }
       }
-      // clear temporary vector
-      for (std::size_t i=0; i<stZ->fGamCutIndxToMatCutIndx.size(); ++i) {
-        stZ->fGamCutIndxToMatCutIndx[i].clear();
-      }
-      stZ->fGamCutIndxToMatCutIndx.clear();
-      //  init for each gamma cut that are below the e- energy
-      for (std::size_t ic=0; ic<stZ->fNumGammaCuts; ++ic) {
-        const G4double gamCut = stZ->fGammaECuts[ic];
-        if (elEnergy>gamCut) {
-          // find lower kappa index; compute the 'xi' i.e. cummulative value for
-          // gamCut/elEnergy
-          const G4double cutKappa = std::max(1.e-12, gamCut/elEnergy);
-          const std::size_t iKLow = (cutKappa>1.e-12)
-          ? std::lower_bound(fKappaVect.cbegin(), fKappaVect.cend(), cutKappa)
-            - fKappaVect.cbegin() -1
-          : 0;
-          const STPoint* stpL = &(stZ->fTablesPerEnergy[iee]->fSTable[iKLow]);
-          const STPoint* stpH = &(stZ->fTablesPerEnergy[iee]->fSTable[iKLow+1]);
-          const G4double pA   = stpL->fParA;
-          const G4double pB   = stpL->fParB;
-          const G4double etaL = stpL->fCum;
-          const G4double etaH = stpH->fCum;
-          const G4double alph = G4Log(cutKappa/fKappaVect[iKLow])
-                               /G4Log(fKappaVect[iKLow+1]/fKappaVect[iKLow]);
-          const G4double dum  = pA*(alph-1.)-1.-pB;
-          G4double val = etaL;
-          if (alph==0.) {
-            stZ->fTablesPerEnergy[iee]->fCumCutValues[ic] = val;
-          } else {
-            val = -(dum+std::sqrt(dum*dum-4.*pB*alph*alph))/(2.*pB*alph);
-            val = val*(etaH-etaL)+etaL;
-            stZ->fTablesPerEnergy[iee]->fCumCutValues[ic] = val;
-          }
-        }
+    }
+    // set couple indices to store the corresponding gamma cut index
+    stZ->fMatCutIndxToGamCutIndx.resize(numMatCuts,-1);
+    for (std::size_t i=0; i<stZ->fGamCutIndxToMatCutIndx.size(); ++i) {
+      for (std::size_t j=0; j<stZ->fGamCutIndxToMatCutIndx[i].size(); ++j) {
+        stZ->fMatCutIndxToGamCutIndx[stZ->fGamCutIndxToMatCutIndx[i][j]] = i;
       }
     }
+    // clear temporary vector
+    for (std::size_t i=0; i<stZ->fGamCutIndxToMatCutIndx.size(); ++i) {
+      stZ->fGamCutIndxToMatCutIndx[i].clear();
+    }
+    stZ->fGamCutIndxToMatCutIndx.clear();
+    //
+    // Determine min/max elektron kinetic energies and indices: the minimum
+    // gamma cut is the first one after sorting
+    const G4double elEmin = std::max(fUsedLowEenergy, stZ->fGammaECuts[0]);
+    const G4double elEmax = fUsedHighEenergy;
+    // find low/high elecrton energy indices where tables will be needed
+    // low:
+    stZ->fMinElEnergyIndx = 0;
+    if (elEmin>=fElEnergyVect[fNumElEnergy-1]) {
+      stZ->fMinElEnergyIndx = fNumElEnergy-1;
+    } else {
+      stZ->fMinElEnergyIndx = G4int(std::lower_bound(fElEnergyVect.cbegin(),
+                                                fElEnergyVect.cend(), elEmin)
+                                    - fElEnergyVect.cbegin() -1);
+    }
+    // high:
+    stZ->fMaxElEnergyIndx = 0;
+    if (elEmax>=fElEnergyVect[fNumElEnergy-1]) {
+      stZ->fMaxElEnergyIndx = fNumElEnergy-1;
+    } else {
+      // lower + 1
+      stZ->fMaxElEnergyIndx = G4int(std::lower_bound(fElEnergyVect.cbegin(),
+                                                fElEnergyVect.cend(), elEmax)
+                                    - fElEnergyVect.cbegin());
+    }
+    // tables are loaded at the first use within these energy indices
+    stZ->fTablesPerEnergy.resize(fNumElEnergy, nullptr);
+    // nothing to load if no table is needed
+    stZ->fIsLoaded = (stZ->fMaxElEnergyIndx<=stZ->fMinElEnergyIndx);
   }
 }
 
-// should be called only from LoadSamplingTables(G4int) and once
+// should be called only from BuildSamplingTables() and once
 void G4SBBremTable::LoadSTGrid() {
   const G4String fname =  G4EmParameters::Instance()->GetDirLEDATA() + "/brem_SB/SBTables/grid";
   std::ifstream infile(fname,std::ios::in);
@@ -380,83 +379,82 @@ void G4SBBremTable::LoadSTGrid() {
 }
 
 void G4SBBremTable::LoadSamplingTables(G4int iz) {
-  // check if grid needs to be loaded first
-  if (fMaxZet<0) {
-    LoadSTGrid();
-  }
+  G4AutoLock l(&theSBTableMutex);
   // load data for a given Z only once
   iz = std::max(std::min(fMaxZet, iz),1);
-
+  SamplingTablePerZ* zTable = fSBSamplingTables[iz];
+  // may be loaded by another thread in the meantime
+  if (zTable->fIsLoaded) {
+    return;
+  }
   const G4String fname = G4EmParameters::Instance()->GetDirLEDATA() + "/brem_SB/SBTables/sTableSB_"
                         + std::to_string(iz);
   std::istringstream infile(std::ios::in);
   // read the compressed data file into the stream
   ReadCompressedFile(fname, infile);
-  // the SamplingTablePerZ object was already created, set size of containers
-  // then load sampling table data for each electron energies
-  SamplingTablePerZ* zTable = fSBSamplingTables[iz];
-  //
-  // Determine min/max elektron kinetic energies and indices
-  const G4double minGammaCut = zTable->fGammaECuts[ std::min_element(
-                 std::cbegin(zTable->fGammaECuts),std::cend(zTable->fGammaECuts))
-                -std::cbegin(zTable->fGammaECuts)];
-  const G4double elEmin = std::max(fUsedLowEenergy, minGammaCut);
-  const G4double elEmax = fUsedHighEenergy;
-  // find low/high elecrton energy indices where tables will be needed
-  // low:
-  zTable->fMinElEnergyIndx = 0;
-  if (elEmin>=fElEnergyVect[fNumElEnergy-1]) {
-    zTable->fMinElEnergyIndx = fNumElEnergy-1;
-  } else {
-    zTable->fMinElEnergyIndx = G4int(std::lower_bound(fElEnergyVect.cbegin(),
-                                                fElEnergyVect.cend(), elEmin)
-                                     - fElEnergyVect.cbegin() -1);
-  }
-  // high:
-  zTable->fMaxElEnergyIndx = 0;
-  if (elEmax>=fElEnergyVect[fNumElEnergy-1]) {
-    zTable->fMaxElEnergyIndx = fNumElEnergy-1;
-  } else {
-    // lower + 1
-    zTable->fMaxElEnergyIndx = G4int(std::lower_bound(fElEnergyVect.cbegin(),
-                                                fElEnergyVect.cend(), elEmax)
-                                     - fElEnergyVect.cbegin());
-  }
-  // protect
-  if (zTable->fMaxElEnergyIndx<=zTable->fMinElEnergyIndx) {
-    return;
-  }
-  // load sampling tables that are needed: file is already in the stream
-  zTable->fTablesPerEnergy.resize(fNumElEnergy, nullptr);
-  for (G4int iee=0; iee<fNumElEnergy; ++iee) {
+  // load sampling tables that are needed only, i.e. within the min/max e-
+  // energy indices determined at initialisation: file is already in the stream
+  for (G4int iee=0; iee<=zTable->fMaxElEnergyIndx; ++iee) {
     // go over data that are not needed
-    if (iee<zTable->fMinElEnergyIndx || iee>zTable->fMaxElEnergyIndx) {
+    if (iee<zTable->fMinElEnergyIndx) {
       for (G4int ik=0; ik<fNumKappa; ++ik) {
         G4double dum;
         infile >> dum; infile >> dum; infile >> dum;
       }
-    } else { // load data that are needed
-      zTable->fTablesPerEnergy[iee] = new STable();
-      zTable->fTablesPerEnergy[iee]->fSTable.resize(fNumKappa);
-      for (G4int ik=0; ik<fNumKappa; ++ik) {
-        STPoint &stP = zTable->fTablesPerEnergy[iee]->fSTable[ik];
-        infile >> stP.fCum;
-        infile >> stP.fParA;
-        infile >> stP.fParB;
+      continue;
+    }
+    // load data that are needed
+    auto st = new STable();
+    st->fSTable.resize(fNumKappa);
+    for (G4int ik=0; ik<fNumKappa; ++ik) {
+      STPoint &stP = st->fSTable[ik];
+      infile >> stP.fCum;
+      infile >> stP.fParA;
+      infile >> stP.fParB;
+    }
+    // 1 indicates that gamma production is not possible at this e- energy
+    st->fCumCutValues.resize(zTable->fNumGammaCuts,1.);
+    //  init for each gamma cut that are below the e- energy
+    const G4double elEnergy = fElEnergyVect[iee];
+    for (std::size_t ic=0; ic<zTable->fNumGammaCuts; ++ic) {
+      const G4double gamCut = zTable->fGammaECuts[ic];
+      if (elEnergy>gamCut) {
+        // find lower kappa index; compute the 'xi' i.e. cummulative value for
+        // gamCut/elEnergy
+        const G4double cutKappa = std::max(1.e-12, gamCut/elEnergy);
+        const std::size_t iKLow = (cutKappa>1.e-12)
+        ? std::lower_bound(fKappaVect.cbegin(), fKappaVect.cend(), cutKappa)
+          - fKappaVect.cbegin() -1
+        : 0;
+        const STPoint* stpL = &(st->fSTable[iKLow]);
+        const STPoint* stpH = &(st->fSTable[iKLow+1]);
+        const G4double pA   = stpL->fParA;
+        const G4double pB   = stpL->fParB;
+        const G4double etaL = stpL->fCum;
+        const G4double etaH = stpH->fCum;
+        const G4double alph = G4Log(cutKappa/fKappaVect[iKLow])
+                             /G4Log(fKappaVect[iKLow+1]/fKappaVect[iKLow]);
+        const G4double dum  = pA*(alph-1.)-1.-pB;
+        G4double val = etaL;
+        if (alph!=0.) {
+          val = -(dum+std::sqrt(dum*dum-4.*pB*alph*alph))/(2.*pB*alph);
+          val = val*(etaH-etaL)+etaL;
+        }
+        st->fCumCutValues[ic] = val;
       }
     }
+    zTable->fTablesPerEnergy[iee] = st;
   }
+  // tables are complete and may be used by all threads
+  zTable->fIsLoaded = true;
 }
 
 // clean away all sampling tables and make ready to re-install
 void G4SBBremTable::ClearSamplingTables() {
   for (G4int iz=0; iz<fMaxZet+1; ++iz) {
     if (fSBSamplingTables[iz]) {
-      for (G4int iee=0; iee<fNumElEnergy; ++iee) {
-        if (fSBSamplingTables[iz]->fTablesPerEnergy[iee]) {
-          fSBSamplingTables[iz]->fTablesPerEnergy[iee]->fSTable.clear();
-          fSBSamplingTables[iz]->fTablesPerEnergy[iee]->fCumCutValues.clear();
-        }
+      for (auto st : fSBSamplingTables[iz]->fTablesPerEnergy) {
+        delete st;
       }
       fSBSamplingTables[iz]->fTablesPerEnergy.clear();
       fSBSamplingTables[iz]->fGammaECuts.clear();
@@ -174,6 +174,9 @@ G4UniversalFluctuation::SampleGlandz(CLHEP::HepRandomEngine* rndmEngineF,
                                      const G4Material*,
                                      const G4double tcut)
 {
+  // numbers for excitations, Poisson and Gauss sampling of this step
+  FillRandomBlock(rndmEngineF, nblock);
+
   G4double a1(0.0), a3(0.0);
   G4double loss = 0.0;
   G4double e1 = ipotFluct;
@@ -221,16 +224,8 @@ G4UniversalFluctuation::SampleGlandz(CLHEP::HepRandomEngine* rndmEngineF,
     const G4double w3 = alfa*e0;
     if(tcut > w3) {
       const G4double w = (tcut-w3)/tcut;
-      const G4int nnb = (G4int)G4Poisson(p3);
-      if(nnb > 0) {
-        if(nnb > sizearray) {
-          sizearray = nnb;
-          delete [] rndmarray;
-          rndmarray = new G4double[nnb];
-        }
-        rndmEngineF->flatArray(nnb, rndmarray);
-        for (G4int k=0; k<nnb; ++k) { loss += w3/(1.-w*rndmarray[k]); }
-      }
+      const G4int nnb = (G4int)SamplePoisson(rndmEngineF, p3);
+      if(nnb > 0) { loss += SampleIonisation(rndmEngineF, nnb, w3, w); }
     }
     if(sig2e > 0.0) { SampleGauss(rndmEngineF, emean, sig2e, loss); }
   }
@@ -54,7 +54,10 @@
 
 G4UrbanFluctuation::G4UrbanFluctuation(const G4String& nam)
  : G4UniversalFluctuation(nam)
-{}
+{
+  // two excitation levels
+  nblock = 10;
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -78,6 +81,9 @@ G4double G4UrbanFluctuation::SampleGlandz(CLHEP::HepRandomEngine* rndmEngineF,
     lastMaterial = material;   
   }
 
+  // numbers for excitations, Poisson and Gauss sampling of this step
+  FillRandomBlock(rndmEngineF, nblock);
+
   G4double a1(0.0), a2(0.0), a3(0.0);
   G4double loss = 0.0;
   G4double e1 = e1Fluct;
@@ -137,16 +143,8 @@ G4double G4UrbanFluctuation::SampleGlandz(CLHEP::HepRandomEngine* rndmEngineF,
     const G4double w3 = alfa*e0;
     if(tcut > w3) {
       const G4double w = (tcut-w3)/tcut;
-      const G4int nnb = (G4int)G4Poisson(p3);
-      if(nnb > 0) {
-        if(nnb > sizearray) {
-          sizearray = nnb;
-          delete [] rndmarray;
-          rndmarray = new G4double[nnb];
-        }
-        rndmEngineF->flatArray(nnb, rndmarray);
-        for (G4int k=0; k<nnb; ++k) { loss += w3/(1.-w*rndmarray[k]); }
-      }
+      const G4int nnb = (G4int)SamplePoisson(rndmEngineF, p3);
+      if(nnb > 0) { loss += SampleIonisation(rndmEngineF, nnb, w3, w); }
     }
     if(sig2e > 0.0) { SampleGauss(rndmEngineF, emean, sig2e, loss); }
   }
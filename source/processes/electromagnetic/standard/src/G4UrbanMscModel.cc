@@ -56,6 +56,7 @@
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "Randomize.hh"
+#include "G4Electron.hh"
 #include "G4Positron.hh"
 #include "G4EmParameters.hh"
 #include "G4ParticleChangeForMSC.hh"
@@ -70,10 +71,15 @@
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 std::vector<G4UrbanMscModel::mscData*> G4UrbanMscModel::msc;
+std::vector<G4UrbanMscModel::mscAngTable*> G4UrbanMscModel::angTable;
 
 namespace
 {
   G4Mutex theUrbanMutex = G4MUTEX_INITIALIZER;
+
+  // grid of tau of the tables of angular distribution
+  const G4double tauTabMin = 1.e-8;
+  const G4int nbinsPerDecadeTab = 8;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -127,6 +133,13 @@ G4UrbanMscModel::~G4UrbanMscModel()
     for(auto & ptr : msc) { delete ptr; }
     msc.clear();
   } 
+  if(isTableOwner) {
+    const std::size_t ip = (particle == positron) ? 1 : 0;
+    for(std::size_t k=ip; k<angTable.size(); k+=2) {
+      delete angTable[k];
+      angTable[k] = nullptr;
+    }
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -145,6 +158,7 @@ void G4UrbanMscModel::Initialise(const G4ParticleDefinition* p,
   if(!IsLocked()) {
     dispAlg96 = G4EmParameters::Instance()->LateralDisplacementAlg96();
     fPosiCorrection = G4EmParameters::Instance()->MscPositronCorrection();
+    fTabSampling = G4EmParameters::Instance()->MscTabulatedSampling();
   }
 
   // initialise cache only once
@@ -159,6 +173,12 @@ void G4UrbanMscModel::Initialise(const G4ParticleDefinition* p,
   // initialise cache for each new run
   if(isFirstInstance) { InitialiseModelCache(); }
 
+  // tables of angular distribution for e+- are shared between threads
+  if(fTabSampling && IsMaster() && 
+     (p == G4Electron::Electron() || p == positron)) {
+    BuildAngularTables(); 
+  }
+
   /*
   G4cout << "### G4UrbanMscModel::Initialise done for " 
  	 << p->GetParticleName() << " type= " << steppingAlgorithm << G4endl;
@@ -839,6 +859,11 @@ G4double G4UrbanMscModel::SampleCosineTheta(G4double trueStepLength,
 
   if (tau >= taubig) { cth = -1.+2.*rndmEngineMod->flat(); }
   else if (tau >= tausmall) {
+    // tabulated sampling if the energy loss along the step is small
+    if(fTabSampling && kinEnergy == currentKinEnergy &&
+       trueStepLength > std::min(tlimitmin,lambdalimit) &&
+       SampleTabulatedCosTheta(tau, cth)) { return cth; }
+
     static const G4double numlim = 0.01;
     static const G4double onethird = 1./3.;
     if(tau < numlim) {
@@ -943,30 +968,122 @@ G4double G4UrbanMscModel::SampleCosineTheta(G4double trueStepLength,
     //G4cout << "c= " << c << " qprob= " << qprob << " eb1= " << eb1
     // << " c1= " << c1 << " b1= " << b1 << " bx= " << bx << " eb1= " << eb1
     //             << G4endl;
-    rndmEngineMod->flatArray(2, rndmarray);
-    if(rndmarray[0] < qprob)
-    {
-      G4double var = 0;
-      if(rndmarray[1] < prob) {
-        cth = 1.+G4Log(ea+rndmEngineMod->flat()*eaa)*x;
-      } else {
-        var = (1.0 - d)*rndmEngineMod->flat();
-        if(var < numlim*d) {
-          var /= (d*c1); 
-          cth = -1.0 + var*(1.0 - 0.5*var*c)*(2. + (c - xsi)*x);
-        } else {
-          cth = 1. + x*(c - xsi - c*G4Exp(-G4Log(var + d)/c1));
-        }
-      } 
+    cth = SampleMixedCosTheta(x, xsi, c, ea, eaa, d, prob, qprob);
+  }
+  return cth;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double G4UrbanMscModel::SampleMixedCosTheta(G4double x, G4double xsi,
+                                              G4double c, G4double ea,
+                                              G4double eaa, G4double d,
+                                              G4double prob, G4double qprob)
+{
+  static const G4double numlim = 0.01;
+  G4double cth;
+  rndmEngineMod->flatArray(2, rndmarray);
+  if(rndmarray[0] < qprob)
+  {
+    G4double var = 0;
+    if(rndmarray[1] < prob) {
+      cth = 1.+G4Log(ea+rndmEngineMod->flat()*eaa)*x;
     } else {
-      cth = -1.+2.*rndmarray[1];
-    }
+      const G4double c1 = c-1.;
+      var = (1.0 - d)*rndmEngineMod->flat();
+      if(var < numlim*d) {
+        var /= (d*c1); 
+        cth = -1.0 + var*(1.0 - 0.5*var*c)*(2. + (c - xsi)*x);
+      } else {
+        cth = 1. + x*(c - xsi - c*G4Exp(-G4Log(var + d)/c1));
+      }
+    } 
+  } else {
+    cth = -1.+2.*rndmarray[1];
   }
   return cth;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+G4bool G4UrbanMscModel::SampleTabulatedCosTheta(G4double tau, G4double& cth)
+{
+  // table for the material and the particle
+  const std::size_t k = 2*couple->GetMaterial()->GetIndex() 
+    + ((particle == positron) ? 1 : 0);
+  if(k >= angTable.size() || nullptr == angTable[k]) { return false; }
+  const mscAngTable* tab = angTable[k];
+
+  // bilinear interpolation in log(E) and log(tau)
+  G4double fe = (currentLogKinEnergy - tab->logEmin)*tab->invLogEstep;
+  G4double ft = (G4Log(tau) - tab->logTaumin)*tab->invLogTaustep;
+  if(fe < 0.0 || ft < 0.0 || fe >= tab->nE - 1 || ft >= tab->nTau - 1) {
+    return false;
+  }
+  const G4int ie = (G4int)fe;
+  const G4int it = (G4int)ft;
+  fe -= ie;
+  ft -= it;
+  const G4double* p0 = &(tab->data[2*(ie*tab->nTau + it)]);
+  const G4double* p1 = p0 + 2*tab->nTau;
+  if(p0[1] < 0.0 || p0[3] < 0.0 || p1[1] < 0.0 || p1[3] < 0.0) { 
+    return false; 
+  }
+  const G4double w00 = (1.-fe)*(1.-ft);
+  const G4double w01 = (1.-fe)*ft;
+  const G4double w10 = fe*(1.-ft);
+  const G4double w11 = fe*ft;
+  const G4double theta0 = (w00*p0[0] + w01*p0[2] + w10*p1[0] + w11*p1[2])
+    *std::sqrt(tau);
+  const G4double xsi = w00*p0[1] + w01*p0[3] + w10*p1[1] + w11*p1[3];
+
+  // the same parameters of the distribution as in SampleCosineTheta
+  static const G4double numlim = 0.01;
+  static const G4double theta0max = CLHEP::pi/6.;
+  static const G4double one12th = 1./12.;
+
+  const G4double theta2 = theta0*theta0;
+  if(theta2 < tausmall) { 
+    cth = 1.0;
+    return true; 
+  }
+  if(theta0 > theta0max) { return false; }
+
+  G4double x = theta2*(1.0 - theta2*one12th);
+  if(theta2 > numlim) {
+    const G4double sth = 2*std::sin(0.5*theta0);
+    x = sth*sth;
+  }
+  xmeanth = (tau < numlim) ? 1.0 - tau*(1.0 - 0.5*tau) : G4Exp(-tau);
+
+  G4double c = xsi;
+  if(std::abs(c-3.) < 0.001)      { c = 3.001; }
+  else if(std::abs(c-2.) < 0.001) { c = 2.001; }
+  const G4double c1 = c-1.;
+
+  const G4double ea = G4Exp(-xsi);
+  const G4double eaa = 1.-ea;
+  const G4double xmean1 = 1.-(1.-(1.+xsi)*ea)*x/eaa;
+  if(xmean1 <= 0.999*xmeanth) { return false; }
+
+  const G4double x0 = 1. - xsi*x;
+  const G4double b = 1.+(c-xsi)*x;
+  const G4double b1 = b+1.;
+  const G4double bx = c*x;
+  const G4double d = G4Exp(G4Log(bx/b1)*c1);
+
+  const G4double xmean2 = (x0 + d - (bx - b1*d)/(c-2.))/(1. - d);
+  const G4double f1x0 = ea/eaa;
+  const G4double f2x0 = c1/(c*(1. - d));
+  const G4double prob = f2x0/(f1x0+f2x0);
+  const G4double qprob = xmeanth/(prob*xmean1+(1.-prob)*xmean2);
+
+  cth = SampleMixedCosTheta(x, xsi, c, ea, eaa, d, prob, qprob);
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 G4double G4UrbanMscModel::ComputeTheta0(G4double trueStepLength,
                                         G4double kinEnergy)
 {
@@ -1219,3 +1336,96 @@ void G4UrbanMscModel::InitialiseModelCache()
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4UrbanMscModel::BuildAngularTables()
+{
+  // tables are rebuilt for each run, they depend only on material
+  isTableOwner = true;
+  const std::size_t ip = (particle == positron) ? 1 : 0;
+  std::size_t nmat = G4Material::GetNumberOfMaterials();
+  if(2*nmat > angTable.size()) { angTable.resize(2*nmat, nullptr); }
+  for(std::size_t k=ip; k<angTable.size(); k+=2) {
+    delete angTable[k];
+    angTable[k] = nullptr;
+  }
+
+  const G4double emin = std::max(LowEnergyLimit(), 
+    G4EmParameters::Instance()->LowestElectronEnergy());
+  const G4double emax = HighEnergyLimit();
+  if(emax <= emin) { return; }
+
+  const G4int nE = 
+    std::max(G4lrint(nbinsPerDecadeTab*std::log10(emax/emin)), 1) + 1;
+  const G4int nTau = 
+    G4lrint(nbinsPerDecadeTab*std::log10(taubig/tauTabMin)) + 1;
+  const G4double logEmin = G4Log(emin);
+  const G4double logEstep = G4Log(emax/emin)/(G4double)(nE - 1);
+  const G4double logTaumin = G4Log(tauTabMin);
+  const G4double logTaustep = G4Log(taubig/tauTabMin)/(G4double)(nTau - 1);
+
+  static const G4double onesixth = 1./6.;
+  static const G4double one12th = 1./12.;
+  static const G4double numlim = 0.01;
+  static const G4double theta0max = CLHEP::pi*onesixth;
+
+  auto theCoupleTable = G4ProductionCutsTable::GetProductionCutsTable();
+  std::size_t numOfCouples = theCoupleTable->GetTableSize();
+
+  for(G4int j=0; j<(G4int)numOfCouples; ++j) {
+    couple = theCoupleTable->GetMaterialCutsCouple(j);
+    const G4Material* mat = couple->GetMaterial();
+    const std::size_t k = 2*mat->GetIndex() + ip;
+    if(nullptr != angTable[k]) { continue; }
+
+    auto tab = new mscAngTable();
+    tab->logEmin = logEmin;
+    tab->invLogEstep = 1.0/logEstep;
+    tab->nE = nE;
+    tab->logTaumin = logTaumin;
+    tab->invLogTaustep = 1.0/logTaustep;
+    tab->nTau = nTau;
+    tab->data.resize(2*nE*nTau, -1.0);
+    angTable[k] = tab;
+
+    // ComputeTheta0 uses the state of the model
+    idx = j;
+    currentRadLength = mat->GetRadlen();
+
+    for(G4int ie=0; ie<nE; ++ie) {
+      const G4double e = G4Exp(logEmin + ie*logEstep);
+      currentKinEnergy = e;
+      const G4double xs = CrossSectionPerVolume(mat, particle, e, 0.0, DBL_MAX);
+      if(xs <= 0.0) { continue; }
+      const G4double lambda = 1.0/xs;
+      const G4double xx = G4Log(lambda/currentRadLength);
+
+      for(G4int it=0; it<nTau; ++it) {
+        const G4double tau = G4Exp(logTaumin + it*logTaustep);
+        const G4double theta0 = ComputeTheta0(tau*lambda, e);
+        const G4double theta2 = theta0*theta0;
+        G4double* p = &(tab->data[2*(ie*nTau + it)]);
+        p[0] = theta0/std::sqrt(tau);
+
+        // conditions of the use of the mixed distribution
+        if(theta2 < tausmall || theta0 > theta0max) { continue; }
+        G4double x = theta2*(1.0 - theta2*one12th);
+        if(theta2 > numlim) {
+          const G4double sth = 2*std::sin(0.5*theta0);
+          x = sth*sth;
+        }
+        const G4double u = G4Exp(G4Log(tau)*onesixth);
+        G4double xsi = msc[idx]->coeffc1 + 
+          u*(msc[idx]->coeffc2+msc[idx]->coeffc3*u)+msc[idx]->coeffc4*xx;
+        xsi = std::max(xsi, 1.9);
+        const G4double ea = G4Exp(-xsi);
+        const G4double xmean1 = 1.-(1.-(1.+xsi)*ea)*x/(1.-ea);
+        const G4double xmean = (tau < numlim) 
+          ? 1.0 - tau*(1.0 - 0.5*tau) : G4Exp(-tau);
+        if(xmean1 <= 0.999*xmean) { continue; }
+        p[1] = xsi;
+      }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
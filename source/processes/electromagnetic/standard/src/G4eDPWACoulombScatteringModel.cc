@@ -95,14 +95,16 @@ void G4eDPWACoulombScatteringModel::Initialise(const G4ParticleDefinition* pdef,
     // init only for the elements that are used in the geometry
     G4ProductionCutsTable* theCpTable = G4ProductionCutsTable::GetProductionCutsTable();
     G4int numOfCouples = (G4int)theCpTable->GetTableSize();
+    std::vector<G4int> zets;
     for(G4int j=0; j<numOfCouples; ++j) {
       const G4Material* mat = theCpTable->GetMaterialCutsCouple(j)->GetMaterial();
       const G4ElementVector* elV = mat->GetElementVector();
       std::size_t numOfElem = mat->GetNumberOfElements();
       for (std::size_t ie = 0; ie < numOfElem; ++ie) {
-        fTheDCS->InitialiseForZ((*elV)[ie]->GetZasInt());
+        zets.push_back((*elV)[ie]->GetZasInt());
       }
     }
+    fTheDCS->InitialiseForZ(zets);
     // init scattering power correction
     if (fIsScpCorrection) {
       fTheDCS->InitSCPCorrection(LowEnergyLimit(), HighEnergyLimit());
@@ -43,9 +43,12 @@
 #include "G4eDPWAElasticDCS.hh"
 #include "G4EmParameters.hh"
 #include "G4Physics2DVector.hh"
+#include "G4TaskDispatcher.hh"
 
 #include "zlib.h"
 
+#include <algorithm>
+
 //
 // Global variables:
 //
@@ -120,6 +123,26 @@ void G4eDPWAElasticDCS::InitialiseForZ(std::size_t iz) {
 }
 
 
+// initialise for a list of atomic numbers: the grid and the data directory
+// are set first, then each Z fills its own slots of the containers
+void G4eDPWAElasticDCS::InitialiseForZ(const std::vector<G4int>& zets) {
+  if (!gIsGridLoaded) {
+    LoadGrid();
+  }
+  FindDirectoryPath();
+  std::vector<G4int> zToLoad;
+  for (auto iz : zets) {
+    if (!fDCS[iz] && std::find(zToLoad.begin(), zToLoad.end(), iz) == zToLoad.end()) {
+      zToLoad.push_back(iz);
+    }
+  }
+  G4TaskDispatcher::Execute((G4int)zToLoad.size(), [&](G4int i) {
+    LoadDCSForZ(zToLoad[i]);
+    BuildSmplingTableForZ(zToLoad[i]);
+  });
+}
+
+
 // loads the kinetic energy and theta grids for the DCS data (first init step)
 // should be called only by the master
 void G4eDPWAElasticDCS::LoadGrid() {
@@ -40,7 +40,12 @@
 //
 // Class Description:
 //
-// Generic helper class for the random selection of an element
+// Generic helper class for the random selection of an element.
+// Probabilities of elements are tabulated at the nodes of a log energy grid
+// and linearly interpolated between nodes. This is sampled by choosing one
+// of the two nodes with the interpolation weights, then the element at this
+// node using its alias table, so selection time does not depend on the
+// number of elements.
 
 // -------------------------------------------------------------------
 //
@@ -54,6 +59,7 @@
 #include "G4Element.hh"
 #include "G4ElementVector.hh"
 #include "G4PhysicsLogVector.hh"
+#include "G4Log.hh"
 #include "Randomize.hh"
 #include <vector>
 
@@ -87,6 +93,10 @@ public:
 
 private:
 
+  void BuildAliasTables();
+
+  inline const G4Element* SelectAtNode(std::size_t idx, G4double x) const;
+
   G4VEmModel*       model;
   const G4Material* material;
   const G4ElementVector* theElementVector;
@@ -99,7 +109,10 @@ private:
   G4double highEnergy;
 
   std::vector<G4PhysicsLogVector*> xSections;
-  
+
+  // alias tables of all energy nodes, nElmMinusOne+1 entries per node
+  std::vector<G4double> aliasProb;
+  std::vector<G4int>    aliasIndex;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -107,18 +120,19 @@ private:
 
 inline const G4Element* G4EmElementSelector::SelectRandomAtom(G4double e) const
 {
-  const G4Element* element = (*theElementVector)[nElmMinusOne];
-  if (nElmMinusOne > 0) {
-    G4double x = G4UniformRand();
-    size_t idx(0);
-    for(G4int i=0; i<nElmMinusOne; ++i) {
-      if (x <= (xSections[i])->Value(e, idx)) {
-        element = (*theElementVector)[i];
-        break;
-      }
-    }
-  }
-  return element;
+  return (nElmMinusOne > 0) ? SelectRandomAtom(e, G4Log(e))
+                            : (*theElementVector)[0];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+inline const G4Element* 
+G4EmElementSelector::SelectAtNode(std::size_t idx, G4double x) const
+{
+  const G4double y = x*(nElmMinusOne + 1);
+  const G4int k = std::min((G4int)y, nElmMinusOne);
+  const std::size_t j = idx*(nElmMinusOne + 1) + k;
+  return (*theElementVector)[(y - k < aliasProb[j]) ? k : aliasIndex[j]];
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -113,6 +113,8 @@ public:
 
   void SetSubCutRegion(const G4String& region);
 
+  void ActivateRangeRejection(const G4String& region, G4double energyLimit);
+
   void SetProcessBiasingFactor(const G4String& procname, 
                                G4double val, G4bool wflag);
 
@@ -166,6 +168,9 @@ private:
 
   std::vector<G4String>  m_regnamesSubCut;
 
+  std::vector<G4String>  m_regnamesRangeRej;
+  std::vector<G4double>  m_elimRangeRej;
+
   std::vector<G4String>  m_procBiasedXS;
   std::vector<G4double>  m_factBiasedXS;
   std::vector<G4bool>    m_weightBiasedXS;
@@ -87,6 +87,7 @@ private:
   G4UIcommand*               mscoCmd;
 
   G4UIcmdWithAString*        SubSecCmd;
+  G4UIcommand*               rrejCmd;
   G4UIcommand*               bfCmd;
   G4UIcommand*               fiCmd;
   G4UIcommand*               bsCmd;
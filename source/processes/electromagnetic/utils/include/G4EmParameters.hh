@@ -170,6 +170,11 @@ public:
   void SetUseICRU90Data(G4bool val);
   G4bool UseICRU90Data() const;
 
+  // single precision copies of the dEdx, range and lambda tables of
+  // energy loss processes used at each step, in addition to the tables
+  void SetSinglePrecisionTables(G4bool val);
+  G4bool SinglePrecisionTables() const;
+
   void SetFluctuationType(G4EmFluctuationType val);
   G4EmFluctuationType FluctuationType() const;
 
@@ -187,6 +192,10 @@ public:
   void SetGeneralProcessActive(G4bool val);
   G4bool GeneralProcessActive() const;
 
+  // e+- general process, disabled by default
+  void SetElectronGeneralProcessActive(G4bool val);
+  G4bool ElectronGeneralProcessActive() const;
+
   void SetEnableSamplingTable(G4bool val);
   G4bool EnableSamplingTable() const;
 
@@ -208,6 +217,10 @@ public:
   G4bool MscPositronCorrection() const;
   void SetMscPositronCorrection(G4bool v);
 
+  // tabulated sampling of msc angular distribution
+  G4bool MscTabulatedSampling() const;
+  void SetMscTabulatedSampling(G4bool v);
+
   // 5d
   void SetOnIsolated(G4bool val);
   G4bool OnIsolated() const;
@@ -359,6 +372,10 @@ public:
 
   void SetSubCutRegion(const G4String& region = "");
 
+  // charged tracks below energyLimit are stopped in the region if their
+  // range is below the safety, energy is deposited locally
+  void ActivateRangeRejection(const G4String& region, G4double energyLimit);
+
   void SetDeexActiveRegion(const G4String& region, G4bool fdeex,
 			   G4bool fauger, G4bool fpixe);
 
@@ -421,12 +438,15 @@ private:
   G4bool integral;
   G4bool birks;
   G4bool fICRU90;
+  G4bool fSinglePrecision;
   G4bool gener;
+  G4bool fElectronGeneral;
   G4bool fSamplingTable;
   G4bool fPolarisation;
   G4bool fMuDataFromFile;
   G4bool fPEKShell;
   G4bool fMscPosiCorr;
+  G4bool fMscTabSampling;
   G4bool onIsolated; // 5d model conversion on free ions
   G4bool fDNA;
   G4bool fIsPrinted;
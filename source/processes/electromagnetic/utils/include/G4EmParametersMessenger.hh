@@ -98,13 +98,16 @@ private:
   G4UIcmdWithABool*          mottCmd;
   G4UIcmdWithABool*          birksCmd;
   G4UIcmdWithABool*          sharkCmd;
+  G4UIcmdWithABool*          eGenCmd;
   G4UIcmdWithABool*          poCmd;
   G4UIcmdWithABool*          onIsolatedCmd;
   G4UIcmdWithABool*          sampleTCmd;
   G4UIcmdWithABool*          icru90Cmd;
+  G4UIcmdWithABool*          floatCmd;
   G4UIcmdWithABool*          mudatCmd;
   G4UIcmdWithABool*          peKCmd;
   G4UIcmdWithABool*          mscPCmd;
+  G4UIcmdWithABool*          mscTCmd;
 
   G4UIcmdWithADoubleAndUnit* minEnCmd;
   G4UIcmdWithADoubleAndUnit* maxEnCmd;
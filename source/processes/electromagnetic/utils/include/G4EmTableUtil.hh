@@ -36,6 +36,7 @@
 
 #include "globals.hh"
 #include "G4PhysicsTable.hh"
+#include "G4PhysicsCompactTable.hh"
 #include "G4VMultipleScattering.hh"
 #include "G4VEmProcess.hh"
 #include "G4VEnergyLossProcess.hh"
@@ -156,6 +157,15 @@ public:
                               const G4int verb, const G4bool ascii,
                               const G4bool spline);
 
+  // Builds or updates the compact single precision copy of the table,
+  // which is deleted if there is no table
+  static void BuildCompactTable(const G4VProcess* proc,
+                                const G4ParticleDefinition* part,
+                                const G4PhysicsTable* aTable,
+                                G4PhysicsCompactTable<G4float>*& compact,
+                                const G4String& tname,
+                                const G4int verb);
+
 };
 
 #endif
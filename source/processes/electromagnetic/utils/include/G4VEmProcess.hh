@@ -137,6 +137,12 @@ public:
   // allowing check process name
   virtual G4VEmProcess* GetEmProcess(const G4String& name);
 
+  // allowing check of sub-processes of a general process
+  virtual G4bool HasSubProcess(const G4VProcess*) const;
+
+  // allowing access to sub-processes of a general process by name
+  virtual G4VProcess* GetSubProcess(const G4String& name) const;
+
   //------------------------------------------------------------------------
   // Specific methods for Discrete EM post step simulation 
   //------------------------------------------------------------------------
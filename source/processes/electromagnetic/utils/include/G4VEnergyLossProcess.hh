@@ -62,6 +62,7 @@
 #include "G4EmSecondaryParticleType.hh"
 #include "G4PhysicsTable.hh"
 #include "G4PhysicsVector.hh"
+#include "G4PhysicsCompactTable.hh"
 
 class G4Step;
 class G4ParticleDefinition;
@@ -274,6 +275,10 @@ public:
   // Add subcut processor for the region
   void ActivateSubCutoff(const G4Region* region);
 
+  // Range rejection in the region: a track below energyLimit is stopped
+  // and its energy is deposited locally if its range is below the safety
+  void ActivateRangeRejection(const G4Region* region, G4double energyLimit);
+
   // Activate biasing
   void SetCrossSectionBiasingFactor(G4double f, G4bool flag = true);
 
@@ -301,6 +306,8 @@ public:
 
   inline G4int NumberOfSubCutoffRegions() const;
 
+  inline G4int NumberOfRangeRejectionRegions() const;
+
   //------------------------------------------------------------------------
   // Specific methods to path Physics Tables to the process
   //------------------------------------------------------------------------
@@ -311,6 +318,13 @@ public:
   void SetInverseRangeTable(G4PhysicsTable* p);
   void SetLambdaTable(G4PhysicsTable* p);
 
+  // Compact single precision copies of the dEdx, range, inverse range
+  // and lambda tables, used at each step instead of these tables if
+  // built; the master process owning the tables builds them and other
+  // processes share the copies of the tables they share
+  void BuildCompactTables();
+  void SetCompactTables(const G4VEnergyLossProcess* p);
+
   void SetTwoPeaksXS(std::vector<G4TwoPeaksXS*>*);
   void SetEnergyOfCrossSectionMax(std::vector<G4double>*);
 
@@ -374,6 +388,11 @@ public:
   // Set scaling parameters for ions is needed to G4EmCalculator
   void SetDynamicMassCharge(G4double massratio, G4double charge2ratio);
 
+  // Set material, energy and model at the beginning of the step
+  // without sampling of the interaction length, used if the discrete
+  // interaction is sampled by a general process
+  inline void PreStepSetup(const G4Track& track);
+
 private:
 
   void FillSecondariesAlongStep(G4double weight);
@@ -399,6 +418,8 @@ private:
                                                      G4double logScaledKinE);
 
   inline G4double ScaledKinEnergyForLoss(G4double range);
+  template <typename V>
+  inline G4double ScaledKinEnergyForLoss(const V* v, G4double range);
   inline G4double GetLambdaForScaledEnergy(G4double scaledKinE);
   inline G4double GetLambdaForScaledEnergy(G4double scaledKinE, 
                                            G4double logScaledKinE);
@@ -408,6 +429,8 @@ private:
 
   G4bool IsRegionForCubcutProcessor(const G4Track& aTrack);
 
+  G4bool IsRangeRejected(const G4Step& step) const;
+
 protected:
 
   G4ParticleChangeForLoss     fParticleChange;
@@ -439,7 +462,14 @@ private:
   G4PhysicsTable* theInverseRangeTable = nullptr;
   G4PhysicsTable* theLambdaTable = nullptr;
 
+  G4PhysicsCompactTable<G4float>* theCompactDEDXTable = nullptr;
+  G4PhysicsCompactTable<G4float>* theCompactRangeTable = nullptr;
+  G4PhysicsCompactTable<G4float>* theCompactInverseRangeTable = nullptr;
+  G4PhysicsCompactTable<G4float>* theCompactLambdaTable = nullptr;
+
   std::vector<const G4Region*>* scoffRegions = nullptr;
+  std::vector<const G4Region*>* rrejRegions = nullptr;
+  std::vector<G4double>*        rrejEnergyLimits = nullptr;
   std::vector<G4VEmModel*>*     emModels = nullptr;
   const std::vector<G4int>*     theDensityIdx = nullptr;
   const std::vector<G4double>*  theDensityFactor = nullptr;
@@ -485,6 +515,7 @@ private:
   G4int nBinsCSDA;
   G4int numberOfModels = 0;
   G4int nSCoffRegions = 0;
+  G4int nRRejRegions = 0;
   G4int secID = _DeltaElectron;
   G4int tripletID = _TripletElectron;
   G4int biasID = _DeltaEBelowCut;
@@ -570,6 +601,18 @@ G4VEnergyLossProcess::DefineMaterial(const G4MaterialCutsCouple* couple)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+inline void G4VEnergyLossProcess::PreStepSetup(const G4Track& track)
+{
+  DefineMaterial(track.GetMaterialCutsCouple());
+  preStepKinEnergy       = track.GetKineticEnergy();
+  preStepLogKinEnergy    = track.GetDynamicParticle()->GetLogKineticEnergy();
+  preStepScaledEnergy    = preStepKinEnergy*massRatio;
+  preStepLogScaledEnergy = preStepLogKinEnergy + logMassRatio;
+  SelectModel(preStepScaledEnergy);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 inline G4double G4VEnergyLossProcess::GetDEDXForScaledEnergy(G4double e)
 {
   /*
@@ -577,7 +620,9 @@ inline G4double G4VEnergyLossProcess::GetDEDXForScaledEnergy(G4double e)
            << basedCoupleIndex << " E(MeV)= " << e 
          << " Emin= " << minKinEnergy << "  Factor= " << fFactor 
          << "  " << theDEDXTable << G4endl; */
-  G4double x = fFactor*(*theDEDXTable)[basedCoupleIndex]->Value(e, idxDEDX);
+  G4double x = fFactor*((nullptr != theCompactDEDXTable)
+    ? (*theCompactDEDXTable)[basedCoupleIndex]->Value(e, idxDEDX)
+    : (*theDEDXTable)[basedCoupleIndex]->Value(e, idxDEDX));
   if(e < minKinEnergy) { x *= std::sqrt(e/minKinEnergy); }
   return x;
 }
@@ -590,7 +635,9 @@ G4double G4VEnergyLossProcess::GetDEDXForScaledEnergy(G4double e, G4double loge)
            << basedCoupleIndex << " E(MeV)= " << e 
          << " Emin= " << minKinEnergy << "  Factor= " << fFactor 
          << "  " << theDEDXTable << G4endl; */
-  G4double x = fFactor*(*theDEDXTable)[basedCoupleIndex]->LogVectorValue(e,loge);
+  G4double x = fFactor*((nullptr != theCompactDEDXTable)
+    ? (*theCompactDEDXTable)[basedCoupleIndex]->LogVectorValue(e, loge)
+    : (*theDEDXTable)[basedCoupleIndex]->LogVectorValue(e, loge));
   if(e < minKinEnergy) { x *= std::sqrt(e/minKinEnergy); }
   return x;
 }
@@ -615,7 +662,9 @@ inline G4double G4VEnergyLossProcess::GetScaledRangeForScaledEnergy(G4double e)
   if(currentCoupleIndex != coupleIdxRange || fRangeEnergy != e) {
     coupleIdxRange = currentCoupleIndex;
     fRangeEnergy = e;
-    fRange = reduceFactor*((*theRangeTableForLoss)[basedCoupleIndex])->Value(e, idxRange);
+    fRange = reduceFactor*((nullptr != theCompactRangeTable)
+      ? (*theCompactRangeTable)[basedCoupleIndex]->Value(e, idxRange)
+      : (*theRangeTableForLoss)[basedCoupleIndex]->Value(e, idxRange));
     if (fRange < 0.0) { fRange = 0.0; }
     else if (e < minKinEnergy) { fRange *= std::sqrt(e/minKinEnergy); }
   }
@@ -634,7 +683,9 @@ G4VEnergyLossProcess::GetScaledRangeForScaledEnergy(G4double e, G4double loge)
   if(currentCoupleIndex != coupleIdxRange || fRangeEnergy != e) {
     coupleIdxRange = currentCoupleIndex;
     fRangeEnergy = e;
-    fRange = reduceFactor*((*theRangeTableForLoss)[basedCoupleIndex])->LogVectorValue(e, loge);
+    fRange = reduceFactor*((nullptr != theCompactRangeTable)
+      ? (*theCompactRangeTable)[basedCoupleIndex]->LogVectorValue(e, loge)
+      : (*theRangeTableForLoss)[basedCoupleIndex]->LogVectorValue(e, loge));
     if (fRange < 0.0) { fRange = 0.0; }
     else if (e < minKinEnergy) { fRange *= std::sqrt(e/minKinEnergy); }
   }
@@ -674,7 +725,19 @@ inline G4double G4VEnergyLossProcess::ScaledKinEnergyForLoss(G4double r)
   //G4cout << "G4VEnergyLossProcess::GetEnergy: Idx= " 
   //         << basedCoupleIndex << " R(mm)= " << r << "  " 
   //         << theInverseRangeTable << G4endl; 
-  G4PhysicsVector* v = (*theInverseRangeTable)[basedCoupleIndex];
+  if(nullptr != theCompactInverseRangeTable) {
+    return ScaledKinEnergyForLoss(
+      (*theCompactInverseRangeTable)[basedCoupleIndex], r);
+  }
+  return ScaledKinEnergyForLoss((*theInverseRangeTable)[basedCoupleIndex], r);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+template <typename V>
+inline G4double G4VEnergyLossProcess::ScaledKinEnergyForLoss(const V* v,
+                                                             G4double r)
+{
   G4double rmin = v->Energy(0);
   G4double e = 0.0; 
   if(r >= rmin) { e = v->Value(r, idxInverseRange); }
@@ -689,7 +752,9 @@ inline G4double G4VEnergyLossProcess::ScaledKinEnergyForLoss(G4double r)
 
 inline G4double G4VEnergyLossProcess::GetLambdaForScaledEnergy(G4double e)
 {
-  return fFactor*((*theLambdaTable)[basedCoupleIndex])->Value(e, idxLambda);
+  return fFactor*((nullptr != theCompactLambdaTable)
+    ? (*theCompactLambdaTable)[basedCoupleIndex]->Value(e, idxLambda)
+    : (*theLambdaTable)[basedCoupleIndex]->Value(e, idxLambda));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -697,7 +762,9 @@ inline G4double G4VEnergyLossProcess::GetLambdaForScaledEnergy(G4double e)
 inline G4double
 G4VEnergyLossProcess::GetLambdaForScaledEnergy(G4double e, G4double loge)
 {
-  return fFactor*((*theLambdaTable)[basedCoupleIndex])->LogVectorValue(e, loge);
+  return fFactor*((nullptr != theCompactLambdaTable)
+    ? (*theCompactLambdaTable)[basedCoupleIndex]->LogVectorValue(e, loge)
+    : (*theLambdaTable)[basedCoupleIndex]->LogVectorValue(e, loge));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -891,6 +958,13 @@ inline G4int G4VEnergyLossProcess::NumberOfSubCutoffRegions() const
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+inline G4int G4VEnergyLossProcess::NumberOfRangeRejectionRegions() const
+{
+  return nRRejRegions;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 inline G4double G4VEnergyLossProcess::MinKinEnergy() const
 {
   return minKinEnergy;
@@ -70,6 +70,7 @@
 #include "G4Electron.hh"
 #include "G4Positron.hh"
 #include "G4EmUtility.hh"
+#include "G4EmProcessSubType.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -1176,6 +1177,21 @@ G4bool G4EmCalculator::ActiveForParticle(const G4ParticleDefinition* part,
       break;
     }
   }
+  // sub-processes of the e+- general process are not registered
+  // in the process manager
+  if(!res) {
+    for(G4int i=0; i<n; ++i) {
+      G4int stype = (*pv)[i]->GetProcessSubType();
+      if(stype == fElectronGeneralProcess ||
+         stype == fPositronGeneralProcess) {
+        auto gproc = static_cast<G4VEmProcess*>((*pv)[i]);
+        if(gproc->HasSubProcess(proc)) {
+          res = pm->GetProcessActivation(i);
+          break;
+        }
+      }
+    }
+  }
   return res;
 }
 
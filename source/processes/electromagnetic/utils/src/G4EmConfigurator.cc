@@ -193,6 +193,16 @@ void G4EmConfigurator::SetModelForRegion(G4VEmModel* mod,
 	    }
 	  }
 	}
+        // sub-processes of a general process are not in the list
+        if(nullptr == proc) {
+          for(G4int i=0; i<np; ++i) {
+            auto gp = dynamic_cast<G4VEmProcess*>((*plist)[i]);
+            if(nullptr != gp) {
+              proc = gp->GetSubProcess(processName);
+              if(nullptr != proc) { break; }
+            }
+          }
+        }
 	if(nullptr == proc) { 
 	  if(0 < verbose) {
 	    G4cout << "### G4EmConfigurator WARNING: fails to find a process <"
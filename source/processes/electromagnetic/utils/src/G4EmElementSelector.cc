@@ -47,6 +47,7 @@
 #include "G4EmElementSelector.hh"
 #include "G4VEmModel.hh"
 #include "G4SystemOfUnits.hh"
+#include <algorithm>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -140,6 +141,7 @@ void G4EmElementSelector::Initialise(const G4ParticleDefinition* part,
       }
     }
   }
+  BuildAliasTables();
   /*
   G4cout << "======== G4EmElementSelector for the " << model->GetName() 
          << G4endl;
@@ -172,23 +174,83 @@ G4EmElementSelector::SelectRandomAtom(const G4double e,
       ekin = (xSections[0])->GetMaxEnergy();
       idx = (xSections[0])->GetVectorLength() - 2;
     }
-    // 2. Do the linear interp.(corner cases are already excluded)
+    // 2. Linear interpolation of the probabilities between the two nodes
+    //    is sampled by selecting one node with weights (1-a) and a, then
+    //    the element at this node; the random number is reused
     const G4double x1 = (xSections[0])->Energy(idx);
-    const G4double  a = (ekin - x1)/((xSections[0])->Energy(idx+1) - x1);
-    const G4double urnd = G4UniformRand();
-    for (G4int i = 0; i < nElmMinusOne; ++i) {
-      const G4double  y1 = (*xSections[i])[idx];
-      if (urnd <= y1 + a*((*xSections[i])[idx+1] - y1)) {
-        element = (*theElementVector)[i];
-        break;
-      }
+    G4double a = (ekin - x1)/((xSections[0])->Energy(idx+1) - x1);
+    a = std::min(std::max(a, 0.0), 1.0);
+    G4double urnd = G4UniformRand();
+    if (urnd < a) {
+      ++idx;
+      urnd /= a;
+    } else {
+      urnd = (urnd - a)/(1.0 - a);
     }
+    element = SelectAtNode(idx, urnd);
   }
   return element;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+void G4EmElementSelector::BuildAliasTables()
+{
+  // probabilities of elements at each node are the differences of the
+  // normalised cumulative cross sections, the last one being 1
+  const G4int n = nElmMinusOne + 1;
+  aliasProb.assign((nbins + 1)*n, 1.0);
+  aliasIndex.assign((nbins + 1)*n, 0);
+  std::vector<G4double> q(n);
+  std::vector<G4int> small, large;
+  small.reserve(n);
+  large.reserve(n);
+
+  for(G4int j=0; j<=nbins; ++j) {
+    G4double sum = 0.0;
+    G4double c0 = 0.0;
+    for (G4int i=0; i<n; ++i) {
+      G4double c = (i < nElmMinusOne) ? (*xSections[i])[j] : 1.0;
+      q[i] = std::max(c - c0, 0.0);
+      c0 = std::max(c, c0);
+      sum += q[i];
+    }
+    // null cross section: the last element is selected as before
+    if(sum <= 0.0) {
+      std::fill(q.begin(), q.end(), 0.0);
+      q[nElmMinusOne] = sum = 1.0;
+    }
+
+    // Vose's method
+    small.clear();
+    large.clear();
+    for (G4int i=0; i<n; ++i) {
+      q[i] *= n/sum;
+      if(q[i] < 1.0) { small.push_back(i); }
+      else { large.push_back(i); }
+    }
+    G4double* prob = &aliasProb[j*n];
+    G4int* alias = &aliasIndex[j*n];
+    while(!small.empty() && !large.empty()) {
+      G4int ismall = small.back();
+      small.pop_back();
+      G4int ilarge = large.back();
+      prob[ismall] = q[ismall];
+      alias[ismall] = ilarge;
+      q[ilarge] -= 1.0 - q[ismall];
+      if(q[ilarge] < 1.0) {
+        large.pop_back();
+        small.push_back(ilarge);
+      }
+    }
+    // remaining entries are equal to 1 within rounding
+    for (auto i : large) { prob[i] = 1.0; alias[i] = i; }
+    for (auto i : small) { prob[i] = 1.0; alias[i] = i; }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void G4EmElementSelector::Dump(const G4ParticleDefinition* part)
 {
   G4cout << "======== G4EmElementSelector for the " << model->GetName();
@@ -88,6 +88,8 @@ void G4EmExtraParameters::Initialise()
   m_lengthForced.clear();
   m_weightForced.clear();
   m_regnamesSubCut.clear();
+  m_regnamesRangeRej.clear();
+  m_elimRangeRej.clear();
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -295,6 +297,28 @@ void G4EmExtraParameters::SetSubCutRegion(const G4String& region)
   m_regnamesSubCut.push_back(r);
 }
 
+void G4EmExtraParameters::ActivateRangeRejection(const G4String& region,
+                                                 G4double energyLimit)
+{
+  const G4String& r = CheckRegion(region);
+  if(energyLimit > 0.0) {
+    std::size_t n = m_regnamesRangeRej.size();
+    for(std::size_t i=0; i<n; ++i) {
+      if(r == m_regnamesRangeRej[i]) {
+        m_elimRangeRej[i] = energyLimit;
+        return;
+      }
+    }
+    m_regnamesRangeRej.push_back(r);
+    m_elimRangeRej.push_back(energyLimit);
+  } else {
+    G4ExceptionDescription ed;
+    ed << "Range rejection in region " << r
+       << " : Elim= " << energyLimit << " is not positive - ignored";
+    PrintWarning(ed);
+  }
+}
+
 void 
 G4EmExtraParameters::SetProcessBiasingFactor(const G4String& procname, 
                                              G4double val, G4bool wflag)
@@ -385,6 +409,11 @@ void G4EmExtraParameters::DefineRegParamForLoss(G4VEnergyLossProcess* ptr) const
     const G4Region* reg = regionStore->GetRegion(m_regnamesSubCut[i], false);
     if(nullptr != reg) { ptr->ActivateSubCutoff(reg); }
   }
+  n = m_regnamesRangeRej.size();
+  for(std::size_t i=0; i<n; ++i) {
+    const G4Region* reg = regionStore->GetRegion(m_regnamesRangeRej[i], false);
+    if(nullptr != reg) { ptr->ActivateRangeRejection(reg, m_elimRangeRej[i]); }
+  }
   n = m_procBiasedXS.size();
   for(std::size_t i=0; i<n; ++i) {
     if(ptr->GetProcessName() == m_procBiasedXS[i]) {
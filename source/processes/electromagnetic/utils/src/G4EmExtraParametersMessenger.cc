@@ -96,6 +96,27 @@ G4EmExtraParametersMessenger::G4EmExtraParametersMessenger(G4EmExtraParameters*
   SubSecCmd->AvailableForStates(G4State_PreInit);
   SubSecCmd->SetToBeBroadcasted(false);
 
+  rrejCmd = new G4UIcommand("/process/eLoss/RangeRejection",this);
+  rrejCmd->SetGuidance("Enable range rejection per region: a charged track below");
+  rrejCmd->SetGuidance("the energy limit is stopped and its energy is deposited");
+  rrejCmd->SetGuidance("locally if its range is below the safety.");
+  rrejCmd->SetGuidance("  rRegNam  : region name");
+  rrejCmd->SetGuidance("  rEnergy  : max kinetic energy of a track for range rejection");
+  rrejCmd->SetGuidance("  rUnit    : energy unit");
+  rrejCmd->AvailableForStates(G4State_PreInit);
+  rrejCmd->SetToBeBroadcasted(false);
+
+  auto rRegNam = new G4UIparameter("rRegNam",'s',false);
+  rrejCmd->SetParameter(rRegNam);
+
+  auto rEnergy = new G4UIparameter("rEnergy",'d',false);
+  rEnergy->SetParameterRange("rEnergy>0");
+  rrejCmd->SetParameter(rEnergy);
+
+  auto rUnit = new G4UIparameter("rUnit",'s',true);
+  rUnit->SetDefaultUnit("MeV");
+  rrejCmd->SetParameter(rUnit);
+
   StepFuncCmd = new G4UIcommand("/process/eLoss/StepFunction",this);
   StepFuncCmd->SetGuidance("Set the energy loss step limitation parameters for e+-.");
   StepFuncCmd->SetGuidance("  dRoverR   : max Range variation per step");
@@ -271,6 +292,7 @@ G4EmExtraParametersMessenger::~G4EmExtraParametersMessenger()
   delete paiCmd;
   delete mscoCmd;
   delete SubSecCmd;
+  delete rrejCmd;
   delete bfCmd;
   delete fiCmd;
   delete bsCmd;
@@ -319,6 +341,13 @@ void G4EmExtraParametersMessenger::SetNewValue(G4UIcommand* command,
     physicsModified = true;
   } else if (command == SubSecCmd) {
     theParameters->SetSubCutRegion(newValue);
+  } else if (command == rrejCmd) {
+    G4double en(0.0);
+    G4String s1(""),unt("MeV");
+    std::istringstream is(newValue);
+    is >> s1 >> en >> unt;
+    en *= G4UIcommand::ValueOf(unt);
+    theParameters->ActivateRangeRejection(s1,en);
   } else if (command == bfCmd) {
     G4double v1(1.0);
     G4String s0(""),s1("");
@@ -129,13 +129,16 @@ void G4EmParameters::Initialise()
   integral = true;
   birks = false;
   fICRU90 = false;
+  fSinglePrecision = false;
   gener = false;
+  fElectronGeneral = false;
   onIsolated = false;
   fSamplingTable = false;
   fPolarisation = false;
   fMuDataFromFile = false;
   fPEKShell = true;
   fMscPosiCorr = true;
+  fMscTabSampling = false;
   fDNA = false;
   fIsPrinted = false;
 
@@ -416,6 +419,17 @@ G4bool G4EmParameters::UseICRU90Data() const
   return fICRU90;
 }
 
+void G4EmParameters::SetSinglePrecisionTables(G4bool val)
+{
+  if(IsLocked()) { return; }
+  fSinglePrecision = val;
+}
+
+G4bool G4EmParameters::SinglePrecisionTables() const
+{
+  return fSinglePrecision;
+}
+
 void G4EmParameters::SetDNAFast(G4bool val)
 {
   if(IsLocked()) { return; }
@@ -463,6 +477,17 @@ G4bool G4EmParameters::GeneralProcessActive() const
   return gener;
 }
 
+void G4EmParameters::SetElectronGeneralProcessActive(G4bool val)
+{
+  if(IsLocked()) { return; }
+  fElectronGeneral = val;
+}
+
+G4bool G4EmParameters::ElectronGeneralProcessActive() const
+{
+  return fElectronGeneral;
+}
+
 void G4EmParameters::SetEmSaturation(G4EmSaturation* ptr)
 {
   if(IsLocked()) { return; }
@@ -527,6 +552,17 @@ void G4EmParameters::SetMscPositronCorrection(G4bool v)
   fMscPosiCorr = v;
 }
 
+G4bool G4EmParameters::MscTabulatedSampling() const
+{
+  return fMscTabSampling;
+}
+
+void G4EmParameters::SetMscTabulatedSampling(G4bool v)
+{
+  if(IsLocked()) { return; }
+  fMscTabSampling = v;
+}
+
 void G4EmParameters::ActivateDNA()
 {
   if(IsLocked()) { return; }
@@ -1199,6 +1235,13 @@ void G4EmParameters::SetSubCutRegion(const G4String& region)
   fBParameters->SetSubCutRegion(region);
 }
 
+void G4EmParameters::ActivateRangeRejection(const G4String& region,
+                                            G4double energyLim)
+{
+  if(IsLocked()) { return; }
+  fBParameters->ActivateRangeRejection(region, energyLim);
+}
+
 void 
 G4EmParameters::SetDeexActiveRegion(const G4String& region, G4bool adeex,
                                     G4bool aauger, G4bool apixe)
@@ -1315,6 +1358,7 @@ void G4EmParameters::StreamInfo(std::ostream& os) const
   }
   os << "Use combined TransportationWithMsc                 " <<transportationWithMsc << "\n";
   os << "Use general process                                " <<gener << "\n";
+  os << "Use e+- general process                            " <<fElectronGeneral << "\n";
   os << "Enable linear polarisation for gamma               " <<fPolarisation << "\n";
   os << "Enable photoeffect sampling below K-shell          " <<fPEKShell << "\n";
   os << "Enable sampling of quantum entanglement            " 
@@ -1365,6 +1409,7 @@ void G4EmParameters::StreamInfo(std::ostream& os) const
   os << "Lowest muon/hadron kinetic energy                  " 
      <<G4BestUnit(lowestMuHadEnergy,"Energy") << "\n";
   os << "Use ICRU90 data                                    " << fICRU90 << "\n";
+  os << "Single precision copies of energy loss tables      " << fSinglePrecision << "\n";
   os << "Fluctuations of dE/dx are enabled                  " <<lossFluctuation << "\n";
   G4String namef = "Universal";
   if(fFluct == fUrbanFluctuation) { namef = "Urban"; }
@@ -1389,6 +1434,7 @@ void G4EmParameters::StreamInfo(std::ostream& os) const
   os << "Type of msc step limit algorithm for muons/hadrons " <<mscStepLimitMuHad << "\n";
   os << "Msc lateral displacement for e+- enabled           " <<lateralDisplacement << "\n";
   os << "Msc lateral displacement for muons and hadrons     " <<muhadLateralDisplacement << "\n";
+  os << "Msc tabulated angular sampling for e+-             " <<fMscTabSampling << "\n";
   os << "Urban msc model lateral displacement alg96         " <<lateralDisplacementAlg96 << "\n";
   os << "Range factor for msc step limit for e+-            " <<rangeFactor << "\n";
   os << "Range factor for msc step limit for muons/hadrons  " <<rangeFactorMuHad << "\n";
@@ -163,6 +163,13 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   sharkCmd->AvailableForStates(G4State_PreInit);
   sharkCmd->SetToBeBroadcasted(false);
 
+  eGenCmd = new G4UIcmdWithABool("/process/em/UseElectronGeneralProcess",this);
+  eGenCmd->SetGuidance("Enable e+- general process");
+  eGenCmd->SetParameterName("egen",true);
+  eGenCmd->SetDefaultValue(false);
+  eGenCmd->AvailableForStates(G4State_PreInit);
+  eGenCmd->SetToBeBroadcasted(false);
+
   poCmd = new G4UIcmdWithABool("/process/em/Polarisation",this);
   poCmd->SetGuidance("Enable polarisation");
   poCmd->AvailableForStates(G4State_PreInit);
@@ -182,6 +189,14 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   icru90Cmd->AvailableForStates(G4State_PreInit);
   icru90Cmd->SetToBeBroadcasted(false);
 
+  floatCmd = new G4UIcmdWithABool("/process/em/singlePrecisionTables",this);
+  floatCmd->SetGuidance("Use single precision copies of energy loss tables at each step");
+  floatCmd->SetGuidance("the double precision tables are kept");
+  floatCmd->SetParameterName("floatTables",true);
+  floatCmd->SetDefaultValue(false);
+  floatCmd->AvailableForStates(G4State_PreInit);
+  floatCmd->SetToBeBroadcasted(false);
+
   mudatCmd = new G4UIcmdWithABool("/process/em/MuDataFromFile",this);
   mudatCmd->SetGuidance("Enable usage of muon data from file");
   mudatCmd->SetParameterName("mudat",true);
@@ -203,6 +218,13 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   mscPCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
   mscPCmd->SetToBeBroadcasted(false);
 
+  mscTCmd = new G4UIcmdWithABool("/process/msc/TabulatedSampling",this);
+  mscTCmd->SetGuidance("Enable tabulated sampling of msc angular distribution");
+  mscTCmd->SetParameterName("mscT",true);
+  mscTCmd->SetDefaultValue(false);
+  mscTCmd->AvailableForStates(G4State_PreInit);
+  mscTCmd->SetToBeBroadcasted(false);
+
   minEnCmd = new G4UIcmdWithADoubleAndUnit("/process/eLoss/minKinEnergy",this);
   minEnCmd->SetGuidance("Set the min kinetic energy for EM tables");
   minEnCmd->SetParameterName("emin",true);
@@ -475,13 +497,16 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
   delete mottCmd;
   delete birksCmd;
   delete sharkCmd;
+  delete eGenCmd;
   delete onIsolatedCmd;
   delete sampleTCmd;
   delete poCmd;
   delete icru90Cmd;
+  delete floatCmd;
   delete mudatCmd;
   delete peKCmd;
   delete mscPCmd;
+  delete mscTCmd;
 
   delete minEnCmd;
   delete maxEnCmd;
@@ -561,8 +586,12 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
     theParameters->SetBirksActive(birksCmd->GetNewBoolValue(newValue));
   } else if (command == icru90Cmd) {
     theParameters->SetUseICRU90Data(icru90Cmd->GetNewBoolValue(newValue));
+  } else if (command == floatCmd) {
+    theParameters->SetSinglePrecisionTables(floatCmd->GetNewBoolValue(newValue));
   } else if (command == sharkCmd) {
     theParameters->SetGeneralProcessActive(sharkCmd->GetNewBoolValue(newValue));
+  } else if (command == eGenCmd) {
+    theParameters->SetElectronGeneralProcessActive(eGenCmd->GetNewBoolValue(newValue));
   } else if (command == poCmd) {
     theParameters->SetEnablePolarisation(poCmd->GetNewBoolValue(newValue));
   } else if (command == sampleTCmd) {
@@ -573,6 +602,8 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
     theParameters->SetPhotoeffectBelowKShell(peKCmd->GetNewBoolValue(newValue));
   } else if (command == mscPCmd) {
     theParameters->SetMscPositronCorrection(mscPCmd->GetNewBoolValue(newValue));
+  } else if (command == mscTCmd) {
+    theParameters->SetMscTabulatedSampling(mscTCmd->GetNewBoolValue(newValue));
 
   } else if (command == minEnCmd) {
     theParameters->SetMinEnergy(minEnCmd->GetNewDoubleValue(newValue));
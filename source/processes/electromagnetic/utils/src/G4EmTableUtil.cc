@@ -427,6 +427,7 @@ G4EmTableUtil::BuildLocalElossProcess(G4VEnergyLossProcess* proc,
   proc->SetEnergyOfCrossSectionMax(masterProc->EnergyOfCrossSectionMax());
   proc->SetTwoPeaksXS(masterProc->TwoPeaksXS());
   proc->SetIonisation(masterProc->IsIonisationProcess());
+  proc->SetCompactTables(masterProc);
   G4bool baseMat = masterProc->UseBaseMaterial();
 
   // local initialisation of models
@@ -698,3 +699,27 @@ G4bool G4EmTableUtil::RetrieveTable(G4VProcess* ptr,
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+void G4EmTableUtil::BuildCompactTable(const G4VProcess* proc,
+                                      const G4ParticleDefinition* part,
+                                      const G4PhysicsTable* aTable,
+                                      G4PhysicsCompactTable<G4float>*& compact,
+                                      const G4String& tname,
+                                      const G4int verb)
+{
+  if(nullptr == aTable) {
+    delete compact;
+    compact = nullptr;
+    return;
+  }
+  if(nullptr == compact) { compact = new G4PhysicsCompactTable<G4float>(); }
+  compact->Build(*aTable);
+  if(1 < verb) {
+    G4cout << "### " << tname << " table for " << part->GetParticleName()
+           << " and " << proc->GetProcessName()
+           << " has a single precision copy; max relative deviation "
+           << compact->MaxDeviation(*aTable) << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
@@ -727,6 +727,7 @@ void G4LossTableManager::CopyTables(const G4ParticleDefinition* part,
       proc->SetInverseRangeTable(base_proc->InverseRangeTable());
       proc->SetLambdaTable(base_proc->LambdaTable());
       proc->SetIonisation(base_proc->IsIonisationProcess());
+      proc->SetCompactTables(base_proc);
       if(proc->IsIonisationProcess()) { 
         range_vector[j] = base_proc->RangeTableForLoss();
         inv_range_vector[j] = base_proc->InverseRangeTable();
@@ -900,6 +901,11 @@ G4VEnergyLossProcess* G4LossTableManager::BuildTables(
     em->SetCSDARangeTable(rCSDA);
   }
 
+  // optional single precision copies of the tables used at each step
+  if(theParameters->SinglePrecisionTables()) {
+    for (i=0; i<n_dedx; ++i) { loss_list[i]->BuildCompactTables(); }
+  }
+
   if (1 < verbose) {
     G4cout << "G4LossTableManager::BuildTables: Tables are built for "
            << aParticle->GetParticleName()
@@ -857,6 +857,20 @@ G4VEmProcess* G4VEmProcess::GetEmProcess(const G4String& nam)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+G4bool G4VEmProcess::HasSubProcess(const G4VProcess*) const
+{
+  return false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VProcess* G4VEmProcess::GetSubProcess(const G4String&) const
+{
+  return nullptr;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 G4double G4VEmProcess::PolarAngleLimit() const
 {
   return theParameters->MscThetaLimit();
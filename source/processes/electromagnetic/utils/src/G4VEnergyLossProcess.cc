@@ -139,7 +139,13 @@ G4VEnergyLossProcess::G4VEnergyLossProcess(const G4String& name,
 G4VEnergyLossProcess::~G4VEnergyLossProcess()
 {
   if (isMaster) {
-    if(nullptr == baseParticle) { delete theData; }
+    if(nullptr == baseParticle) {
+      delete theData;
+      delete theCompactDEDXTable;
+      delete theCompactRangeTable;
+      delete theCompactInverseRangeTable;
+      delete theCompactLambdaTable;
+    }
     delete theEnergyOfCrossSectionMax;
     if(nullptr != fXSpeaks) {
       for(auto const & v : *fXSpeaks) { delete v; }
@@ -149,6 +155,8 @@ G4VEnergyLossProcess::~G4VEnergyLossProcess()
   delete modelManager;
   delete biasManager;
   delete scoffRegions;
+  delete rrejRegions;
+  delete rrejEnergyLimits;
   delete emModels;
   lManager->DeRegister(this);
 }
@@ -500,6 +508,10 @@ void G4VEnergyLossProcess::StreamInfo(std::ostream& out,
     out << "      Subcutoff sampling in " << nSCoffRegions 
         << " regions" << G4endl;
   }
+  if(nRRejRegions>0 && isIonisation) {
+    out << "      Range rejection in " << nRRejRegions 
+        << " regions" << G4endl;
+  }
   if(2 < verboseLevel) {
     for(std::size_t i=0; i<7; ++i) {
       auto ta = theData->Table(i);
@@ -529,6 +541,28 @@ void G4VEnergyLossProcess::ActivateSubCutoff(const G4Region* r)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+void G4VEnergyLossProcess::ActivateRangeRejection(const G4Region* r,
+                                                  G4double energyLimit)
+{
+  if(nullptr == rrejRegions) {
+    rrejRegions = new std::vector<const G4Region*>;
+    rrejEnergyLimits = new std::vector<G4double>;
+  }
+  // the region is in the list
+  for(G4int i=0; i<nRRejRegions; ++i) {
+    if((*rrejRegions)[i] == r) {
+      (*rrejEnergyLimits)[i] = energyLimit;
+      return;
+    }
+  }
+  // new region
+  rrejRegions->push_back(r);
+  rrejEnergyLimits->push_back(energyLimit);
+  ++nRRejRegions;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 G4bool G4VEnergyLossProcess::IsRegionForCubcutProcessor(const G4Track& aTrack)
 {
   if(0 == nSCoffRegions) { return true; }
@@ -541,6 +575,25 @@ G4bool G4VEnergyLossProcess::IsRegionForCubcutProcessor(const G4Track& aTrack)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+G4bool G4VEnergyLossProcess::IsRangeRejected(const G4Step& step) const
+{
+  // the range for loss is not below the CSDA range, so the track cannot
+  // leave the sphere of isotropic safety of the pre-step point; the step
+  // done is inside this sphere as well
+  const G4StepPoint* preStep = step.GetPreStepPoint();
+  if(fRange >= preStep->GetSafety()) { return false; }
+  const G4Region* r = 
+    preStep->GetPhysicalVolume()->GetLogicalVolume()->GetRegion();
+  for(G4int i=0; i<nRRejRegions; ++i) {
+    if(r == (*rrejRegions)[i]) {
+      return (preStepKinEnergy < (*rrejEnergyLimits)[i]);
+    }
+  }
+  return false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 void G4VEnergyLossProcess::StartTracking(G4Track* track)
 {
   // reset parameters for the new track
@@ -599,12 +652,7 @@ G4double G4VEnergyLossProcess::PostStepGetPhysicalInteractionLength(
 
   // initialisation of material, mass, charge, model 
   // at the beginning of the step
-  DefineMaterial(track.GetMaterialCutsCouple());
-  preStepKinEnergy       = track.GetKineticEnergy();
-  preStepLogKinEnergy    = track.GetDynamicParticle()->GetLogKineticEnergy();
-  preStepScaledEnergy    = preStepKinEnergy*massRatio;
-  preStepLogScaledEnergy = preStepLogKinEnergy + logMassRatio;
-  SelectModel(preStepScaledEnergy);
+  PreStepSetup(track);
 
   if(!currentModel->IsActive(preStepScaledEnergy)) { 
     theNumberOfInteractionLengthLeft = -1.0;
@@ -802,8 +850,11 @@ G4VParticleChange* G4VEnergyLossProcess::AlongStepDoIt(const G4Track& track,
     fParticleChange.ProposeWeight(weight);
   }
 
-  // stopping, check actual range and kinetic energy
-  if (length >= fRange || preStepKinEnergy <= lowestKinEnergy) {
+  // stopping, check actual range and kinetic energy; in regions with
+  // range rejection the track is also stopped if it cannot leave the
+  // safety sphere
+  if (length >= fRange || preStepKinEnergy <= lowestKinEnergy ||
+      (0 < nRRejRegions && IsRangeRejected(step))) {
     eloss = preStepKinEnergy;
     if (useDeexcitation) {
       atomDeexcitation->AlongStepDeexcitation(scTracks, step, 
@@ -1316,6 +1367,43 @@ void G4VEnergyLossProcess::SetLambdaTable(G4PhysicsTable* p)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+void G4VEnergyLossProcess::BuildCompactTables()
+{
+  if(!isMaster || nullptr != baseParticle) { return; }
+  if(isIonisation) {
+    G4EmTableUtil::BuildCompactTable(this, particle, theDEDXTable,
+                                     theCompactDEDXTable, "DEDX",
+                                     verboseLevel);
+    G4EmTableUtil::BuildCompactTable(this, particle, theRangeTableForLoss,
+                                     theCompactRangeTable, "Range",
+                                     verboseLevel);
+    G4EmTableUtil::BuildCompactTable(this, particle, theInverseRangeTable,
+                                     theCompactInverseRangeTable,
+                                     "InverseRange", verboseLevel);
+  }
+  G4EmTableUtil::BuildCompactTable(this, particle, theLambdaTable,
+                                   theCompactLambdaTable, "Lambda",
+                                   verboseLevel);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4VEnergyLossProcess::SetCompactTables(const G4VEnergyLossProcess* p)
+{
+  // a copy is used only if it is the one of the table in use
+  theCompactDEDXTable = (theDEDXTable == p->theDEDXTable)
+    ? p->theCompactDEDXTable : nullptr;
+  theCompactRangeTable = (theRangeTableForLoss == p->theRangeTableForLoss)
+    ? p->theCompactRangeTable : nullptr;
+  theCompactInverseRangeTable = 
+    (theInverseRangeTable == p->theInverseRangeTable)
+    ? p->theCompactInverseRangeTable : nullptr;
+  theCompactLambdaTable = (theLambdaTable == p->theLambdaTable)
+    ? p->theCompactLambdaTable : nullptr;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 void G4VEnergyLossProcess::SetEnergyOfCrossSectionMax(std::vector<G4double>* p)
 {
   theEnergyOfCrossSectionMax = p;
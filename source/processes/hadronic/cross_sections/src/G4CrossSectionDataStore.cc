@@ -198,14 +198,14 @@ G4CrossSectionDataStore::SampleZandA(const G4DynamicParticle* dp,
   std::size_t nElements = mat->GetNumberOfElements();
   const G4Element* anElement = mat->GetElement(0);
 
-  // select element from a compound 
+  // select element from a compound: cumulative cross sections were
+  // computed with the material cross section, binary search is used
   if(1 < nElements) {
     G4double cross = matCrossSection*G4UniformRand();
-    for(G4int i=0; i<(G4int)nElements; ++i) {
-      if(cross <= xsecelm[i]) {
-        anElement = mat->GetElement(i);
-        break;
-      }
+    auto end = xsecelm.cbegin() + nElements;
+    auto pos = std::lower_bound(xsecelm.cbegin(), end, cross);
+    if(pos != end) { 
+      anElement = mat->GetElement((G4int)(pos - xsecelm.cbegin()));
     }
   }
 
@@ -255,11 +255,10 @@ G4CrossSectionDataStore::SampleZandA(const G4DynamicParticle* dp,
 	xseciso[j] = cross;
       }
       cross *= G4UniformRand();
-      for (j = 0; j<(G4int)nIso; ++j) {
-	if(cross <= xseciso[j]) {
-	  iso = anElement->GetIsotope(j);
-	  break;
-	}
+      auto end = xseciso.cbegin() + nIso;
+      auto pos = std::lower_bound(xseciso.cbegin(), end, cross);
+      if(pos != end) {
+	iso = anElement->GetIsotope((G4int)(pos - xseciso.cbegin()));
       }
     }
   }
@@ -0,0 +1,156 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+//
+//---------------------------------------------------------------
+//
+//  G4ParallelWorldMesh.hh
+//
+//  Description:
+//    Closed-form navigation in a parallel world consisting of a
+//   regular mesh: a single box or tube placed in the world, and
+//   segmented along its axes (x, y, z or rho, phi, z) by nested
+//   replicas or divisions, as built by G4ScoringBox and
+//   G4ScoringCylinder. The cell containing a point, the distance
+//   along a straight line to the next cell and the isotropic
+//   safety are computed analytically in the frame of the mesh,
+//   without navigator or navigation history.
+//    The layout of the world is checked at construction; IsValid()
+//   returns false for any other layout, in which case the mesh is
+//   not to be used.
+//
+//---------------------------------------------------------------
+
+#ifndef G4ParallelWorldMesh_h
+#define G4ParallelWorldMesh_h 1
+
+#include "G4AffineTransform.hh"
+#include "G4ThreeVector.hh"
+#include "geomdefs.hh"
+#include "globals.hh"
+
+#include <vector>
+
+class G4Navigator;
+class G4TouchableHistory;
+class G4VPhysicalVolume;
+class G4VSolid;
+class G4VTouchable;
+
+class G4ParallelWorldMesh
+{
+  public:
+    // Cell of the mesh; indices along the axes of the mesh
+    // (x, y, z for a box; rho, phi, z for a tube)
+    struct Cell
+    {
+        G4int index[3] = {0, 0, 0};
+        G4bool inside = false;
+
+        inline G4bool operator==(const Cell& other) const
+        {
+          return inside == other.inside
+                 && (!inside
+                     || (index[0] == other.index[0] && index[1] == other.index[1]
+                         && index[2] == other.index[2]));
+        }
+    };
+
+  public:
+    G4ParallelWorldMesh(G4VPhysicalVolume* parallelWorld, G4Navigator* navigator);
+    ~G4ParallelWorldMesh() = default;
+
+    G4ParallelWorldMesh(const G4ParallelWorldMesh&) = delete;
+    G4ParallelWorldMesh& operator=(const G4ParallelWorldMesh&) = delete;
+
+    inline G4bool IsValid() const { return fValid; }
+    inline G4bool IsCylindrical() const { return fCylindrical; }
+    inline G4double GetTolerance() const { return fTolerance; }
+
+    // Cell containing the point; points on the boundary of cells are
+    // assigned to the cell into which the direction points
+    Cell Locate(const G4ThreeVector& globalPoint, const G4ThreeVector& globalDirection) const;
+
+    // Distance along a straight line to the boundary of the current
+    // cell (or to the mesh, if outside); the cell entered is returned
+    G4double ComputeStep(const G4ThreeVector& globalPoint,
+                         const G4ThreeVector& globalDirection, const Cell& cell,
+                         Cell& nextCell) const;
+
+    // Isotropic safety, to the boundaries of the current cell
+    // (or to the mesh, if outside)
+    G4double ComputeSafety(const G4ThreeVector& globalPoint, const Cell& cell) const;
+
+    // Touchable for the cell; a touchable history is only
+    // created, through the navigator, if requested to it
+    G4VTouchable* CreateTouchable(const Cell& cell, const G4ThreeVector& globalPoint,
+                                  const G4ThreeVector& globalDirection) const;
+    G4TouchableHistory* CreateTouchableHistory(const Cell& cell,
+                                               const G4ThreeVector& globalPoint,
+                                               const G4ThreeVector& globalDirection) const;
+
+    // Volume hierarchy: level 0 is the world, level 1 the mesh
+    // envelope and the following ones the nested segmentations
+    inline G4int GetNumberOfLevels() const { return G4int(fLevels.size()); }
+    G4VPhysicalVolume* GetVolume(G4int level) const;
+    G4int GetReplicaNumber(G4int level, const Cell& cell) const;
+
+  private:
+    struct Level
+    {
+        G4VPhysicalVolume* volume = nullptr;
+        G4int axis = -1;  // Mesh axis segmented at this level, -1 if none
+    };
+
+    G4bool Setup();
+    G4int MeshAxis(EAxis axis) const;
+    G4double Coordinate(const G4ThreeVector& localPoint, G4int axis) const;
+    G4double CoordinateRate(const G4ThreeVector& localPoint,
+                            const G4ThreeVector& localDirection, G4int axis) const;
+    Cell LocateLocal(const G4ThreeVector& localPoint, const G4ThreeVector& localDirection) const;
+    G4double StepInBox(const G4ThreeVector& p, const G4ThreeVector& v, const Cell& cell,
+                       Cell& nextCell) const;
+    G4double StepInTube(const G4ThreeVector& p, const G4ThreeVector& v, const Cell& cell,
+                        Cell& nextCell) const;
+
+  private:
+    G4VPhysicalVolume* fWorld = nullptr;
+    G4Navigator* fNavigator = nullptr;
+    G4VSolid* fEnvelope = nullptr;
+    std::vector<Level> fLevels;
+    G4AffineTransform fToLocal;  // From world to mesh frame
+    G4AffineTransform fToGlobal;  // From mesh frame to world
+    G4bool fValid = false;
+    G4bool fCylindrical = false;
+    G4bool fFullPhi = false;  // Tube covering 2*pi
+    G4int fNbins[3] = {1, 1, 1};
+    G4double fLow[3] = {0., 0., 0.};  // Lower edge of the mesh along each axis
+    G4double fWidth[3] = {0., 0., 0.};  // Width of the cells along each axis
+    G4double fTolerance;
+};
+
+#endif
@@ -0,0 +1,89 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+//
+//---------------------------------------------------------------
+//
+//  G4ParallelWorldMeshTouchable.hh
+//
+//  Description:
+//    Touchable for a cell of a G4ParallelWorldMesh. Volumes and
+//   replica numbers of all the levels are given by the mesh;
+//   translations, rotations and the navigation history, seldom
+//   used by scorers, are taken from a touchable history which is
+//   only created when first requested. It is a G4TouchableHistory,
+//   so that scorers casting the touchable of a step point to
+//   G4TouchableHistory remain valid.
+//
+//---------------------------------------------------------------
+
+#ifndef G4ParallelWorldMeshTouchable_h
+#define G4ParallelWorldMeshTouchable_h 1
+
+#include "G4ParallelWorldMesh.hh"
+#include "G4TouchableHistory.hh"
+
+class G4ParallelWorldMeshTouchable : public G4TouchableHistory
+{
+  public:
+    G4ParallelWorldMeshTouchable(const G4ParallelWorldMesh* mesh,
+                                 const G4ParallelWorldMesh::Cell& cell,
+                                 const G4ThreeVector& globalPoint,
+                                 const G4ThreeVector& globalDirection);
+    ~G4ParallelWorldMeshTouchable() override;
+
+    G4ParallelWorldMeshTouchable(const G4ParallelWorldMeshTouchable&) = delete;
+    G4ParallelWorldMeshTouchable& operator=(const G4ParallelWorldMeshTouchable&) = delete;
+
+    const G4ThreeVector& GetTranslation(G4int depth = 0) const override;
+    const G4RotationMatrix* GetRotation(G4int depth = 0) const override;
+    G4VPhysicalVolume* GetVolume(G4int depth = 0) const override;
+    G4VSolid* GetSolid(G4int depth = 0) const override;
+    G4int GetReplicaNumber(G4int depth = 0) const override;
+    G4int GetHistoryDepth() const override;
+    G4int MoveUpHistory(G4int num_levels = 1) override;
+    const G4NavigationHistory* GetHistory() const override;
+
+    // The G4Allocator of the base class is for objects of its own size
+    inline void* operator new(std::size_t sz) { return ::operator new(sz); }
+    inline void operator delete(void* ptr) { ::operator delete(ptr); }
+
+    inline const G4ParallelWorldMesh::Cell& GetCell() const { return fCell; }
+
+  private:
+    G4TouchableHistory* GetTouchableHistory() const;
+
+  private:
+    const G4ParallelWorldMesh* fMesh;
+    G4ParallelWorldMesh::Cell fCell;
+    G4ThreeVector fPoint;
+    G4ThreeVector fDirection;
+    G4int fDepth;  // Current depth of the history
+    mutable G4TouchableHistory* fTouchableHistory = nullptr;
+};
+
+#endif
@@ -38,6 +38,10 @@
 //    It switches a material (and a region if defined) in the
 //   assigned parallel world over the material (and the region)
 //   in the mass world.
+//    If enabled with SetMeshNavigation() and the parallel world is
+//   a regular box or tube mesh (see G4ParallelWorldMesh), tracks
+//   moving on straight lines are navigated in it analytically,
+//   without the navigator of the parallel world.
 //
 //---------------------------------------------------------------
 
@@ -46,10 +50,13 @@
 
 #include "G4FieldTrack.hh"
 #include "G4MultiNavigator.hh"
+#include "G4ParallelWorldMesh.hh"
 #include "G4TouchableHandle.hh"
 #include "G4VProcess.hh"
 #include "globals.hh"
 
+#include <memory>
+
 class G4Step;
 class G4StepPoint;
 class G4Navigator;
@@ -120,6 +127,13 @@ class G4ParallelWorldProcess : public G4VProcess
     inline void SetLayeredMaterialFlag(G4bool flg = true) { layeredMaterialFlag = flg; }
     inline G4bool GetLayeredMaterialFlag() const { return layeredMaterialFlag; }
 
+    //-----------------------------------------------------------------------
+    // Flag for analytic navigation in regular mesh worlds (default: false)
+    //-----------------------------------------------------------------------
+
+    inline void SetMeshNavigation(G4bool flg = true) { meshNavigationFlag = flg; }
+    inline G4bool GetMeshNavigation() const { return meshNavigationFlag; }
+
     //--------------------------------------------------------------------
     // Returns whether a particular particle type requires AtRest process
     //--------------------------------------------------------------------
@@ -134,6 +148,9 @@ class G4ParallelWorldProcess : public G4VProcess
   protected:
     void CopyStep(const G4Step& step);
     void SwitchMaterial(G4StepPoint*);
+    G4bool IsMeshNavigable(const G4Track*);
+    G4double MeshAlongStepGPIL(const G4Track&, G4double, G4double&, G4GPILSelection*);
+    G4bool MeshPostStepLocate(const G4Track&, const G4Step&);
 
   protected:
     G4Step* fGhostStep;
@@ -159,10 +176,24 @@ class G4ParallelWorldProcess : public G4VProcess
     G4double fGhostSafety{0.};
     G4bool fOnBoundary{false};
 
+    // ----------------------------------------
+    // Analytic navigation in a mesh world:
+    // ----------------------------------------
+    std::unique_ptr<G4ParallelWorldMesh> fMesh;
+    G4bool fMeshChecked{false};
+    G4bool fFieldChecked{false};
+    G4bool fLocalFieldPresent{false};
+    G4bool fOnMesh{false};  // Current track navigated in the mesh
+    G4ParallelWorldMesh::Cell fMeshCell;
+    G4ParallelWorldMesh::Cell fNextMeshCell;
+    G4double fMeshStep{0.};
+    G4ThreeVector fMeshEndPoint;
+
     //-----------------------------------------------------------------------
     // Flag for material switching
     //-----------------------------------------------------------------------
     G4bool layeredMaterialFlag{false};
+    G4bool meshNavigationFlag{false};
 
   private:
     static G4ThreadLocal G4Step* fpHyperStep;
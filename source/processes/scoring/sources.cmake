@@ -3,6 +3,8 @@
 # Define the Geant4 Module.
 geant4_add_module(G4scoring
   PUBLIC_HEADERS
+    G4ParallelWorldMesh.hh
+    G4ParallelWorldMeshTouchable.hh
     G4ParallelWorldProcess.hh
     G4ParallelWorldProcessStore.hh
     G4ParallelWorldScoringProcess.hh
@@ -12,6 +14,8 @@ geant4_add_module(G4scoring
     G4EnergySplitter.icc
   SOURCES
     G4EnergySplitter.cc
+    G4ParallelWorldMesh.cc
+    G4ParallelWorldMeshTouchable.cc
     G4ParallelWorldProcess.cc
     G4ParallelWorldProcessStore.cc
     G4ParallelWorldScoringProcess.cc
@@ -25,6 +29,7 @@ geant4_module_link_libraries(G4scoring
     G4navigation
     G4procman
   PRIVATE
+    G4csg
     G4cuts
     G4detector
     G4emutils
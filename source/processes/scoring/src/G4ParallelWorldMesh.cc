@@ -0,0 +1,450 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+//
+//---------------------------------------------------------------
+//
+//  G4ParallelWorldMesh.cc
+//
+//---------------------------------------------------------------
+
+#include "G4ParallelWorldMesh.hh"
+
+#include "G4Box.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Navigator.hh"
+#include "G4ParallelWorldMeshTouchable.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4TouchableHistory.hh"
+#include "G4Tubs.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr G4double kRelTolerance = 1.e-9;
+
+inline G4double Component(const G4ThreeVector& v, G4int axis)
+{
+  return (axis == 0) ? v.x() : ((axis == 1) ? v.y() : v.z());
+}
+}  // namespace
+
+G4ParallelWorldMesh::G4ParallelWorldMesh(G4VPhysicalVolume* parallelWorld,
+                                         G4Navigator* navigator)
+  : fWorld(parallelWorld), fNavigator(navigator)
+{
+  fTolerance = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  fValid = Setup();
+  if (!fValid) fLevels.clear();
+}
+
+G4bool G4ParallelWorldMesh::Setup()
+{
+  if (fWorld == nullptr || fNavigator == nullptr) return false;
+
+  // A single envelope, box or tube, placed in the world
+  G4LogicalVolume* worldLogical = fWorld->GetLogicalVolume();
+  if (worldLogical->GetNoDaughters() != 1) return false;
+  G4VPhysicalVolume* envelope = worldLogical->GetDaughter(0);
+  if (envelope->IsReplicated()) return false;
+  fEnvelope = envelope->GetLogicalVolume()->GetSolid();
+
+  G4double extent[3];
+  if (fEnvelope->GetEntityType() == "G4Box") {
+    auto box = static_cast<G4Box*>(fEnvelope);
+    extent[0] = 2. * box->GetXHalfLength();
+    extent[1] = 2. * box->GetYHalfLength();
+    extent[2] = 2. * box->GetZHalfLength();
+    for (G4int a = 0; a < 3; ++a) {
+      fLow[a] = -0.5 * extent[a];
+    }
+  }
+  else if (fEnvelope->GetEntityType() == "G4Tubs") {
+    auto tubs = static_cast<G4Tubs*>(fEnvelope);
+    fCylindrical = true;
+    fLow[0] = tubs->GetInnerRadius();
+    fLow[1] = tubs->GetStartPhiAngle();
+    fLow[2] = -tubs->GetZHalfLength();
+    extent[0] = tubs->GetOuterRadius() - tubs->GetInnerRadius();
+    extent[1] = tubs->GetDeltaPhiAngle();
+    extent[2] = 2. * tubs->GetZHalfLength();
+    fFullPhi = extent[1] >= twopi * (1. - kRelTolerance);
+  }
+  else {
+    return false;
+  }
+  for (G4int a = 0; a < 3; ++a) {
+    fWidth[a] = extent[a];
+  }
+
+  fToGlobal = G4AffineTransform(envelope->GetRotation(), envelope->GetTranslation());
+  fToLocal = fToGlobal.Inverse();
+  fLevels.push_back({fWorld, -1});
+  fLevels.push_back({envelope, -1});
+
+  // A chain of single daughters, each segmenting the envelope along
+  // one of its axes, or placed with no transformation
+  G4bool segmented[3] = {false, false, false};
+  G4LogicalVolume* mother = envelope->GetLogicalVolume();
+  while (mother->GetNoDaughters() != 0) {
+    if (mother->GetNoDaughters() != 1) return false;
+    G4VPhysicalVolume* daughter = mother->GetDaughter(0);
+    if (daughter->IsReplicated()) {
+      EAxis axis;
+      G4int nReplicas;
+      G4double width, offset;
+      G4bool consuming;
+      daughter->GetReplicationData(axis, nReplicas, width, offset, consuming);
+      G4int a = MeshAxis(axis);
+      if (a < 0 || segmented[a] || nReplicas < 1) return false;
+      if (std::abs(nReplicas * width - extent[a]) > kRelTolerance * extent[a]) return false;
+
+      // Cells must start at the lower edge of the envelope: offsets of
+      // divisions are relative to it, those of replicas in rho and phi
+      // are absolute
+      if (daughter->IsParameterised()) {
+        if (std::abs(offset) > kRelTolerance * extent[a]) return false;
+      }
+      else if (fCylindrical && a == 0) {
+        if (std::abs(offset - fLow[0]) > kRelTolerance * extent[0] + fTolerance) return false;
+      }
+      else if (fCylindrical && a == 1) {
+        // A full circle may be segmented starting from any angle
+        if (fFullPhi) {
+          fLow[1] = offset;
+        }
+        else if (std::abs(std::remainder(offset - fLow[1], twopi)) > kRelTolerance) {
+          return false;
+        }
+      }
+      segmented[a] = true;
+      fNbins[a] = nReplicas;
+      fWidth[a] = extent[a] / nReplicas;
+      fLevels.push_back({daughter, a});
+    }
+    else {
+      const G4RotationMatrix* rotation = daughter->GetRotation();
+      if (rotation != nullptr && !rotation->isIdentity()) return false;
+      if (daughter->GetTranslation().mag2() > fTolerance * fTolerance) return false;
+      G4ThreeVector mMin, mMax, dMin, dMax;
+      mother->GetSolid()->BoundingLimits(mMin, mMax);
+      daughter->GetLogicalVolume()->GetSolid()->BoundingLimits(dMin, dMax);
+      if ((mMin - dMin).mag() > fTolerance || (mMax - dMax).mag() > fTolerance) return false;
+      fLevels.push_back({daughter, -1});
+    }
+    mother = daughter->GetLogicalVolume();
+  }
+  return true;
+}
+
+G4int G4ParallelWorldMesh::MeshAxis(EAxis axis) const
+{
+  if (fCylindrical) {
+    if (axis == kRho) return 0;
+    if (axis == kPhi) return 1;
+    if (axis == kZAxis) return 2;
+  }
+  else {
+    if (axis == kXAxis) return 0;
+    if (axis == kYAxis) return 1;
+    if (axis == kZAxis) return 2;
+  }
+  return -1;
+}
+
+G4double G4ParallelWorldMesh::Coordinate(const G4ThreeVector& p, G4int axis) const
+{
+  if (!fCylindrical || axis == 2) return Component(p, axis);
+  if (axis == 0) return p.perp();
+  // Angle taken within the turn centred on the middle of the phi section,
+  // so that points around the edges of an open section are not wrapped
+  G4double centre = fLow[1] + 0.5 * fNbins[1] * fWidth[1];
+  return centre + std::remainder(std::atan2(p.y(), p.x()) - centre, twopi);
+}
+
+G4double G4ParallelWorldMesh::CoordinateRate(const G4ThreeVector& p, const G4ThreeVector& v,
+                                             G4int axis) const
+{
+  if (!fCylindrical || axis == 2) return Component(v, axis);
+  G4double rho2 = p.perp2();
+  if (axis == 0) {
+    return (rho2 > 0.) ? (p.x() * v.x() + p.y() * v.y()) / std::sqrt(rho2) : v.perp();
+  }
+  return (rho2 > 0.) ? (p.x() * v.y() - p.y() * v.x()) / rho2 : 0.;
+}
+
+G4ParallelWorldMesh::Cell G4ParallelWorldMesh::LocateLocal(const G4ThreeVector& p,
+                                                           const G4ThreeVector& v) const
+{
+  Cell cell;
+  EInside in = fEnvelope->Inside(p);
+  if (in == kOutside) return cell;
+  if (in == kSurface && fEnvelope->SurfaceNormal(p).dot(v) >= 0.) return cell;
+
+  cell.inside = true;
+  for (G4int a = 0; a < 3; ++a) {
+    G4int n = fNbins[a];
+    if (n == 1) continue;
+    G4double f = (Coordinate(p, a) - fLow[a]) / fWidth[a];
+    auto i = (G4int)std::floor(f);
+
+    // On the boundary between two cells, take the one into which
+    // the direction points
+    auto k = (G4int)std::lround(f);
+    G4double tolerance = fTolerance;
+    if (fCylindrical && a == 1) tolerance /= std::max(p.perp(), fTolerance);
+    if (std::abs(f - k) * fWidth[a] < tolerance) {
+      i = (CoordinateRate(p, v, a) >= 0.) ? k : k - 1;
+    }
+    if (fCylindrical && a == 1 && fFullPhi) {
+      i = ((i % n) + n) % n;
+    }
+    else {
+      i = std::min(std::max(i, 0), n - 1);
+    }
+    cell.index[a] = i;
+  }
+  return cell;
+}
+
+G4ParallelWorldMesh::Cell G4ParallelWorldMesh::Locate(const G4ThreeVector& globalPoint,
+                                                      const G4ThreeVector& globalDirection) const
+{
+  return LocateLocal(fToLocal.TransformPoint(globalPoint), fToLocal.TransformAxis(globalDirection));
+}
+
+G4double G4ParallelWorldMesh::ComputeStep(const G4ThreeVector& globalPoint,
+                                          const G4ThreeVector& globalDirection,
+                                          const Cell& cell, Cell& nextCell) const
+{
+  G4ThreeVector p = fToLocal.TransformPoint(globalPoint);
+  G4ThreeVector v = fToLocal.TransformAxis(globalDirection);
+  if (!cell.inside) {
+    nextCell = cell;
+    G4double dist = fEnvelope->DistanceToIn(p, v);
+    if (dist == kInfinity) return kInfinity;
+    nextCell = LocateLocal(p + dist * v, v);
+    return nextCell.inside ? dist : kInfinity;  // Grazing the envelope
+  }
+  return fCylindrical ? StepInTube(p, v, cell, nextCell) : StepInBox(p, v, cell, nextCell);
+}
+
+G4double G4ParallelWorldMesh::StepInBox(const G4ThreeVector& p, const G4ThreeVector& v,
+                                        const Cell& cell, Cell& nextCell) const
+{
+  G4double dist[3];
+  G4double step = kInfinity;
+  for (G4int a = 0; a < 3; ++a) {
+    G4double low = fLow[a] + cell.index[a] * fWidth[a];
+    G4double va = Component(v, a);
+    dist[a] = kInfinity;
+    if (va > 0.) {
+      dist[a] = std::max((low + fWidth[a] - Component(p, a)) / va, 0.);
+    }
+    else if (va < 0.) {
+      dist[a] = std::max((low - Component(p, a)) / va, 0.);
+    }
+    step = std::min(step, dist[a]);
+  }
+
+  // Cross all the boundaries met at the end of the step (edges, corners)
+  nextCell = cell;
+  for (G4int a = 0; a < 3; ++a) {
+    if (dist[a] > step + fTolerance) continue;
+    nextCell.index[a] += (Component(v, a) > 0.) ? 1 : -1;
+    if (nextCell.index[a] < 0 || nextCell.index[a] >= fNbins[a]) nextCell.inside = false;
+  }
+  return step;
+}
+
+G4double G4ParallelWorldMesh::StepInTube(const G4ThreeVector& p, const G4ThreeVector& v,
+                                         const Cell& cell, Cell& nextCell) const
+{
+  // Planes in z
+  G4double distZ = kInfinity;
+  G4double zlow = fLow[2] + cell.index[2] * fWidth[2];
+  if (v.z() > 0.) {
+    distZ = std::max((zlow + fWidth[2] - p.z()) / v.z(), 0.);
+  }
+  else if (v.z() < 0.) {
+    distZ = std::max((zlow - p.z()) / v.z(), 0.);
+  }
+
+  // Cylinders in rho
+  G4double distRmax = kInfinity, distRmin = kInfinity;
+  G4double rlow = fLow[0] + cell.index[0] * fWidth[0];
+  G4double rhigh = rlow + fWidth[0];
+  G4double a2 = v.x() * v.x() + v.y() * v.y();
+  G4double b = p.x() * v.x() + p.y() * v.y();
+  G4double r2 = p.x() * p.x() + p.y() * p.y();
+  if (a2 > 0.) {
+    G4double disc = b * b - a2 * (r2 - rhigh * rhigh);
+    if (disc > 0.) distRmax = std::max((-b + std::sqrt(disc)) / a2, 0.);
+    if (rlow > 0. && b < 0.) {
+      disc = b * b - a2 * (r2 - rlow * rlow);
+      if (disc >= 0.) distRmin = std::max((-b - std::sqrt(disc)) / a2, 0.);
+    }
+  }
+
+  // Half-planes in phi, only crossed when moving outwards
+  G4double distPmin = kInfinity, distPmax = kInfinity;
+  if (fNbins[1] > 1 || !fFullPhi) {
+    G4double phi = fLow[1] + cell.index[1] * fWidth[1];
+    for (G4int side = 0; side < 2; ++side) {
+      if (side == 1) phi += fWidth[1];
+      G4double sinPhi = std::sin(phi), cosPhi = std::cos(phi);
+      G4double sign = (side == 0) ? 1. : -1.;
+      G4double vn = sign * (v.x() * sinPhi - v.y() * cosPhi);
+      if (vn <= 0.) continue;
+      G4double pn = sign * (p.x() * sinPhi - p.y() * cosPhi);
+      G4double dist = std::max(-pn / vn, 0.);
+      G4double hx = p.x() + dist * v.x(), hy = p.y() + dist * v.y();
+      if (hx * cosPhi + hy * sinPhi < -fTolerance) continue;
+      if (side == 0) {
+        distPmin = dist;
+      }
+      else {
+        distPmax = dist;
+      }
+    }
+  }
+
+  G4double step = std::min(std::min(distZ, std::min(distRmin, distRmax)),
+                            std::min(distPmin, distPmax));
+
+  // Cross all the boundaries met at the end of the step
+  nextCell = cell;
+  G4int n = fNbins[2];
+  if (distZ <= step + fTolerance) {
+    nextCell.index[2] += (v.z() > 0.) ? 1 : -1;
+    if (nextCell.index[2] < 0 || nextCell.index[2] >= n) nextCell.inside = false;
+  }
+  n = fNbins[0];
+  if (distRmax <= step + fTolerance) {
+    if (++nextCell.index[0] >= n) nextCell.inside = false;
+  }
+  else if (distRmin <= step + fTolerance) {
+    if (--nextCell.index[0] < 0) nextCell.inside = false;
+  }
+  n = fNbins[1];
+  if (std::min(distPmin, distPmax) <= step + fTolerance) {
+    G4ThreeVector q = p + step * v;
+    if (q.perp() < fTolerance) {
+      // Crossing the axis: the cell entered is not a neighbour
+      Cell located = LocateLocal(q + 1.e3 * fTolerance * v, v);
+      nextCell.index[1] = located.index[1];
+    }
+    else {
+      nextCell.index[1] += (distPmax <= distPmin) ? 1 : -1;
+      if (fFullPhi) {
+        nextCell.index[1] = (nextCell.index[1] + n) % n;
+      }
+      else if (nextCell.index[1] < 0 || nextCell.index[1] >= n) {
+        nextCell.inside = false;
+      }
+    }
+  }
+  return step;
+}
+
+G4double G4ParallelWorldMesh::ComputeSafety(const G4ThreeVector& globalPoint,
+                                            const Cell& cell) const
+{
+  G4ThreeVector p = fToLocal.TransformPoint(globalPoint);
+  if (!cell.inside) return fEnvelope->DistanceToIn(p);
+
+  G4double safety = kInfinity;
+  for (G4int a = 0; a < 3; ++a) {
+    if (fCylindrical && a != 2) continue;
+    G4double low = fLow[a] + cell.index[a] * fWidth[a];
+    G4double u = Component(p, a);
+    safety = std::min(safety, std::min(u - low, low + fWidth[a] - u));
+  }
+  if (fCylindrical) {
+    G4double rho = p.perp();
+    G4double rlow = fLow[0] + cell.index[0] * fWidth[0];
+    safety = std::min(safety, rlow + fWidth[0] - rho);
+    if (rlow > 0.) safety = std::min(safety, rho - rlow);
+    if (fNbins[1] > 1 || !fFullPhi) {
+      G4double dphi = Coordinate(p, 1) - (fLow[1] + cell.index[1] * fWidth[1]);
+      if (dphi > fWidth[1] + pi) dphi -= twopi;
+      for (G4double angle : {dphi, fWidth[1] - dphi}) {
+        angle = std::max(angle, 0.);
+        safety = std::min(safety, (angle >= halfpi) ? rho : rho * std::sin(angle));
+      }
+    }
+  }
+  return std::max(safety, 0.);
+}
+
+G4VTouchable* G4ParallelWorldMesh::CreateTouchable(const Cell& cell,
+                                                   const G4ThreeVector& globalPoint,
+                                                   const G4ThreeVector& globalDirection) const
+{
+  return new G4ParallelWorldMeshTouchable(this, cell, globalPoint, globalDirection);
+}
+
+G4TouchableHistory*
+G4ParallelWorldMesh::CreateTouchableHistory(const Cell& cell, const G4ThreeVector& globalPoint,
+                                            const G4ThreeVector& globalDirection) const
+{
+  if (cell.inside) {
+    // Locate the centre of the cell, free of ambiguities
+    G4double u[3];
+    for (G4int a = 0; a < 3; ++a) {
+      u[a] = fLow[a] + (cell.index[a] + 0.5) * fWidth[a];
+    }
+    G4ThreeVector centre(u[0], u[1], u[2]);
+    if (fCylindrical) {
+      centre.set(u[0] * std::cos(u[1]), u[0] * std::sin(u[1]), u[2]);
+    }
+    fNavigator->LocateGlobalPointAndSetup(fToGlobal.TransformPoint(centre), nullptr, false,
+                                          true);
+  }
+  else {
+    fNavigator->LocateGlobalPointAndSetup(globalPoint, &globalDirection, false, false);
+  }
+  return fNavigator->CreateTouchableHistory();
+}
+
+G4VPhysicalVolume* G4ParallelWorldMesh::GetVolume(G4int level) const
+{
+  if (level < 0 || level >= G4int(fLevels.size())) return nullptr;
+  return fLevels[level].volume;
+}
+
+G4int G4ParallelWorldMesh::GetReplicaNumber(G4int level, const Cell& cell) const
+{
+  if (level < 0 || level >= G4int(fLevels.size())) return -1;
+  const Level& lev = fLevels[level];
+  return (lev.axis >= 0) ? cell.index[lev.axis] : lev.volume->GetCopyNo();
+}
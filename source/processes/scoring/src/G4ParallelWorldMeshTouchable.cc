@@ -0,0 +1,106 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+//
+//---------------------------------------------------------------
+//
+//  G4ParallelWorldMeshTouchable.cc
+//
+//---------------------------------------------------------------
+
+#include "G4ParallelWorldMeshTouchable.hh"
+
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+
+#include <algorithm>
+
+G4ParallelWorldMeshTouchable::G4ParallelWorldMeshTouchable(
+  const G4ParallelWorldMesh* mesh, const G4ParallelWorldMesh::Cell& cell,
+  const G4ThreeVector& globalPoint, const G4ThreeVector& globalDirection)
+  : fMesh(mesh), fCell(cell), fPoint(globalPoint), fDirection(globalDirection)
+{
+  fDepth = cell.inside ? mesh->GetNumberOfLevels() - 1 : 0;
+}
+
+G4ParallelWorldMeshTouchable::~G4ParallelWorldMeshTouchable()
+{
+  delete fTouchableHistory;
+}
+
+G4TouchableHistory* G4ParallelWorldMeshTouchable::GetTouchableHistory() const
+{
+  if (fTouchableHistory == nullptr) {
+    fTouchableHistory = fMesh->CreateTouchableHistory(fCell, fPoint, fDirection);
+    fTouchableHistory->MoveUpHistory(fTouchableHistory->GetHistoryDepth() - fDepth);
+  }
+  return fTouchableHistory;
+}
+
+const G4ThreeVector& G4ParallelWorldMeshTouchable::GetTranslation(G4int depth) const
+{
+  return GetTouchableHistory()->GetTranslation(depth);
+}
+
+const G4RotationMatrix* G4ParallelWorldMeshTouchable::GetRotation(G4int depth) const
+{
+  return GetTouchableHistory()->GetRotation(depth);
+}
+
+G4VPhysicalVolume* G4ParallelWorldMeshTouchable::GetVolume(G4int depth) const
+{
+  return fMesh->GetVolume(fDepth - depth);
+}
+
+G4VSolid* G4ParallelWorldMeshTouchable::GetSolid(G4int depth) const
+{
+  G4VPhysicalVolume* volume = GetVolume(depth);
+  return (volume != nullptr) ? volume->GetLogicalVolume()->GetSolid() : nullptr;
+}
+
+G4int G4ParallelWorldMeshTouchable::GetReplicaNumber(G4int depth) const
+{
+  return fMesh->GetReplicaNumber(fDepth - depth, fCell);
+}
+
+G4int G4ParallelWorldMeshTouchable::GetHistoryDepth() const
+{
+  return fDepth;
+}
+
+G4int G4ParallelWorldMeshTouchable::MoveUpHistory(G4int num_levels)
+{
+  num_levels = std::min(std::max(num_levels, 0), fDepth);
+  fDepth -= num_levels;
+  if (fTouchableHistory != nullptr) fTouchableHistory->MoveUpHistory(num_levels);
+  return num_levels;
+}
+
+const G4NavigationHistory* G4ParallelWorldMeshTouchable::GetHistory() const
+{
+  return GetTouchableHistory()->GetHistory();
+}
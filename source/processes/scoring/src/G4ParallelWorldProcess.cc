@@ -29,7 +29,10 @@
 
 #include "G4ParallelWorldProcess.hh"
 
+#include "G4FieldManager.hh"
 #include "G4FieldTrackUpdator.hh"
+#include "G4LogicalVolume.hh"
+#include "G4LogicalVolumeStore.hh"
 #include "G4Material.hh"
 #include "G4Navigator.hh"
 #include "G4ParallelWorldProcessStore.hh"
@@ -102,6 +105,9 @@ void G4ParallelWorldProcess::SetParallelWorld(G4String parallelWorldName)
   fGhostWorld = fTransportationManager->GetParallelWorld(fGhostWorldName);
   fGhostNavigator = fTransportationManager->GetNavigator(fGhostWorld);
   fGhostNavigator->SetPushVerbosity(false);
+  fMesh.reset();
+  fMeshChecked = false;
+  fFieldChecked = false;
 }
 
 void G4ParallelWorldProcess::SetParallelWorld(G4VPhysicalVolume* parallelWorld)
@@ -110,21 +116,30 @@ void G4ParallelWorldProcess::SetParallelWorld(G4VPhysicalVolume* parallelWorld)
   fGhostWorld = parallelWorld;
   fGhostNavigator = fTransportationManager->GetNavigator(fGhostWorld);
   fGhostNavigator->SetPushVerbosity(false);
+  fMesh.reset();
+  fMeshChecked = false;
+  fFieldChecked = false;
 }
 
 void G4ParallelWorldProcess::StartTracking(G4Track* trk)
 {
-  if (fGhostNavigator != nullptr) {
-    fNavigatorID = fTransportationManager->ActivateNavigator(fGhostNavigator);
-  }
-  else {
+  if (fGhostNavigator == nullptr) {
     G4Exception(
       "G4ParallelWorldProcess::StartTracking", "ProcParaWorld000", FatalException,
       "G4ParallelWorldProcess is used for tracking without having a parallel world assigned");
   }
-  fPathFinder->PrepareNewTrack(trk->GetPosition(), trk->GetMomentumDirection());
+  fOnMesh = IsMeshNavigable(trk);
+  if (fOnMesh) {
+    fMeshCell = fMesh->Locate(trk->GetPosition(), trk->GetMomentumDirection());
+    fOldGhostTouchable =
+      fMesh->CreateTouchable(fMeshCell, trk->GetPosition(), trk->GetMomentumDirection());
+  }
+  else {
+    fNavigatorID = fTransportationManager->ActivateNavigator(fGhostNavigator);
+    fPathFinder->PrepareNewTrack(trk->GetPosition(), trk->GetMomentumDirection());
+    fOldGhostTouchable = fPathFinder->CreateTouchableHandle(fNavigatorID);
+  }
 
-  fOldGhostTouchable = fPathFinder->CreateTouchableHandle(fNavigatorID);
   fGhostPreStepPoint->SetTouchableHandle(fOldGhostTouchable);
   fNewGhostTouchable = fOldGhostTouchable;
   fGhostPostStepPoint->SetTouchableHandle(fNewGhostTouchable);
@@ -209,10 +224,15 @@ G4VParticleChange* G4ParallelWorldProcess::PostStepDoIt(const G4Track& track, co
   if (fOldGhostTouchable->GetVolume() != nullptr) {
     aSD = fOldGhostTouchable->GetVolume()->GetLogicalVolume()->GetSensitiveDetector();
   }
+  G4bool cellChanged = fOnMesh && MeshPostStepLocate(track, step);
   CopyStep(step);
   fGhostPreStepPoint->SetSensitiveDetector(aSD);
 
-  if (fOnBoundary) {
+  if (cellChanged) {
+    fNewGhostTouchable = fMesh->CreateTouchable(fMeshCell, step.GetPostStepPoint()->GetPosition(),
+                                                track.GetMomentumDirection());
+  }
+  else if (fOnBoundary && !fOnMesh) {
     fNewGhostTouchable = fPathFinder->CreateTouchableHandle(fNavigatorID);
   }
   else {
@@ -264,7 +284,11 @@ G4double G4ParallelWorldProcess::AlongStepGetPhysicalInteractionLength(const G4T
   }
   if (fGhostSafety < 0.) fGhostSafety = 0.0;
 
-  if (currentMinimumStep <= fGhostSafety && currentMinimumStep > 0.) {
+  if (fOnMesh) {
+    returnedStep = MeshAlongStepGPIL(track, currentMinimumStep, proposedSafety, selection);
+    eLim = kDoNot;  // The navigator of this world is not active
+  }
+  else if (currentMinimumStep <= fGhostSafety && currentMinimumStep > 0.) {
     // I have no chance to limit
     returnedStep = currentMinimumStep;
     fOnBoundary = false;
@@ -317,6 +341,86 @@ G4double G4ParallelWorldProcess::AlongStepGetPhysicalInteractionLength(const G4T
   return returnedStep;
 }
 
+G4double G4ParallelWorldProcess::MeshAlongStepGPIL(const G4Track& track,
+                                                   G4double currentMinimumStep,
+                                                   G4double& proposedSafety,
+                                                   G4GPILSelection* selection)
+{
+  // Closed-form step and safety in the mesh; cheap enough not to
+  // rely on the safety of previous steps, which may not hold if the
+  // track was displaced along the step (multiple scattering)
+  const G4ThreeVector& position = track.GetPosition();
+  const G4ThreeVector& direction = track.GetMomentumDirection();
+
+  fGhostSafety = fMesh->ComputeSafety(position, fMeshCell);
+  proposedSafety = fGhostSafety;
+  fMeshStep = fMesh->ComputeStep(position, direction, fMeshCell, fNextMeshCell);
+  if (fMeshStep <= currentMinimumStep) {
+    fOnBoundary = true;
+    fMeshEndPoint = position + fMeshStep * direction;
+    *selection = CandidateForSelection;
+    return fMeshStep;
+  }
+  fOnBoundary = false;
+  return currentMinimumStep;
+}
+
+G4bool G4ParallelWorldProcess::MeshPostStepLocate(const G4Track& track, const G4Step& step)
+{
+  // The boundary is crossed if the step ended where expected, i.e. it
+  // was neither shortened by another world or process, nor displaced;
+  // otherwise the cell is located again at the end point
+  const G4ThreeVector& position = step.GetPostStepPoint()->GetPosition();
+  G4double tolerance = fMesh->GetTolerance();
+  if (fOnBoundary && (position - fMeshEndPoint).mag2() <= tolerance * tolerance) {
+    fMeshCell = fNextMeshCell;
+    return true;
+  }
+  fOnBoundary = false;
+  G4ParallelWorldMesh::Cell cell = fMesh->Locate(position, track.GetMomentumDirection());
+  if (cell == fMeshCell) return false;
+  fMeshCell = cell;
+  return true;
+}
+
+G4bool G4ParallelWorldProcess::IsMeshNavigable(const G4Track* trk)
+{
+  if (!meshNavigationFlag) return false;
+  if (!fMeshChecked) {
+    // The layout of the world is checked once built and closed
+    fMeshChecked = true;
+    fMesh = std::make_unique<G4ParallelWorldMesh>(fGhostWorld, fGhostNavigator);
+    if (!fMesh->IsValid()) fMesh.reset();
+    if (fMesh != nullptr && verboseLevel > 0) {
+      G4cout << GetProcessName() << " : parallel world <" << fGhostWorldName
+             << "> is navigated as a regular mesh." << G4endl;
+    }
+  }
+  if (fMesh == nullptr) return false;
+
+  // Optical photons require the navigator of the world limiting the
+  // step, for the normal to the surface
+  const G4ParticleDefinition* particle = trk->GetDefinition();
+  if (particle->GetParticleType() == "opticalphoton") return false;
+
+  // Only tracks moving on straight lines
+  if (particle->GetPDGCharge() == 0. && particle->GetPDGMagneticMoment() == 0.) return true;
+  const G4FieldManager* fieldMgr = fTransportationManager->GetFieldManager();
+  if (fieldMgr != nullptr && fieldMgr->GetDetectorField() != nullptr) return false;
+  if (!fFieldChecked) {
+    fFieldChecked = true;
+    fLocalFieldPresent = false;
+    for (const auto* lv : *G4LogicalVolumeStore::GetInstance()) {
+      fieldMgr = lv->GetFieldManager();
+      if (fieldMgr != nullptr && fieldMgr->GetDetectorField() != nullptr) {
+        fLocalFieldPresent = true;
+        break;
+      }
+    }
+  }
+  return !fLocalFieldPresent;
+}
+
 G4VParticleChange* G4ParallelWorldProcess::AlongStepDoIt(const G4Track& track, const G4Step&)
 {
   pParticleChange->Initialize(track);
@@ -54,6 +54,7 @@
 #include "G4EquationOfMotion.hh"
 
 #include "G4FieldManagerStore.hh"
+#include "G4FieldStatistics.hh"
 
 #include "G4Navigator.hh"
 #include "G4PropagatorInField.hh"
@@ -582,6 +583,7 @@ G4VParticleChange* G4Transportation::AlongStepDoIt( const G4Track& track,
         fSumEnergyKilled += endEnergy;
         fSumEnerSqKilled += endEnergy * endEnergy;
         fNumLoopersKilled++;
+        G4FieldStatistics::Count(G4FieldStatistics::kLoopingKills);
         
         if( endEnergy > fMaxEnergyKilled ) {
            fMaxEnergyKilled = endEnergy;
@@ -807,6 +809,14 @@ G4Transportation::StartTracking(G4Track* aTrack)
   //  --> a better solution would set this from state of suspended track TODO ? 
   // Was if( aTrack->GetCurrentStepNumber()==1 ) { .. }
 
+  // Particle type to which field propagation statistics are attributed
+  //
+  if( G4FieldStatistics::IsActive() )
+  {
+    G4FieldStatistics::GetInstance()
+      ->SetCurrentParticle(aTrack->GetDefinition()->GetParticleName());
+  }
+
   // ChordFinder reset internal state
   //
   if( fFieldPropagator && fAnyFieldExists )     
@@ -313,6 +313,13 @@ class G4RunManager
     // Same as above, but the mother logical volume is specified instead.
     void ReOptimize(G4LogicalVolume*);
 
+    // To be invoked between runs when the solid, material or daughters of
+    // a logical volume have been modified. At the next BeamOn() only the
+    // modified volumes and their mothers are re-optimised, and only the
+    // couples of the regions they belong to are updated, the rest of the
+    // geometry being kept closed.
+    void VolumeHasBeenModified(G4LogicalVolume*);
+
     inline void SetGeometryToBeOptimized(G4bool vl)
     {
       if (geometryToBeOptimized != vl) {
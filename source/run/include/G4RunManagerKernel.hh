@@ -53,9 +53,12 @@
 #include "G4EventManager.hh"
 #include "globals.hh"
 
+#include <set>
+
 class G4VUserPhysicsList;
 class G4VPhysicalVolume;
 class G4Region;
+class G4LogicalVolume;
 class G4ExceptionHandler;
 class G4StackManager;
 class G4TrackingManager;
@@ -190,6 +193,11 @@ class G4RunManagerKernel
     G4bool ConfirmCoupledTransportation();
     void SetScoreSplitter();
 
+    // Updates only the regions of the volumes recorded as modified in
+    // G4GeometryManager; returns false if a full update is required.
+    G4bool UpdateModifiedRegions();
+    G4bool HasKnownRegions(G4LogicalVolume* lv, std::set<G4LogicalVolume*>& scanned) const;
+
   protected:
     RMKType runManagerKernelType;
     G4Region* defaultRegion = nullptr;
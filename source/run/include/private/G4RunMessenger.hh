@@ -91,6 +91,7 @@ class G4RunMessenger : public G4UImessenger
     G4UIcmdWithoutParameter* abortEventCmd = nullptr;
     G4UIcmdWithoutParameter* initCmd = nullptr;
     G4UIcmdWithoutParameter* geomCmd = nullptr;
+    G4UIcmdWithAString* volModCmd = nullptr;
     G4UIcmdWithABool* geomRebCmd = nullptr;
     G4UIcmdWithoutParameter* physCmd = nullptr;
     G4UIcmdWithAnInteger* randEvtCmd = nullptr;
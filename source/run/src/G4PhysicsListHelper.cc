@@ -651,8 +651,8 @@ void G4PhysicsListHelper::ReadInDefaultOrderingParameter()
   tmp.processType = fElectromagnetic;
   tmp.processSubType = fElectronGeneralProcess;
   tmp.ordering[0] = -1;
-  tmp.ordering[1] = 1;
-  tmp.ordering[2] = 1;
+  tmp.ordering[1] = 2;
+  tmp.ordering[2] = 2;
   tmp.isDuplicable = false;
   theTable->push_back(tmp);
   sizeOfTable += 1;
@@ -730,9 +730,9 @@ void G4PhysicsListHelper::ReadInDefaultOrderingParameter()
   tmp.processTypeName = "PositronGeneral";
   tmp.processType = fElectromagnetic;
   tmp.processSubType = fPositronGeneralProcess;
-  tmp.ordering[0] = 1;
-  tmp.ordering[1] = 1;
-  tmp.ordering[2] = 1;
+  tmp.ordering[0] = 5;
+  tmp.ordering[1] = 2;
+  tmp.ordering[2] = 2;
   tmp.isDuplicable = false;
   theTable->push_back(tmp);
   sizeOfTable += 1;
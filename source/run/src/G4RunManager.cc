@@ -872,6 +872,12 @@ void G4RunManager::ReOptimize(G4LogicalVolume* pLog)
   }
 }
 
+// --------------------------------------------------------------------
+void G4RunManager::VolumeHasBeenModified(G4LogicalVolume* pLog)
+{
+  G4GeometryManager::GetInstance()->VolumeHasBeenModified(pLog);
+}
+
 // --------------------------------------------------------------------
 void G4RunManager::SetUserInitialization(G4VUserDetectorConstruction* userInit)
 {
@@ -35,6 +35,7 @@
 #include "G4AutoLock.hh"
 #include "G4ExceptionHandler.hh"
 #include "G4FieldManagerStore.hh"
+#include "G4FieldStatistics.hh"
 #include "G4Geantino.hh"
 #include "G4GeometryManager.hh"
 #include "G4IonConstructor.hh"
@@ -70,6 +71,8 @@
 #include "G4Version.hh"
 #include "G4ios.hh"
 
+#include <algorithm>
+#include <set>
 #include <vector>
 
 #ifdef G4BT_DEBUG
@@ -635,7 +638,7 @@ G4bool G4RunManagerKernel::RunInitialization(G4bool fakeRun)
   UpdateRegion();
   BuildPhysicsTables(fakeRun);
 
-  if (geometryNeedsToBeClosed) {
+  if (geometryNeedsToBeClosed || G4GeometryManager::GetInstance()->HasModifiedVolumes()) {
     ResetNavigator();
     // CheckRegularGeometry();
     // Notify the VisManager as well
@@ -676,6 +679,13 @@ void G4RunManagerKernel::RunTermination()
 {
   if (runManagerKernelType != workerRMK)
     G4ProductionCutsTable::GetProductionCutsTable()->PhysicsTableUpdated();
+
+  // Workers merge their field propagation statistics, the master
+  // (after all workers have terminated) merges its own and reports
+  if (G4FieldStatistics::IsActive()) {
+    G4FieldStatistics::GetInstance()->Merge();
+    if (runManagerKernelType != workerRMK) G4FieldStatistics::PrintTotals();
+  }
   G4StateManager::GetStateManager()->SetNewState(G4State_Idle);
 }
 
@@ -693,6 +703,15 @@ void G4RunManagerKernel::ResetNavigator()
   // and previous optimisations to be cleared.
 
   G4GeometryManager* geomManager = G4GeometryManager::GetInstance();
+
+  // Only some logical volumes have been modified: the rest of the
+  // geometry is kept closed and only these volumes are re-optimised
+  if (!geometryNeedsToBeClosed && geomManager->HasModifiedVolumes()) {
+    if (verboseLevel > 1) G4cout << "Start closing modified volumes." << G4endl;
+    geomManager->CloseModifiedVolumes(geometryToBeOptimized, verboseLevel > 1);
+    return;
+  }
+
   if (verboseLevel > 1) G4cout << "Start closing geometry." << G4endl;
 
   geomManager->OpenGeometry();
@@ -714,6 +733,8 @@ void G4RunManagerKernel::UpdateRegion()
 
   if (runManagerKernelType == workerRMK) return;
 
+  if (!geometryNeedsToBeClosed && UpdateModifiedRegions()) return;
+
   CheckRegions();
 
   G4RegionStore::GetInstance()->UpdateMaterialList(currentWorld);
@@ -721,6 +742,54 @@ void G4RunManagerKernel::UpdateRegion()
   G4ProductionCutsTable::GetProductionCutsTable()->UpdateCoupleTable(currentWorld);
 }
 
+// --------------------------------------------------------------------
+G4bool G4RunManagerKernel::UpdateModifiedRegions()
+{
+  // Only the regions of the logical volumes recorded as modified in the
+  // geometry manager are scanned again, and the couples of these regions
+  // updated. A full update is required instead if a modified volume is
+  // not yet part of a region, or contains the root of a region not yet
+  // found in any world
+
+  G4GeometryManager* geomManager = G4GeometryManager::GetInstance();
+  if (!geomManager->HasModifiedVolumes()) return false;
+
+  std::vector<G4Region*> regions;
+  std::set<G4LogicalVolume*> scanned;
+  for (auto lv : geomManager->GetModifiedVolumes()) {
+    G4Region* region = lv->GetRegion();
+    if (region == nullptr || !HasKnownRegions(lv, scanned)) return false;
+    if (std::find(regions.cbegin(), regions.cend(), region) == regions.cend()) {
+      regions.push_back(region);
+    }
+  }
+
+  if (verboseLevel > 1) {
+    G4cout << "Updating " << regions.size() << " region(s) of modified volumes." << G4endl;
+  }
+  for (auto region : regions) {
+    region->UpdateMaterialList();
+  }
+  G4ProductionCutsTable::GetProductionCutsTable()->UpdateCoupleTable(currentWorld, regions);
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4RunManagerKernel::HasKnownRegions(G4LogicalVolume* lv,
+                                           std::set<G4LogicalVolume*>& scanned) const
+{
+  if (!scanned.insert(lv).second) return true;
+
+  G4Region* region = lv->GetRegion();
+  if (region != nullptr && !region->IsInMassGeometry() && !region->IsInParallelGeometry()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < lv->GetNoDaughters(); ++i) {
+    if (!HasKnownRegions(lv->GetDaughter(i)->GetLogicalVolume(), scanned)) return false;
+  }
+  return true;
+}
+
 // --------------------------------------------------------------------
 void G4RunManagerKernel::BuildPhysicsTables(G4bool fakeRun)
 {
@@ -30,6 +30,7 @@
 
 #include "G4RunMessenger.hh"
 
+#include "G4LogicalVolumeStore.hh"
 #include "G4MTRunManager.hh"
 #include "G4ProductionCutsTable.hh"
 #include "G4RunManager.hh"
@@ -233,6 +234,15 @@ G4RunMessenger::G4RunMessenger(G4RunManager* runMgr) : runManager(runMgr)
   geomCmd->SetGuidance(" after the first initialization (or BeamOn).");
   geomCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
 
+  volModCmd = new G4UIcmdWithAString("/run/volumeModified", this);
+  volModCmd->SetGuidance("Notify that a logical volume has been modified.");
+  volModCmd->SetGuidance("At the next BeamOn only this volume and its mothers are");
+  volModCmd->SetGuidance(" re-voxellized and only the couples of its region are updated,");
+  volModCmd->SetGuidance(" instead of closing the whole geometry again.");
+  volModCmd->SetParameterName("logicalVolumeName", false);
+  volModCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  volModCmd->SetToBeBroadcasted(false);
+
   geomRebCmd = new G4UIcmdWithABool("/run/reinitializeGeometry", this);
   geomRebCmd->SetGuidance("Force geometry to be rebuilt once again.");
   geomRebCmd->SetGuidance("This command must be applied if the user needs his/her");
@@ -381,6 +391,7 @@ G4RunMessenger::~G4RunMessenger()
   delete abortEventCmd;
   delete initCmd;
   delete geomCmd;
+  delete volModCmd;
   delete geomRebCmd;
   delete physCmd;
   delete randEvtCmd;
@@ -521,6 +532,17 @@ void G4RunMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
   else if (command == geomCmd) {
     runManager->GeometryHasBeenModified(false);
   }
+  else if (command == volModCmd) {
+    G4LogicalVolume* pLog = G4LogicalVolumeStore::GetInstance()->GetVolume(newValue, false);
+    if (pLog == nullptr) {
+      G4ExceptionDescription ed;
+      ed << "Logical volume <" << newValue << "> is not found. Command ignored.";
+      G4Exception("G4RunMessenger::SetNewValue()", "Run0130", JustWarning, ed);
+    }
+    else {
+      runManager->VolumeHasBeenModified(pLog);
+    }
+  }
   else if (command == geomRebCmd) {
     runManager->ReinitializeGeometry(geomRebCmd->GetNewBoolValue(newValue), false);
   }
@@ -29,6 +29,7 @@
 
 #include "G4AutoLock.hh"
 #include "G4EnvironmentUtils.hh"
+#include "G4TaskDispatcher.hh"
 #include "G4ProductionCutsTable.hh"
 #include "G4Run.hh"
 #include "G4ScoringManager.hh"
@@ -162,6 +163,7 @@ G4TaskRunManager::~G4TaskRunManager()
   workTaskGroup = nullptr;
 
   // destroy the thread-pool
+  G4TaskDispatcher::SetThreadPool(nullptr);
   if (threadPool != nullptr) threadPool->destroy_threadpool();
 
   PTL::TaskRunManager::Terminate();
@@ -243,6 +245,9 @@ void G4TaskRunManager::InitializeThreadPool()
     workTaskGroup = new RunTaskGroup(threadPool);
   }
 
+  // let the geometry distribute its own tasks on the pool
+  G4TaskDispatcher::SetThreadPool(threadPool);
+
   if (verboseLevel > 0) {
     std::stringstream ss;
     ss.fill('=');